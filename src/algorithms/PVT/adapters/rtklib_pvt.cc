@@ -899,6 +899,9 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.udp_eph_addresses = configuration->property(role + ".monitor_ephemeris_client_addresses", std::string("127.0.0.1"));
     pvt_output_parameters.udp_eph_port = configuration->property(role + ".monitor_ephemeris_udp_port", 1234);
 
+    // Send the monitoring datagrams from a separate thread, through a queue of up to monitor_udp_queue_size datagrams
+    pvt_output_parameters.udp_queue_size = configuration->property(role + ".monitor_udp_queue_size", pvt_output_parameters.udp_queue_size);
+
     // Show time in local zone
     pvt_output_parameters.show_local_time_zone = configuration->property(role + ".show_local_time_zone", false);
 
@@ -919,6 +922,10 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     // Use unhealthy satellites
     pvt_output_parameters.use_unhealthy_sats = configuration->property(role + ".use_unhealthy_sats", pvt_output_parameters.use_unhealthy_sats);
 
+    // Write the outputs from a separate thread, through a queue of up to output_queue_size jobs
+    pvt_output_parameters.output_queue_size = configuration->property(role + ".output_queue_size", pvt_output_parameters.output_queue_size);
+    pvt_output_parameters.output_queue_drop = configuration->property(role + ".output_queue_drop", pvt_output_parameters.output_queue_drop);
+
     // make PVT object
     pvt_ = rtklib_make_pvt_gs(in_streams_, pvt_output_parameters, rtk);
     DLOG(INFO) << "pvt(" << pvt_->unique_id() << ")";
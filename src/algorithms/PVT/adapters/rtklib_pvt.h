@@ -165,6 +165,7 @@ class Gps_Ephemeris;
  *  .enable_monitor_ephemeris - enable the ephemeris monitor (false)
  *  .monitor_ephemeris_client_addresses - ("127.0.0.1")
  *  .monitor_ephemeris_udp_port - DO NOT USE THE DEFAULT (1234)
+ *  .monitor_udp_queue_size - if > 0, both monitors send from a thread through a queue of this size (0)
  *
  *  .show_local_time_zone - (false)
  *  .enable_rx_clock_correction - (false)
@@ -38,6 +38,7 @@
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_filesystem.h"
 #include "gnss_sdr_make_unique.h"
+#include "gnss_synchro_epoch.h"
 #include "gps_almanac.h"
 #include "gps_cnav_ephemeris.h"
 #include "gps_cnav_iono.h"
@@ -53,6 +54,7 @@
 #include "monitor_pvt_udp_sink.h"
 #include "nmea_printer.h"
 #include "pvt_conf.h"
+#include "pvt_output_queue.h"
 #include "rinex_printer.h"
 #include "rtcm_printer.h"
 #include "rtklib_rtkcmn.h"
@@ -127,7 +129,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
     const Pvt_Conf& conf_,
     const rtk_t& rtk)
     : gr::sync_block("rtklib_pvt_gs",
-          gr::io_signature::make(nchannels, nchannels, sizeof(Gnss_Synchro)),
+          gr::io_signature::make(1, 1, sizeof(Gnss_Synchro_Epoch)),
           gr::io_signature::make(0, 0, 0)),
       d_dump_filename(conf_.dump_filename),
       d_geohash(std::make_unique<Geohash>()),
@@ -221,6 +223,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 
     d_initial_carrier_phase_offset_estimation_rads = std::vector<double>(nchannels, 0.0);
     d_channel_initialized = std::vector<bool>(nchannels, false);
+    d_observable_filter = Pvt_Observable_Filter(d_use_unhealthy_sats);
 
     std::string dump_ls_pvt_filename = conf_.dump_filename;
 
@@ -467,7 +470,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
-            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled);
+            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled, conf_.udp_queue_size);
         }
     else
         {
@@ -482,7 +485,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
-            d_eph_udp_sink_ptr = std::make_unique<Monitor_Ephemeris_Udp_Sink>(udp_addr_vec, conf_.udp_eph_port, conf_.protobuf_enabled);
+            d_eph_udp_sink_ptr = std::make_unique<Monitor_Ephemeris_Udp_Sink>(udp_addr_vec, conf_.udp_eph_port, conf_.protobuf_enabled, conf_.udp_queue_size);
         }
     else
         {
@@ -556,6 +559,9 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_user_pvt_solver = d_internal_pvt_solver;
         }
 
+    // output queue
+    d_output_queue = std::make_unique<Pvt_Output_Queue>(conf_.output_queue_size, conf_.output_queue_drop);
+
     // set the RTKLIB trace (debug) level
     tracelevel(conf_.rtk_trace_level);
 
@@ -581,6 +587,8 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 rtklib_pvt_gs::~rtklib_pvt_gs()
 {
     DLOG(INFO) << "PVT block destructor called.";
+    // write the pending outputs before the printers are destroyed
+    d_output_queue.reset();
     if (d_sysv_msqid != -1)
         {
             msgctl(d_sysv_msqid, IPC_RMID, nullptr);
@@ -1169,7 +1177,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                             d_eph_udp_sink_ptr->write_gps_ephemeris(gps_eph);
                         }
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
                             if (d_internal_pvt_solver->gps_ephemeris_map.find(gps_eph->PRN) == d_internal_pvt_solver->gps_ephemeris_map.cend())
@@ -1188,10 +1196,17 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Gps_Ephemeris> new_eph;
                                     new_eph[gps_eph->PRN] = *gps_eph;
-                                    d_rp->log_rinex_nav_gps_nav(d_type_of_rx, new_eph);
+                                    const auto log_rinex_nav = [this, new_eph]() {
+                                        if (d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                                            {
+                                                d_rp->log_rinex_nav_gps_nav(d_type_of_rx, new_eph);
+                                            }
+                                    };
+                                    d_output_queue->submit(log_rinex_nav, false);
                                 }
                         }
                     d_internal_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
+                    d_observable_filter.update(*gps_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
@@ -1237,7 +1252,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS CNAV message ###
                     const auto gps_cnav_ephemeris = wht::any_cast<std::shared_ptr<Gps_CNAV_Ephemeris>>(pmt::any_ref(msg));
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
                             if (d_internal_pvt_solver->gps_cnav_ephemeris_map.find(gps_cnav_ephemeris->PRN) == d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
@@ -1256,10 +1271,17 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
                                     new_cnav_eph[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
-                                    d_rp->log_rinex_nav_gps_cnav(d_type_of_rx, new_cnav_eph);
+                                    const auto log_rinex_nav = [this, new_cnav_eph]() {
+                                        if (d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                                            {
+                                                d_rp->log_rinex_nav_gps_cnav(d_type_of_rx, new_cnav_eph);
+                                            }
+                                    };
+                                    d_output_queue->submit(log_rinex_nav, false);
                                 }
                         }
                     d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
+                    d_observable_filter.update(*gps_cnav_ephemeris);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
@@ -1329,7 +1351,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                             d_eph_udp_sink_ptr->write_galileo_ephemeris(galileo_eph);
                         }
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
                             if (d_internal_pvt_solver->galileo_ephemeris_map.find(galileo_eph->PRN) == d_internal_pvt_solver->galileo_ephemeris_map.cend())
@@ -1348,10 +1370,17 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
                                     new_gal_eph[galileo_eph->PRN] = *galileo_eph;
-                                    d_rp->log_rinex_nav_gal_nav(d_type_of_rx, new_gal_eph);
+                                    const auto log_rinex_nav = [this, new_gal_eph]() {
+                                        if (d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                                            {
+                                                d_rp->log_rinex_nav_gal_nav(d_type_of_rx, new_gal_eph);
+                                            }
+                                    };
+                                    d_output_queue->submit(log_rinex_nav, false);
                                 }
                         }
                     d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
+                    d_observable_filter.update(*galileo_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
@@ -1452,7 +1481,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                << " and Ephemeris IOD in UTC = " << glonass_gnav_eph->compute_GLONASS_time(glonass_gnav_eph->d_t_b)
                                << " from SV = " << glonass_gnav_eph->i_satellite_slot_number;
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
                             if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(glonass_gnav_eph->PRN) == d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
@@ -1471,10 +1500,17 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
                                     new_glo_eph[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
-                                    d_rp->log_rinex_nav_glo_gnav(d_type_of_rx, new_glo_eph);
+                                    const auto log_rinex_nav = [this, new_glo_eph]() {
+                                        if (d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                                            {
+                                                d_rp->log_rinex_nav_glo_gnav(d_type_of_rx, new_glo_eph);
+                                            }
+                                    };
+                                    d_output_queue->submit(log_rinex_nav, false);
                                 }
                         }
                     d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
+                    d_observable_filter.update(*glonass_gnav_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
@@ -1515,7 +1551,7 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                << "inserted with Toe=" << bds_dnav_eph->toe << " and BDS Week="
                                << bds_dnav_eph->WN;
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
                             if (d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(bds_dnav_eph->PRN) == d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
@@ -1534,10 +1570,17 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Beidou_Dnav_Ephemeris> new_bds_eph;
                                     new_bds_eph[bds_dnav_eph->PRN] = *bds_dnav_eph;
-                                    d_rp->log_rinex_nav_bds_dnav(d_type_of_rx, new_bds_eph);
+                                    const auto log_rinex_nav = [this, new_bds_eph]() {
+                                        if (d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                                            {
+                                                d_rp->log_rinex_nav_bds_dnav(d_type_of_rx, new_bds_eph);
+                                            }
+                                    };
+                                    d_output_queue->submit(log_rinex_nav, false);
                                 }
                         }
                     d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->PRN] = *bds_dnav_eph;
+                    d_observable_filter.update(*bds_dnav_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
                             d_user_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->PRN] = *bds_dnav_eph;
@@ -1617,15 +1660,23 @@ void rtklib_pvt_gs::msg_handler_has_data(const pmt::pmt_t& msg)
                                     d_user_pvt_solver->store_has_data(*has_data);
                                 }
                         }
-                    if (d_has_simple_printer)
-                        {
-                            d_has_simple_printer->print_message(has_data.get());
-                        }
-                    if (d_rtcm_printer && has_data->tow <= 604800)
+                    if (d_has_simple_printer || d_rtcm_printer)
                         {
-                            d_rtcm_printer->Print_IGM_Messages(*has_data.get());
+                            const auto print_has_data = [this, has_data]() {
+                                if (d_has_simple_printer)
+                                    {
+                                        d_has_simple_printer->print_message(has_data.get());
+                                    }
+                                if (d_rtcm_printer && has_data->tow <= 604800)
+                                    {
+                                        d_rtcm_printer->Print_IGM_Messages(*has_data.get());
+                                    }
+                            };
+                            d_output_queue->submit(print_has_data, false);
                         }
                 }
+            // the output snapshots will pick up the new navigation data
+            d_output_nav_data_changed = true;
         }
     catch (const wht::bad_any_cast& e)
         {
@@ -1678,6 +1729,9 @@ void rtklib_pvt_gs::clear_ephemeris()
     d_internal_pvt_solver->galileo_almanac_map.clear();
     d_internal_pvt_solver->beidou_dnav_ephemeris_map.clear();
     d_internal_pvt_solver->beidou_dnav_almanac_map.clear();
+    d_observable_filter.clear_gps();
+    d_observable_filter.clear_galileo();
+    d_observable_filter.clear_beidou();
     if (d_enable_rx_clock_correction == true)
         {
             d_user_pvt_solver->gps_ephemeris_map.clear();
@@ -1687,6 +1741,7 @@ void rtklib_pvt_gs::clear_ephemeris()
             d_user_pvt_solver->beidou_dnav_ephemeris_map.clear();
             d_user_pvt_solver->beidou_dnav_almanac_map.clear();
         }
+    d_output_nav_data_changed = true;
 }
 
 
@@ -1975,108 +2030,41 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
             bool flag_write_RTCM_1045_output = false;
             bool flag_write_RTCM_MSM_output = false;
             bool flag_write_RINEX_obs_output = false;
+            bool flag_write_output = false;
+            Pvt_Output_Epoch output_epoch;
             d_local_counter_ms += static_cast<uint64_t>(d_observable_interval_ms);
 
-            d_gnss_observables_map.clear();
-            const auto** in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0]);  // Get the input buffer pointer
+            const Gnss_Synchro_Epoch& observables = reinterpret_cast<const Gnss_Synchro_Epoch*>(input_items[0])[epoch];  // Get the input buffer pointer
             // ############ 1. READ PSEUDORANGES ####
+            d_observable_filter.select(observables, d_gnss_observables_map);
             for (uint32_t i = 0; i < d_nchannels; i++)
                 {
-                    if (in[i][epoch].Flag_valid_pseudorange)
+                    if (observables.valid_pseudorange(i))
                         {
-                            const auto tmp_eph_iter_gps = d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_gal = d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_cnav = d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_glo_gnav = d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_bds_dnav = d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(in[i][epoch].PRN);
-
-                            bool store_valid_observable = false;
-
-                            if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_gps->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (std::string(in[i][epoch].Signal, 2) == std::string("1C")) && (d_use_unhealthy_sats || (tmp_eph_iter_gps->second.SV_health == 0)))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_gal->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) &&
-                                        (((std::string(in[i][epoch].Signal, 2) == std::string("1B")) && (d_use_unhealthy_sats || ((tmp_eph_iter_gal->second.E1B_DVS == false) && (tmp_eph_iter_gal->second.E1B_HS == 0)))) ||
-                                            ((std::string(in[i][epoch].Signal, 2) == std::string("5X")) && (d_use_unhealthy_sats || ((tmp_eph_iter_gal->second.E5a_DVS == false) && (tmp_eph_iter_gal->second.E5a_HS == 0)))) ||
-                                            ((std::string(in[i][epoch].Signal, 2) == std::string("7X")) && (d_use_unhealthy_sats || ((tmp_eph_iter_gal->second.E5b_DVS == false) && (tmp_eph_iter_gal->second.E5b_HS == 0))))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_cnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (((std::string(in[i][epoch].Signal, 2) == std::string("2S")) || (std::string(in[i][epoch].Signal, 2) == std::string("L5")))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_glo_gnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && ((std::string(in[i][epoch].Signal, 2) == std::string("1G")) || (std::string(in[i][epoch].Signal, 2) == std::string("2G"))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_bds_dnav != d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_bds_dnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (((std::string(in[i][epoch].Signal, 2) == std::string("B1")) || (std::string(in[i][epoch].Signal, 2) == std::string("B3"))) && (d_use_unhealthy_sats || (tmp_eph_iter_bds_dnav->second.SV_health == 0))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (std::string(in[i][epoch].Signal, 2) == std::string("E6"))
-                                {
-                                    store_valid_observable = true;
-                                }
-
-                            if (store_valid_observable)
-                                {
-                                    // store valid observables in a map.
-                                    d_gnss_observables_map.insert(std::pair<int, Gnss_Synchro>(i, in[i][epoch]));
-                                }
-
                             if (d_rtcm_enabled)
                                 {
+                                    const Gnss_Synchro gnss_synchro = observables.get(i);
                                     try
                                         {
-                                            if (d_internal_pvt_solver->gps_ephemeris_map.empty() == false)
+                                            const auto tmp_eph_iter_gps = d_internal_pvt_solver->gps_ephemeris_map.find(gnss_synchro.PRN);
+                                            const auto tmp_eph_iter_gal = d_internal_pvt_solver->galileo_ephemeris_map.find(gnss_synchro.PRN);
+                                            const auto tmp_eph_iter_cnav = d_internal_pvt_solver->gps_cnav_ephemeris_map.find(gnss_synchro.PRN);
+                                            const auto tmp_eph_iter_glo_gnav = d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(gnss_synchro.PRN);
+                                            if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
                                                 {
-                                                    if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(tmp_eph_iter_gps->second, gnss_synchro.RX_time, gnss_synchro);  // keep track of locking time
                                                 }
-                                            if (d_internal_pvt_solver->galileo_ephemeris_map.empty() == false)
+                                            if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
                                                 {
-                                                    if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(tmp_eph_iter_gal->second, gnss_synchro.RX_time, gnss_synchro);  // keep track of locking time
                                                 }
-                                            if (d_internal_pvt_solver->gps_cnav_ephemeris_map.empty() == false)
+                                            if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
                                                 {
-                                                    if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(tmp_eph_iter_cnav->second, gnss_synchro.RX_time, gnss_synchro);  // keep track of locking time
                                                 }
-                                            if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.empty() == false)
+                                            if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
                                                 {
-                                                    if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(tmp_eph_iter_glo_gnav->second, gnss_synchro.RX_time, gnss_synchro);  // keep track of locking time
                                                 }
                                         }
                                     catch (const boost::exception& ex)
@@ -2333,56 +2321,19 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                             send_sys_v_ttff_msg(ttff);
                                             d_first_fix = false;
                                         }
-                                    if (d_kml_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_kml_rate_ms == 0)
-                                                {
-                                                    d_kml_dump->print_position(d_user_pvt_solver.get());
-                                                }
-                                        }
-                                    if (d_gpx_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_gpx_rate_ms == 0)
-                                                {
-                                                    d_gpx_dump->print_position(d_user_pvt_solver.get());
-                                                }
-                                        }
-                                    if (d_geojson_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_geojson_rate_ms == 0)
-                                                {
-                                                    d_geojson_printer->print_position(d_user_pvt_solver.get());
-                                                }
-                                        }
-                                    if (d_nmea_output_file_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_nmea_rate_ms == 0)
-                                                {
-                                                    d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get());
-                                                }
-                                        }
-                                    if (d_rinex_output_enabled)
-                                        {
-                                            d_rp->print_rinex_annotation(d_user_pvt_solver.get(), d_gnss_observables_map, d_rx_time, d_type_of_rx, flag_write_RINEX_obs_output);
-                                        }
-                                    if (d_rtcm_enabled)
-                                        {
-                                            d_rtcm_printer->Print_Rtcm_Messages(d_user_pvt_solver.get(),
-                                                d_gnss_observables_map,
-                                                d_rx_time,
-                                                d_type_of_rx,
-                                                d_rtcm_MSM_rate_ms,
-                                                d_rtcm_MT1019_rate_ms,
-                                                d_rtcm_MT1020_rate_ms,
-                                                d_rtcm_MT1045_rate_ms,
-                                                d_rtcm_MT1077_rate_ms,
-                                                d_rtcm_MT1097_rate_ms,
-                                                flag_write_RTCM_MSM_output,
-                                                flag_write_RTCM_1019_output,
-                                                flag_write_RTCM_1020_output,
-                                                flag_write_RTCM_1045_output,
-                                                d_enable_rx_clock_correction);
-                                        }
+                                    output_epoch.rx_time = d_rx_time;
+                                    output_epoch.kml = d_kml_output_enabled && (current_RX_time_ms % d_kml_rate_ms == 0);
+                                    output_epoch.gpx = d_gpx_output_enabled && (current_RX_time_ms % d_gpx_rate_ms == 0);
+                                    output_epoch.geojson = d_geojson_output_enabled && (current_RX_time_ms % d_geojson_rate_ms == 0);
+                                    output_epoch.nmea = d_nmea_output_file_enabled && (current_RX_time_ms % d_nmea_rate_ms == 0);
+                                    output_epoch.rinex = d_rinex_output_enabled;
+                                    output_epoch.rinex_obs = flag_write_RINEX_obs_output;
+                                    output_epoch.rtcm = d_rtcm_enabled;
+                                    output_epoch.rtcm_msm = flag_write_RTCM_MSM_output;
+                                    output_epoch.rtcm_1019 = flag_write_RTCM_1019_output;
+                                    output_epoch.rtcm_1020 = flag_write_RTCM_1020_output;
+                                    output_epoch.rtcm_1045 = flag_write_RTCM_1045_output;
+                                    flag_write_output = true;
                                 }
                         }
 
@@ -2450,7 +2401,8 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                 }
                             if (d_flag_monitor_pvt_enabled)
                                 {
-                                    d_udp_sink_ptr->write_monitor_pvt(monitor_pvt.get());
+                                    output_epoch.monitor_pvt = monitor_pvt;
+                                    flag_write_output = true;
                                 }
                         }
                 }
@@ -2458,10 +2410,124 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                 {
                     if (d_local_counter_ms % static_cast<uint64_t>(d_an_rate_ms) == 0)
                         {
-                            d_an_printer->print_packet(d_user_pvt_solver.get(), d_gnss_observables_map);
+                            output_epoch.an = true;
+                            flag_write_output = true;
                         }
                 }
+            if (flag_write_output)
+                {
+                    submit_output_epoch(output_epoch);
+                }
         }
 
     return noutput_items;
 }
+
+
+struct rtklib_pvt_gs::Pvt_Output_Data
+{
+    Rtklib_Solver_Snapshot pvt_solution;
+    std::map<int, Gnss_Synchro> observables_map;
+};
+
+
+std::shared_ptr<rtklib_pvt_gs::Pvt_Output_Data> rtklib_pvt_gs::get_output_data()
+{
+    std::lock_guard<std::mutex> lock(d_output_data_pool_mutex);
+    if (d_output_data_pool.empty())
+        {
+            return std::make_shared<Pvt_Output_Data>();
+        }
+    std::shared_ptr<Pvt_Output_Data> output_data = std::move(d_output_data_pool.back());
+    d_output_data_pool.pop_back();
+    return output_data;
+}
+
+
+void rtklib_pvt_gs::recycle_output_data(const std::shared_ptr<Pvt_Output_Data>& output_data)
+{
+    std::lock_guard<std::mutex> lock(d_output_data_pool_mutex);
+    d_output_data_pool.push_back(output_data);
+}
+
+
+void rtklib_pvt_gs::submit_output_epoch(const Pvt_Output_Epoch& output_epoch)
+{
+    if (!d_output_queue->threaded())
+        {
+            // the printers read the navigation data of the user solver
+            const std::shared_ptr<const Rtklib_Navigation_Data> nav_data(d_user_pvt_solver, d_user_pvt_solver.get());
+            write_output_epoch(d_user_pvt_solver->get_snapshot(nav_data), d_gnss_observables_map, output_epoch);
+            return;
+        }
+    // the writer thread gets its own copy of the solution and observables,
+    // and shares an immutable copy of the navigation data
+    if (d_output_nav_data_changed.exchange(false))
+        {
+            d_output_nav_data = std::make_shared<const Rtklib_Navigation_Data>(*d_user_pvt_solver);
+        }
+    const std::shared_ptr<Pvt_Output_Data> output_data = get_output_data();
+    output_data->pvt_solution = d_user_pvt_solver->get_snapshot(d_output_nav_data);
+    output_data->observables_map = d_gnss_observables_map;
+    const auto write_epoch = [this, output_data, output_epoch]() {
+        write_output_epoch(output_data->pvt_solution, output_data->observables_map, output_epoch);
+        recycle_output_data(output_data);
+    };
+    if (!d_output_queue->submit(write_epoch))
+        {
+            recycle_output_data(output_data);
+        }
+}
+
+
+void rtklib_pvt_gs::write_output_epoch(const Rtklib_Solver_Snapshot& pvt_solution,
+    const std::map<int, Gnss_Synchro>& observables_map,
+    const Pvt_Output_Epoch& output_epoch)
+{
+    if (output_epoch.kml)
+        {
+            d_kml_dump->print_position(&pvt_solution);
+        }
+    if (output_epoch.gpx)
+        {
+            d_gpx_dump->print_position(&pvt_solution);
+        }
+    if (output_epoch.geojson)
+        {
+            d_geojson_printer->print_position(&pvt_solution);
+        }
+    if (output_epoch.nmea)
+        {
+            d_nmea_printer->Print_Nmea_Line(&pvt_solution);
+        }
+    if (output_epoch.rinex)
+        {
+            d_rp->print_rinex_annotation(pvt_solution.nav_data.get(), observables_map, output_epoch.rx_time, d_type_of_rx, output_epoch.rinex_obs);
+        }
+    if (output_epoch.rtcm)
+        {
+            d_rtcm_printer->Print_Rtcm_Messages(pvt_solution.nav_data.get(),
+                observables_map,
+                output_epoch.rx_time,
+                d_type_of_rx,
+                d_rtcm_MSM_rate_ms,
+                d_rtcm_MT1019_rate_ms,
+                d_rtcm_MT1020_rate_ms,
+                d_rtcm_MT1045_rate_ms,
+                d_rtcm_MT1077_rate_ms,
+                d_rtcm_MT1097_rate_ms,
+                output_epoch.rtcm_msm,
+                output_epoch.rtcm_1019,
+                output_epoch.rtcm_1020,
+                output_epoch.rtcm_1045,
+                d_enable_rx_clock_correction);
+        }
+    if (output_epoch.monitor_pvt)
+        {
+            d_udp_sink_ptr->write_monitor_pvt(output_epoch.monitor_pvt.get());
+        }
+    if (output_epoch.an)
+        {
+            d_an_printer->print_packet(&pvt_solution, observables_map);
+        }
+}
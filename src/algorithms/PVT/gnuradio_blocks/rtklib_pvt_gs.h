@@ -20,12 +20,14 @@
 #include "gnss_block_interface.h"
 #include "gnss_synchro.h"
 #include "gnss_time.h"
+#include "pvt_observable_filter.h"
 #include "rtklib.h"
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <gnuradio/sync_block.h>  // for sync_block
 #include <gnuradio/types.h>       // for gr_vector_const_void_star
 #include <pmt/pmt.h>              // for pmt_t
+#include <atomic>                 // for atomic
 #include <chrono>                 // for system_clock
 #include <cstddef>                // for size_t
 #include <cstdint>                // for int32_t
@@ -33,6 +35,7 @@
 #include <fstream>                // for std::fstream
 #include <map>                    // for map
 #include <memory>                 // for shared_ptr, unique_ptr
+#include <mutex>                  // for mutex
 #include <queue>                  // for std::queue
 #include <string>                 // for string
 #include <sys/types.h>            // for key_t
@@ -58,13 +61,17 @@ class Gpx_Printer;
 class Kml_Printer;
 class Monitor_Pvt_Udp_Sink;
 class Monitor_Ephemeris_Udp_Sink;
+class Monitor_Pvt;
 class Nmea_Printer;
 class Pvt_Conf;
+class Pvt_Output_Queue;
 class Rinex_Printer;
 class Rtcm_Printer;
 class An_Packet_Printer;
 class Has_Simple_Printer;
+class Rtklib_Navigation_Data;
 class Rtklib_Solver;
+class Rtklib_Solver_Snapshot;
 class rtklib_pvt_gs;
 
 using rtklib_pvt_gs_sptr = gnss_shared_ptr<rtklib_pvt_gs>;
@@ -74,7 +81,8 @@ rtklib_pvt_gs_sptr rtklib_make_pvt_gs(uint32_t nchannels,
     const rtk_t& rtk);
 
 /*!
- * \brief This class implements a block that computes the PVT solution using the RTKLIB integrated library
+ * \brief This class implements a block that computes the PVT solution using the RTKLIB integrated library.
+ * It reads one Gnss_Synchro_Epoch record per epoch from the Observables block.
  */
 class rtklib_pvt_gs : public gr::sync_block
 {
@@ -151,6 +159,37 @@ private:
 
     void update_HAS_corrections();
 
+    // Outputs of an epoch, decided in the block thread and written by the output queue
+    struct Pvt_Output_Epoch
+    {
+        std::shared_ptr<Monitor_Pvt> monitor_pvt;  // sent to the PVT monitor, if not null
+        double rx_time{0.0};
+        bool kml{false};
+        bool gpx{false};
+        bool geojson{false};
+        bool nmea{false};
+        bool rinex{false};
+        bool rinex_obs{false};
+        bool rtcm{false};
+        bool rtcm_msm{false};
+        bool rtcm_1019{false};
+        bool rtcm_1020{false};
+        bool rtcm_1045{false};
+        bool an{false};
+    };
+
+    void submit_output_epoch(const Pvt_Output_Epoch& output_epoch);
+
+    void write_output_epoch(const Rtklib_Solver_Snapshot& pvt_solution,
+        const std::map<int, Gnss_Synchro>& observables_map,
+        const Pvt_Output_Epoch& output_epoch);
+
+    // Solution and observables of an epoch written by the output queue. The
+    // records are recycled, so the observables maps keep their nodes.
+    struct Pvt_Output_Data;
+    std::shared_ptr<Pvt_Output_Data> get_output_data();
+    void recycle_output_data(const std::shared_ptr<Pvt_Output_Data>& output_data);
+
     std::map<int, Gnss_Synchro> interpolate_observables(const std::map<int, Gnss_Synchro>& observables_map_t0,
         const std::map<int, Gnss_Synchro>& observables_map_t1,
         double rx_time_s);
@@ -188,6 +227,15 @@ private:
     std::unique_ptr<Has_Simple_Printer> d_has_simple_printer;
     std::unique_ptr<An_Packet_Printer> d_an_printer;
 
+    // the printers are used through the output queue, which feeds them from
+    // snapshots of the user solver when it runs in its own thread. The
+    // navigation data of the snapshots is copied only when it changes.
+    std::unique_ptr<Pvt_Output_Queue> d_output_queue;
+    std::vector<std::shared_ptr<Pvt_Output_Data>> d_output_data_pool;
+    std::mutex d_output_data_pool_mutex;
+    std::shared_ptr<const Rtklib_Navigation_Data> d_output_nav_data;
+    std::atomic<bool> d_output_nav_data_changed{true};
+
     std::chrono::time_point<std::chrono::system_clock> d_start;
     std::chrono::time_point<std::chrono::system_clock> d_end;
 
@@ -198,6 +246,7 @@ private:
     std::vector<bool> d_channel_initialized;
     std::vector<double> d_initial_carrier_phase_offset_estimation_rads;
 
+    Pvt_Observable_Filter d_observable_filter;  // ephemeris availability and health, indexed by PRN
     std::map<int, Gnss_Synchro> d_gnss_observables_map;
     std::map<int, Gnss_Synchro> d_gnss_observables_map_t0;
     std::map<int, Gnss_Synchro> d_gnss_observables_map_t1;
@@ -34,7 +34,7 @@
 /** \addtogroup PVT_libs
  * \{ */
 
-class Rtklib_Solver;
+class Pvt_Solution;
 
 struct sdr_gnss_packet_t
 {
@@ -86,7 +86,7 @@ public:
     /*!
      * \brief Print AN packet to the initialized device.
      */
-    bool print_packet(const Rtklib_Solver* const pvt_data, const std::map<int, Gnss_Synchro>& gnss_observables_map);
+    bool print_packet(const Pvt_Solution* const pvt_data, const std::map<int, Gnss_Synchro>& gnss_observables_map);
 
     /*!
      * \brief Close serial port. Also done in the destructor, this is only
@@ -112,7 +112,7 @@ private:
     const uint8_t SDR_GNSS_PACKET_ID = 201;
 
     int init_serial(const std::string& serial_device);
-    void update_sdr_gnss_packet(sdr_gnss_packet_t* _packet, const Rtklib_Solver* const pvt, const std::map<int, Gnss_Synchro>& gnss_observables_map) const;
+    void update_sdr_gnss_packet(sdr_gnss_packet_t* _packet, const Pvt_Solution* const pvt, const std::map<int, Gnss_Synchro>& gnss_observables_map) const;
     void encode_gnss_cttc_packet(sdr_gnss_packet_t* sdr_gnss_packet, an_packet_t* _packet) const;
     uint16_t calculate_crc16(const void* data, uint16_t length) const;
     uint8_t calculate_header_lrc(const uint8_t* data) const;
@@ -17,60 +17,33 @@
 
 #include "monitor_pvt_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
-#include <iostream>
-#include <sstream>
+#include <ostream>
+#include <utility>
 
 
 Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses,
     const uint16_t& port,
-    bool protobuf_enabled) : socket{io_context},
-                             use_protobuf(protobuf_enabled)
+    bool protobuf_enabled,
+    size_t queue_size) : sender(addresses, port, queue_size),
+                         use_protobuf(protobuf_enabled)
 {
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
-
-    if (use_protobuf)
-        {
-            serdes = Serdes_Monitor_Pvt();
-        }
 }
 
 
 bool Monitor_Pvt_Udp_Sink::write_monitor_pvt(const Monitor_Pvt* const monitor_pvt)
 {
-    std::string outbound_data;
+    std::string outbound_data = sender.get_buffer();
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
+            String_Append_Streambuf archive_buffer(outbound_data);
+            std::ostream archive_stream(&archive_buffer);
             boost::archive::binary_oarchive oa{archive_stream};
             oa << *monitor_pvt;
-            outbound_data = archive_stream.str();
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(monitor_pvt);
-        }
-
-    try
-        {
-            for (const auto& endpoint : endpoints)
-                {
-                    socket.open(endpoint.protocol(), error);  // NOLINT(bugprone-unused-return-value)
-
-                    if (socket.send_to(boost::asio::buffer(outbound_data), endpoint) == 0)  // this can throw
-                        {
-                            return false;
-                        }
-                }
-        }
-    catch (boost::system::system_error const& e)
-        {
-            std::cerr << "Error sending PVT data: " << e.what() << '\n';
-            return false;
+            serdes.appendProtobuffer(monitor_pvt, outbound_data);
         }
 
-    return true;
+    return sender.send(std::move(outbound_data));
 }
@@ -107,6 +107,7 @@ Nmea_Printer::Nmea_Printer(const std::string& filename,
         }
 
     d_PVT_data = nullptr;
+    d_ssat = std::vector<ssat_t>(MAXSAT, ssat_t{});
 }
 
 
@@ -195,10 +196,23 @@ void Nmea_Printer::close_serial() const
 }
 
 
-bool Nmea_Printer::Print_Nmea_Line(const Rtklib_Solver* const pvt_data)
+bool Nmea_Printer::Print_Nmea_Line(const Rtklib_Solver_Snapshot* const pvt_data)
 {
     // set the new PVT data
     d_PVT_data = pvt_data;
+    for (auto& ssat : d_ssat)
+        {
+            ssat.vs = 0;
+        }
+    for (int i = 0; i < pvt_data->num_sats_in_view; i++)
+        {
+            const Rtklib_Solver_Snapshot::Sat_In_View& sat_in_view = pvt_data->sats_in_view[i];
+            ssat_t& ssat = d_ssat[sat_in_view.sat - 1];
+            ssat.vs = 1;
+            ssat.azel[0] = sat_in_view.azel[0];
+            ssat.azel[1] = sat_in_view.azel[1];
+            ssat.snr[0] = sat_in_view.snr;
+        }
 
     // generate the NMEA sentences
 
@@ -410,7 +424,7 @@ std::string Nmea_Printer::get_GPGSA() const
     // GSA-GNSS DOP and Active Satellites
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gsa(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
+    outnmea_gsa(buff.data(), &d_PVT_data->pvt_sol, d_ssat.data());
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -423,7 +437,7 @@ std::string Nmea_Printer::get_GPGSV() const
     // Notice that NMEA 2.1 only supports 12 channels
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gsv(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
+    outnmea_gsv(buff.data(), &d_PVT_data->pvt_sol, d_ssat.data());
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -22,10 +22,12 @@
 #ifndef GNSS_SDR_NMEA_PRINTER_H
 #define GNSS_SDR_NMEA_PRINTER_H
 
+#include "rtklib.h"                              // for ssat_t
 #include <boost/date_time/posix_time/ptime.hpp>  // for ptime
 #include <fstream>                               // for ofstream
 #include <memory>                                // for shared_ptr
 #include <string>                                // for string
+#include <vector>                                // for vector
 
 /** \addtogroup PVT
  * \{ */
@@ -33,7 +35,7 @@
  * \{ */
 
 
-class Rtklib_Solver;
+class Rtklib_Solver_Snapshot;
 
 /*!
  * \brief This class provides a implementation of a subset of the NMEA-0183 standard for interfacing
@@ -57,7 +59,7 @@ public:
     /*!
      * \brief Print NMEA PVT and satellite info to the initialized device
      */
-    bool Print_Nmea_Line(const Rtklib_Solver* const pvt_data);
+    bool Print_Nmea_Line(const Rtklib_Solver_Snapshot* const pvt_data);
 
 private:
     int init_serial(const std::string& serial_device);  // serial port control
@@ -71,7 +73,8 @@ private:
     std::string latitude_to_hm(double lat) const;
     char checkSum(const std::string& sentence) const;
 
-    const Rtklib_Solver* d_PVT_data;
+    const Rtklib_Solver_Snapshot* d_PVT_data;
+    std::vector<ssat_t> d_ssat;  // status of all the satellites, as expected by the RTKLIB NMEA functions
 
     std::ofstream nmea_file_descriptor;  // Output file stream for NMEA log file
 
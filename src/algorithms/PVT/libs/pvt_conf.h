@@ -53,6 +53,8 @@ public:
 
     uint32_t type_of_receiver = 0;
     uint32_t observable_interval_ms = 20;
+    uint32_t output_queue_size = 0;
+    uint32_t udp_queue_size = 0;
 
     int32_t output_rate_ms = 0;
     int32_t display_rate_ms = 0;
@@ -95,6 +97,7 @@ public:
     bool use_e6_for_pvt = true;
     bool use_has_corrections = true;
     bool use_unhealthy_sats = false;
+    bool output_queue_drop = false;
 
     // PVT KF parameters
     bool enable_pvt_kf = false;
@@ -34,53 +34,49 @@ void Pvt_Kf::init_Kf(const arma::vec& p,
     // Kalman Filter class variables
     const double Ti = update_interval_s;
 
-    d_F = {{1.0, 0.0, 0.0, Ti, 0.0, 0.0},
-        {0.0, 1.0, 0.0, 0.0, Ti, 0.0},
-        {0.0, 0.0, 1.0, 0.0, 0.0, Ti},
-        {0.0, 0.0, 0.0, 1.0, 0.0, 0.0},
-        {0.0, 0.0, 0.0, 0.0, 1.0, 0.0},
-        {0.0, 0.0, 0.0, 0.0, 0.0, 1.0}};
-
-    d_H = arma::eye(6, 6);
+    d_kf.F = {{{{1.0, 0.0, 0.0, Ti, 0.0, 0.0}},
+        {{0.0, 1.0, 0.0, 0.0, Ti, 0.0}},
+        {{0.0, 0.0, 1.0, 0.0, 0.0, Ti}},
+        {{0.0, 0.0, 0.0, 1.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, 1.0, 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, 0.0, 1.0}}}};
+
+    for (int i = 0; i < 6; i++)
+        {
+            d_kf.H[i] = {};
+            d_kf.H[i][i] = 1.0;
+        }
 
     // measurement matrix static covariances
-    d_R = {{pow(measures_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0, 0.0},
-        {0.0, pow(measures_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0},
-        {0.0, 0.0, pow(measures_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0},
-        {0.0, 0.0, 0.0, pow(measures_ecef_vel_sd_ms, 2.0), 0.0, 0.0},
-        {0.0, 0.0, 0.0, 0.0, pow(measures_ecef_vel_sd_ms, 2.0), 0.0},
-        {0.0, 0.0, 0.0, 0.0, 0.0, pow(measures_ecef_vel_sd_ms, 2.0)}};
+    d_kf.R = {{{{pow(measures_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, pow(measures_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, pow(measures_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0, pow(measures_ecef_vel_sd_ms, 2.0), 0.0, 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, pow(measures_ecef_vel_sd_ms, 2.0), 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, 0.0, pow(measures_ecef_vel_sd_ms, 2.0)}}}};
 
     // system covariance matrix (static)
-    d_Q = {{pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0, 0.0},
-        {0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0},
-        {0.0, 0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0},
-        {0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0, 0.0},
-        {0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0},
-        {0.0, 0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0)}};
+    d_kf.Q = {{{{pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0, 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0)}}}};
 
     // initial Kalman covariance matrix
-    d_P_old_old = {{pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0, 0.0},
-        {0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0},
-        {0.0, 0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0},
-        {0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0, 0.0},
-        {0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0},
-        {0.0, 0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0)}};
+    d_kf.P = {{{{pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, pow(system_ecef_pos_sd_m, 2.0), 0.0, 0.0, 0.0}},
+        {{0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0, 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0), 0.0}},
+        {{0.0, 0.0, 0.0, 0.0, 0.0, pow(system_ecef_vel_sd_ms, 2.0)}}}};
 
     // states: position ecef [m], velocity ecef [m/s]
-    d_x_old_old = arma::zeros(6);
-    d_x_old_old.subvec(0, 2) = p;
-    d_x_old_old.subvec(3, 5) = v;
+    d_kf.x = {{p(0), p(1), p(2), v(0), v(1), v(2)}};
 
     d_initialized = true;
 
     DLOG(INFO) << "Ti: " << Ti;
-    DLOG(INFO) << "F: " << d_F;
-    DLOG(INFO) << "H: " << d_H;
-    DLOG(INFO) << "R: " << d_R;
-    DLOG(INFO) << "Q: " << d_Q;
-    DLOG(INFO) << "P: " << d_P_old_old;
-    DLOG(INFO) << "x: " << d_x_old_old;
 }
 
 
@@ -102,25 +98,11 @@ void Pvt_Kf::run_Kf(const arma::vec& p, const arma::vec& v)
         {
             // Kalman loop
             // Prediction
-            d_x_new_old = d_F * d_x_old_old;
-            d_P_new_old = d_F * d_P_old_old * d_F.t() + d_Q;
+            d_kf.predict();
 
             // Measurement update
-            try
-                {
-                    arma::vec z = arma::join_cols(p, v);
-                    arma::mat K = d_P_new_old * d_H.t() * arma::inv(d_H * d_P_new_old * d_H.t() + d_R);  // Kalman gain
-
-                    d_x_new_new = d_x_new_old + K * (z - d_H * d_x_new_old);
-                    d_P_new_new = (arma::eye(6, 6) - K * d_H) * d_P_new_old;
-
-                    // prepare data for next KF epoch
-                    d_x_old_old = d_x_new_new;
-                    d_P_old_old = d_P_new_new;
-                }
-            catch (...)
+            if (!d_kf.update({{p(0), p(1), p(2), v(0), v(1), v(2)}}))
                 {
-                    d_x_new_new = d_x_new_old;
                     this->reset_Kf();
                 }
         }
@@ -131,7 +113,7 @@ void Pvt_Kf::get_pv_Kf(arma::vec& p, arma::vec& v) const
 {
     if (d_initialized)
         {
-            p = d_x_new_new.subvec(0, 2);
-            v = d_x_new_new.subvec(3, 5);
+            p = {d_kf.x[0], d_kf.x[1], d_kf.x[2]};
+            v = {d_kf.x[3], d_kf.x[4], d_kf.x[5]};
         }
 }
@@ -18,6 +18,7 @@
 #ifndef GNSS_SDR_PVT_KF_H
 #define GNSS_SDR_PVT_KF_H
 
+#include "fixed_kalman_filter.h"
 #include <armadillo>
 
 /** \addtogroup PVT
@@ -48,17 +49,8 @@ public:
     void reset_Kf();
 
 private:
-    // Kalman Filter class variables
-    arma::mat d_F;
-    arma::mat d_H;
-    arma::mat d_R;
-    arma::mat d_Q;
-    arma::mat d_P_old_old;
-    arma::mat d_P_new_old;
-    arma::mat d_P_new_new;
-    arma::vec d_x_old_old;
-    arma::vec d_x_new_old;
-    arma::vec d_x_new_new;
+    // Kalman Filter: state {position ecef [m], velocity ecef [m/s]}
+    Fixed_Kalman_Filter<6, 6> d_kf;
     bool d_initialized{false};
 };
 
@@ -0,0 +1,140 @@
+/*!
+ * \file pvt_observable_filter.cc
+ * \brief Implementation of a class that selects the observables usable by the
+ * PVT solver, based on flat PRN-indexed tables of ephemeris availability and
+ * satellite health.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_observable_filter.h"
+#include "beidou_dnav_ephemeris.h"
+#include "galileo_ephemeris.h"
+#include "glonass_gnav_ephemeris.h"
+#include "gnss_synchro_epoch.h"
+#include "gps_cnav_ephemeris.h"
+#include "gps_ephemeris.h"
+
+
+Pvt_Observable_Filter::Pvt_Observable_Filter(bool use_unhealthy_sats)
+    : d_use_unhealthy_sats(use_unhealthy_sats)
+{
+}
+
+
+void Pvt_Observable_Filter::update(const Gps_Ephemeris& eph)
+{
+    if (eph.PRN < MAX_PRN)
+        {
+            d_gps[eph.PRN] = (d_use_unhealthy_sats || eph.SV_health == 0) ? USABLE : 0;
+        }
+}
+
+
+void Pvt_Observable_Filter::update(const Gps_CNAV_Ephemeris& eph)
+{
+    if (eph.PRN < MAX_PRN)
+        {
+            d_gps_cnav[eph.PRN] = USABLE;
+        }
+}
+
+
+void Pvt_Observable_Filter::update(const Galileo_Ephemeris& eph)
+{
+    if (eph.PRN < MAX_PRN)
+        {
+            uint8_t flags = 0;
+            if (d_use_unhealthy_sats || ((eph.E1B_DVS == false) && (eph.E1B_HS == 0)))
+                {
+                    flags |= USABLE;
+                }
+            if (d_use_unhealthy_sats || ((eph.E5a_DVS == false) && (eph.E5a_HS == 0)))
+                {
+                    flags |= USABLE_E5A;
+                }
+            if (d_use_unhealthy_sats || ((eph.E5b_DVS == false) && (eph.E5b_HS == 0)))
+                {
+                    flags |= USABLE_E5B;
+                }
+            d_galileo[eph.PRN] = flags;
+        }
+}
+
+
+void Pvt_Observable_Filter::update(const Glonass_Gnav_Ephemeris& eph)
+{
+    if (eph.PRN < MAX_PRN)
+        {
+            d_glonass[eph.PRN] = USABLE;
+        }
+}
+
+
+void Pvt_Observable_Filter::update(const Beidou_Dnav_Ephemeris& eph)
+{
+    if (eph.PRN < MAX_PRN)
+        {
+            d_beidou[eph.PRN] = (d_use_unhealthy_sats || eph.SV_health == 0) ? USABLE : 0;
+        }
+}
+
+
+void Pvt_Observable_Filter::clear_gps()
+{
+    d_gps.fill(0);
+}
+
+
+void Pvt_Observable_Filter::clear_galileo()
+{
+    d_galileo.fill(0);
+}
+
+
+void Pvt_Observable_Filter::clear_beidou()
+{
+    d_beidou.fill(0);
+}
+
+
+void Pvt_Observable_Filter::clear()
+{
+    d_gps.fill(0);
+    d_gps_cnav.fill(0);
+    d_galileo.fill(0);
+    d_glonass.fill(0);
+    d_beidou.fill(0);
+}
+
+
+void Pvt_Observable_Filter::select(const Gnss_Synchro_Epoch& epoch, std::map<int, Gnss_Synchro>& observables_map) const
+{
+    auto observables_iter = observables_map.begin();
+    for (uint32_t i = 0; i < epoch.size(); i++)
+        {
+            const auto channel = static_cast<int>(i);
+            while (observables_iter != observables_map.end() && observables_iter->first < channel)
+                {
+                    observables_iter = observables_map.erase(observables_iter);
+                }
+            if (epoch.valid_pseudorange(i) && accept(epoch.PRN[i], epoch.Signal[i].data()))
+                {
+                    if (observables_iter == observables_map.end() || observables_iter->first != channel)
+                        {
+                            observables_iter = observables_map.emplace_hint(observables_iter, channel, Gnss_Synchro());
+                        }
+                    epoch.get(i, observables_iter->second);
+                    ++observables_iter;
+                }
+        }
+    observables_map.erase(observables_iter, observables_map.end());
+}
@@ -0,0 +1,209 @@
+/*!
+ * \file pvt_observable_filter.h
+ * \brief Interface of a class that selects the observables usable by the PVT
+ * solver, based on flat PRN-indexed tables of ephemeris availability and
+ * satellite health.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_OBSERVABLE_FILTER_H
+#define GNSS_SDR_PVT_OBSERVABLE_FILTER_H
+
+#include "gnss_synchro.h"
+#include <array>
+#include <cstdint>
+#include <map>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+class Beidou_Dnav_Ephemeris;
+class Galileo_Ephemeris;
+class Glonass_Gnav_Ephemeris;
+class Gnss_Synchro_Epoch;
+class Gps_CNAV_Ephemeris;
+class Gps_Ephemeris;
+
+/*!
+ * \brief Signals accepted by the PVT solver
+ */
+enum class Pvt_Signal : uint8_t
+{
+    UNKNOWN = 0,
+    GPS_1C,
+    GPS_2S,
+    GPS_L5,
+    GAL_1B,
+    GAL_5X,
+    GAL_7X,
+    GAL_E6,
+    GLO_1G,
+    GLO_2G,
+    BDS_B1,
+    BDS_B3
+};
+
+
+/*!
+ * \brief Returns the Pvt_Signal of a two-character signal code (e.g. "1C")
+ */
+inline Pvt_Signal pvt_signal(const char* signal)
+{
+    switch (signal[0])
+        {
+        case '1':
+            switch (signal[1])
+                {
+                case 'C':
+                    return Pvt_Signal::GPS_1C;
+                case 'B':
+                    return Pvt_Signal::GAL_1B;
+                case 'G':
+                    return Pvt_Signal::GLO_1G;
+                default:
+                    return Pvt_Signal::UNKNOWN;
+                }
+        case '2':
+            switch (signal[1])
+                {
+                case 'S':
+                    return Pvt_Signal::GPS_2S;
+                case 'G':
+                    return Pvt_Signal::GLO_2G;
+                default:
+                    return Pvt_Signal::UNKNOWN;
+                }
+        case '5':
+            return signal[1] == 'X' ? Pvt_Signal::GAL_5X : Pvt_Signal::UNKNOWN;
+        case '7':
+            return signal[1] == 'X' ? Pvt_Signal::GAL_7X : Pvt_Signal::UNKNOWN;
+        case 'E':
+            return signal[1] == '6' ? Pvt_Signal::GAL_E6 : Pvt_Signal::UNKNOWN;
+        case 'L':
+            return signal[1] == '5' ? Pvt_Signal::GPS_L5 : Pvt_Signal::UNKNOWN;
+        case 'B':
+            switch (signal[1])
+                {
+                case '1':
+                    return Pvt_Signal::BDS_B1;
+                case '3':
+                    return Pvt_Signal::BDS_B3;
+                default:
+                    return Pvt_Signal::UNKNOWN;
+                }
+        default:
+            return Pvt_Signal::UNKNOWN;
+        }
+}
+
+
+/*!
+ * \brief Keeps, for each PRN, whether ephemeris data are available and the
+ * satellite is healthy, so that the observables of an epoch are accepted or
+ * rejected without searching the ephemeris maps.
+ *
+ * The tables must be updated each time an ephemeris is stored in, or cleared
+ * from, the ephemeris maps of the PVT solver.
+ */
+class Pvt_Observable_Filter
+{
+public:
+    static constexpr uint32_t MAX_PRN = 64;  // PRNs (or GLONASS slots) must be lower than this
+
+    explicit Pvt_Observable_Filter(bool use_unhealthy_sats = false);
+
+    void update(const Gps_Ephemeris& eph);
+    void update(const Gps_CNAV_Ephemeris& eph);
+    void update(const Galileo_Ephemeris& eph);
+    void update(const Glonass_Gnav_Ephemeris& eph);
+    void update(const Beidou_Dnav_Ephemeris& eph);
+
+    void clear_gps();
+    void clear_galileo();
+    void clear_beidou();
+    void clear();
+
+    /*!
+     * \brief Returns true if the PVT solver can use this observable
+     */
+    inline bool accept(const Gnss_Synchro& gs) const
+    {
+        return accept(gs.PRN, gs.Signal);
+    }
+
+    /*!
+     * \brief Returns true if the PVT solver can use an observable of this
+     * PRN and two-character signal code
+     */
+    inline bool accept(uint32_t prn, const char* signal_code) const
+    {
+        const auto signal = pvt_signal(signal_code);
+        if (signal == Pvt_Signal::GAL_E6)
+            {
+                return true;
+            }
+        if (prn >= MAX_PRN)
+            {
+                return false;
+            }
+        switch (signal)
+            {
+            case Pvt_Signal::GPS_1C:
+                return (d_gps[prn] & USABLE) != 0;
+            case Pvt_Signal::GPS_2S:
+            case Pvt_Signal::GPS_L5:
+                return (d_gps_cnav[prn] & USABLE) != 0;
+            case Pvt_Signal::GAL_1B:
+                return (d_galileo[prn] & USABLE) != 0;
+            case Pvt_Signal::GAL_5X:
+                return (d_galileo[prn] & USABLE_E5A) != 0;
+            case Pvt_Signal::GAL_7X:
+                return (d_galileo[prn] & USABLE_E5B) != 0;
+            case Pvt_Signal::GLO_1G:
+            case Pvt_Signal::GLO_2G:
+                return (d_glonass[prn] & USABLE) != 0;
+            case Pvt_Signal::BDS_B1:
+            case Pvt_Signal::BDS_B3:
+                return (d_beidou[prn] & USABLE) != 0;
+            default:
+                return false;
+            }
+    }
+
+    /*!
+     * \brief Refreshes observables_map, indexed by channel, with the
+     * observables of epoch that have a valid pseudorange and are accepted.
+     * The map nodes of the channels that stay in the map are reused, so no
+     * memory is allocated while the set of channels does not change.
+     */
+    void select(const Gnss_Synchro_Epoch& epoch, std::map<int, Gnss_Synchro>& observables_map) const;
+
+private:
+    // Bits of the tables. USABLE is the E1B signal for Galileo
+    static constexpr uint8_t USABLE = 0x01;
+    static constexpr uint8_t USABLE_E5A = 0x02;
+    static constexpr uint8_t USABLE_E5B = 0x04;
+
+    std::array<uint8_t, MAX_PRN> d_gps{};
+    std::array<uint8_t, MAX_PRN> d_gps_cnav{};
+    std::array<uint8_t, MAX_PRN> d_galileo{};
+    std::array<uint8_t, MAX_PRN> d_glonass{};
+    std::array<uint8_t, MAX_PRN> d_beidou{};
+    bool d_use_unhealthy_sats;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_OBSERVABLE_FILTER_H
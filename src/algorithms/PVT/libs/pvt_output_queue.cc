@@ -0,0 +1,156 @@
+/*!
+ * \file pvt_output_queue.cc
+ * \brief Bounded queue of output jobs of the PVT block, run by a writer
+ * thread.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_queue.h"
+#include <algorithm>  // for std::max
+#include <exception>
+#include <utility>  // for std::move
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+namespace
+{
+double elapsed_us(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+}  // namespace
+
+
+Pvt_Output_Queue::Pvt_Output_Queue(size_t capacity, bool drop_when_full)
+    : d_capacity(capacity),
+      d_drop_when_full(drop_when_full)
+{
+    if (d_capacity > 0)
+        {
+            d_writer = std::thread(&Pvt_Output_Queue::writer_loop, this);
+        }
+}
+
+
+Pvt_Output_Queue::~Pvt_Output_Queue()
+{
+    if (!d_writer.joinable())
+        {
+            return;
+        }
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopping = true;
+    }
+    d_not_empty.notify_all();
+    d_writer.join();
+
+    const Statistics stats = statistics();
+    LOG(INFO) << "PVT output queue: " << stats.jobs_executed << " jobs executed, "
+              << stats.jobs_dropped << " dropped, " << stats.jobs_blocked << " blocked (max. "
+              << stats.max_block_us << " us), max. depth " << stats.max_depth << " of " << d_capacity
+              << ", mean wait " << stats.mean_wait_us << " us, max. wait " << stats.max_wait_us
+              << " us, max. run time " << stats.max_run_us << " us";
+}
+
+
+bool Pvt_Output_Queue::threaded() const
+{
+    return d_capacity > 0;
+}
+
+
+bool Pvt_Output_Queue::submit(Job job, bool droppable)
+{
+    if (!threaded())
+        {
+            job();
+            return true;
+        }
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (d_jobs.size() >= d_capacity && droppable)
+        {
+            if (d_drop_when_full)
+                {
+                    if (d_stats.jobs_dropped == 0)
+                        {
+                            LOG(WARNING) << "PVT output queue is full (" << d_capacity << " jobs), discarding outputs";
+                        }
+                    d_stats.jobs_dropped++;
+                    return false;
+                }
+            const auto start = std::chrono::steady_clock::now();
+            d_not_full.wait(lock, [this] { return d_jobs.size() < d_capacity; });
+            d_stats.jobs_blocked++;
+            d_stats.max_block_us = std::max(d_stats.max_block_us, elapsed_us(start, std::chrono::steady_clock::now()));
+        }
+    d_jobs.push_back(Queued_Job{std::move(job), std::chrono::steady_clock::now()});
+    d_stats.max_depth = std::max(d_stats.max_depth, d_jobs.size());
+    lock.unlock();
+    d_not_empty.notify_one();
+    return true;
+}
+
+
+Pvt_Output_Queue::Statistics Pvt_Output_Queue::statistics() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    Statistics stats = d_stats;
+    stats.depth = d_jobs.size();
+    if (stats.jobs_executed > 0)
+        {
+            stats.mean_wait_us = d_total_wait_us / static_cast<double>(stats.jobs_executed);
+        }
+    return stats;
+}
+
+
+void Pvt_Output_Queue::writer_loop()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (true)
+        {
+            d_not_empty.wait(lock, [this] { return d_stopping || !d_jobs.empty(); });
+            if (d_jobs.empty())
+                {
+                    break;  // stopping, and all the jobs are done
+                }
+            Queued_Job queued_job = std::move(d_jobs.front());
+            d_jobs.pop_front();
+            lock.unlock();
+            d_not_full.notify_one();
+
+            const auto start = std::chrono::steady_clock::now();
+            try
+                {
+                    queued_job.job();
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "Exception in a PVT output job: " << e.what();
+                }
+            const auto end = std::chrono::steady_clock::now();
+
+            lock.lock();
+            const double wait_us = elapsed_us(queued_job.submitted, start);
+            d_stats.jobs_executed++;
+            d_total_wait_us += wait_us;
+            d_stats.max_wait_us = std::max(d_stats.max_wait_us, wait_us);
+            d_stats.max_run_us = std::max(d_stats.max_run_us, elapsed_us(start, end));
+        }
+}
@@ -0,0 +1,126 @@
+/*!
+ * \file pvt_output_queue.h
+ * \brief Bounded queue of output jobs of the PVT block, run by a writer
+ * thread.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_OUTPUT_QUEUE_H
+#define GNSS_SDR_PVT_OUTPUT_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Runs the output jobs of the PVT block (file printers, RTCM server,
+ * monitoring sinks) in a dedicated writer thread, so that a slow disk or
+ * network file system does not stall the signal processing chain.
+ *
+ * Jobs are executed in submission order. When the queue is full, submit()
+ * either waits for the writer to make room (block policy) or discards the
+ * job (drop policy). Jobs that must not be lost, such as the navigation data
+ * written to RINEX files, can be submitted as not droppable: they are then
+ * queued even if the queue is full.
+ *
+ * With a capacity of zero no thread is started, and submit() runs the jobs
+ * in the caller's thread.
+ */
+class Pvt_Output_Queue
+{
+public:
+    using Job = std::function<void()>;
+
+    /*!
+     * \brief Queue counters. Times are in microseconds.
+     */
+    struct Statistics
+    {
+        uint64_t jobs_executed{0};
+        uint64_t jobs_dropped{0};
+        uint64_t jobs_blocked{0};  // submissions that waited for room in the queue
+        size_t depth{0};
+        size_t max_depth{0};
+        double mean_wait_us{0.0};  // time between submission and execution
+        double max_wait_us{0.0};
+        double max_run_us{0.0};
+        double max_block_us{0.0};  // longest wait of a blocked submission
+    };
+
+    /*!
+     * \brief Starts the writer thread if capacity is not zero. If
+     * drop_when_full is true, the jobs submitted while the queue is full are
+     * discarded; otherwise, submit() waits for room.
+     */
+    Pvt_Output_Queue(size_t capacity, bool drop_when_full);
+
+    /*!
+     * \brief Runs the pending jobs and joins the writer thread.
+     */
+    ~Pvt_Output_Queue();
+
+    Pvt_Output_Queue(const Pvt_Output_Queue&) = delete;
+    Pvt_Output_Queue& operator=(const Pvt_Output_Queue&) = delete;
+
+    /*!
+     * \brief Returns true if the jobs are run by the writer thread, and thus
+     * they must not refer to data that the caller may modify later.
+     */
+    bool threaded() const;
+
+    /*!
+     * \brief Queues a job, or runs it immediately if the queue is not
+     * threaded. Returns false if the job was dropped.
+     */
+    bool submit(Job job, bool droppable = true);
+
+    /*!
+     * \brief Returns the counters of the queue since it was created.
+     */
+    Statistics statistics() const;
+
+private:
+    struct Queued_Job
+    {
+        Job job;
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    void writer_loop();
+
+    std::deque<Queued_Job> d_jobs;
+    std::thread d_writer;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_not_empty;
+    std::condition_variable d_not_full;
+    Statistics d_stats;
+    double d_total_wait_us{0.0};
+    size_t d_capacity;
+    bool d_drop_when_full;
+    bool d_stopping{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_OUTPUT_QUEUE_H
@@ -39,6 +39,7 @@
 #define GNSS_SDR_RINEX_PRINTER_H
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <cstddef>        // for size_t
 #include <cstdint>        // for int32_t
 #include <cstdlib>        // for strtol, strtod
 #include <fstream>        // for fstream
@@ -73,7 +74,7 @@ class Gps_Ephemeris;
 class Gps_Iono;
 class Gps_Navigation_Message;
 class Gps_Utc_Model;
-class Rtklib_Solver;
+class Rtklib_Navigation_Data;
 
 
 /*!
@@ -167,7 +168,7 @@ public:
      *    1001  |  GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
      *
      */
-    void print_rinex_annotation(const Rtklib_Solver* pvt_solver,
+    void print_rinex_annotation(const Rtklib_Navigation_Data* pvt_solver,
         const std::map<int, Gnss_Synchro>& gnss_observables_map,
         double rx_time,
         int type_of_rx,
@@ -786,6 +787,19 @@ private:
     void update_obs_header(std::fstream& out,
         const Beidou_Dnav_Utc_Model& utc_model) const;
 
+    /*
+     * Reads the header of a RINEX file, up to and including the END OF HEADER line
+     */
+    std::string read_rinex_header(std::fstream& out, const std::string& filename) const;
+
+    /*
+     * Writes an updated header into a RINEX file. If it has the same size as
+     * the former one, it is patched in place and the records are not rewritten.
+     */
+    void overwrite_rinex_header(const std::string& filename,
+        std::size_t old_header_size,
+        const std::vector<std::string>& header) const;
+
     /*
      * Generation of RINEX signal strength indicators
      */
@@ -997,6 +1011,8 @@ private:
     std::map<std::string, std::string> observationType;  // PSEUDORANGE, CARRIER_PHASE, DOPPLER, SIGNAL_STRENGTH
     std::map<std::string, std::string> observationCode;  // GNSS observation descriptors
 
+    std::vector<char> d_obs_buffer;  // Stream buffer of the RINEX observation file
+
     std::fstream obsFile;     // Output file stream for RINEX observation file
     std::fstream navFile;     // Output file stream for RINEX navigation data file
     std::fstream sbsFile;     // Output file stream for RINEX SBAS raw data file
@@ -1017,6 +1033,7 @@ private:
     std::string d_stringVersion;  // RINEX version (2.10/2.11 or 3.01/3.02)
 
     double d_fake_cnav_iode;
+    double d_last_obs_flush_time;   // Receiver time of the last flush of the RINEX observation file
     int d_version;                  // RINEX version (2 for 2.10/2.11 and 3 for 3.01)
     int d_numberTypesObservations;  // Number of available types of observable in the system. Should be public?
     bool d_rinex_header_updated;
@@ -23,8 +23,8 @@
 #include "Galileo_E5b.h"
 #include "Galileo_FNAV.h"
 #include "Galileo_INAV.h"
+#include "crc24q.h"
 #include <boost/algorithm/string.hpp>  // for to_upper_copy
-#include <boost/crc.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/exception/diagnostic_information.hpp>
@@ -36,8 +36,6 @@
 
 Rtcm::Rtcm(uint16_t port) : RTCM_port(port), server_is_running(false)
 {
-    preamble = std::bitset<8>("11010011");
-    reserved_field = std::bitset<6>("000000");
     rtcm_message_queue = std::make_shared<Concurrent_Queue<std::string>>();
     boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), RTCM_port);
     servers.emplace_back(io_context, endpoint);
@@ -122,49 +120,19 @@ bool Rtcm::is_server_running() const
 //
 // *****************************************************************************************************
 
-std::string Rtcm::add_CRC(const std::string& message_without_crc) const
-{
-    // ******  Computes Qualcomm CRC-24Q ******
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM;
-    // 1) Converts the string to a vector of uint8_t:
-    boost::dynamic_bitset<uint8_t> frame_bits(message_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    // 2) Computes CRC
-    CRC_RTCM.process_bytes(bytes.data(), bytes.size());
-    const auto crc_frame = std::bitset<24>(CRC_RTCM.checksum());
-
-    // 3) Builds the complete message
-    const std::string complete_message = message_without_crc + crc_frame.to_string();
-    return bin_to_binary_data(complete_message);
-}
-
-
 bool Rtcm::check_CRC(const std::string& message) const
 {
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM_CHECK;
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
-    // Check CRC
-    const std::string crc = message_bin.substr(message_bin.length() - 24, 24);
-    const auto read_crc = std::bitset<24>(crc);
-    const std::string msg_without_crc = message_bin.substr(0, message_bin.length() - 24);
-
-    boost::dynamic_bitset<uint8_t> frame_bits(msg_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_RTCM_CHECK.process_bytes(bytes.data(), bytes.size());
-    const auto computed_crc = std::bitset<24>(CRC_RTCM_CHECK.checksum());
-    if (read_crc == computed_crc)
+    if (message.length() < 3)
         {
-            return true;
+            return false;
         }
-
-    return false;
+    // Qualcomm CRC-24Q over the binary data, except the last 3 bytes
+    const auto* bytes = reinterpret_cast<const uint8_t*>(message.data());
+    const std::size_t msg_length_bytes = message.length() - 3;
+    const uint32_t read_crc = (static_cast<uint32_t>(bytes[msg_length_bytes]) << 16) |
+                              (static_cast<uint32_t>(bytes[msg_length_bytes + 1]) << 8) |
+                              static_cast<uint32_t>(bytes[msg_length_bytes + 2]);
+    return read_crc == Crc24q::checksum(bytes, msg_length_bytes);
 }
 
 
@@ -396,19 +364,11 @@ int64_t Rtcm::hex_to_int(const std::string& s) const
 }
 
 
-std::string Rtcm::build_message(const std::string& data) const
+std::string Rtcm::build_message(const std::string& data)
 {
-    const uint32_t msg_length_bits = data.length();
-    const uint32_t msg_length_bytes = std::ceil(static_cast<float>(msg_length_bits) / 8.0);
-    const auto message_length = std::bitset<10>(msg_length_bytes);
-    const uint32_t zeros_to_fill = 8 * msg_length_bytes - msg_length_bits;
-    const std::string b(zeros_to_fill, '0');
-    const std::string msg_content = data + b;
-    const std::string msg_without_crc = preamble.to_string() +
-                                        reserved_field.to_string() +
-                                        message_length.to_string() +
-                                        msg_content;
-    return Rtcm::add_CRC(msg_without_crc);
+    bit_writer.clear();
+    bit_writer.append(data);
+    return bit_writer.frame();
 }
 
 
@@ -2288,7 +2248,9 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
             msg_number = 1071;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    bit_writer.clear();
+
+    Rtcm::write_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2298,11 +2260,11 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::write_MSM_1_content_sat_data(observables);
 
-    const std::string signal_data = Rtcm::get_MSM_1_content_signal_data(observables);
+    Rtcm::write_MSM_1_content_signal_data(observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = bit_writer.frame();
 
     if (server_is_running)
         {
@@ -2313,7 +2275,7 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_header(uint32_t msg_number,
+void Rtcm::write_MSM_header(uint32_t msg_number,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id,
@@ -2340,40 +2302,37 @@ std::string Rtcm::get_MSM_header(uint32_t msg_number,
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
 
-    std::string header = DF002.to_string() + DF003.to_string();
+    bit_writer.append(DF002);
+    bit_writer.append(DF003);
     // GNSS Epoch Time Specific to each constellation
     if ((sys == "R"))
         {
             // GLONASS Epoch Time
             Rtcm::set_DF034(obs_time);
-            header += DF034.to_string();
+            bit_writer.append(DF034);
         }
     else
         {
             // GPS, Galileo Epoch Time
             Rtcm::set_DF004(obs_time);
-            header += DF004.to_string();
+            bit_writer.append(DF004);
         }
 
-    header = header + DF393.to_string() +
-             DF409.to_string() +
-             DF001_.to_string() +
-             DF411.to_string() +
-             DF417.to_string() +
-             DF412.to_string() +
-             DF418.to_string() +
-             DF394.to_string() +
-             DF395.to_string() +
-             Rtcm::set_DF396(observables);
-
-    return header;
+    bit_writer.append(DF393);
+    bit_writer.append(DF409);
+    bit_writer.append(DF001_);
+    bit_writer.append(DF411);
+    bit_writer.append(DF417);
+    bit_writer.append(DF412);
+    bit_writer.append(DF418);
+    bit_writer.append(DF394);
+    bit_writer.append(DF395);
+    bit_writer.append(Rtcm::set_DF396(observables));
 }
 
 
-std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
     const uint32_t numobs = observables.size();
@@ -2400,19 +2359,18 @@ std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchr
 
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(observables_vector);
 
+    const std::size_t first_field = bit_writer.skip(num_satellites * DF398.size());
+
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            sat_data += DF398.to_string();
+            bit_writer.write(first_field + nsat * DF398.size(), DF398);
         }
-
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -2430,13 +2388,13 @@ std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Syn
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    const std::size_t first_field = bit_writer.skip(Ncells * DF400.size());
+
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
-            signal_data += DF400.to_string();
+            bit_writer.write(first_field + cell * DF400.size(), DF400);
         }
-
-    return signal_data;
 }
 
 
@@ -2486,7 +2444,9 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
             msg_number = 1072;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    bit_writer.clear();
+
+    Rtcm::write_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2496,11 +2456,11 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::write_MSM_1_content_sat_data(observables);
 
-    const std::string signal_data = Rtcm::get_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = bit_writer.frame();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2510,18 +2470,13 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -2539,18 +2494,20 @@ std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field is written for all the cells before the next one
+    const std::size_t first_field = bit_writer.skip(Ncells * (DF401.size() + DF402.size() + DF420.size()));
+    const std::size_t second_field = first_field + Ncells * DF401.size();
+    const std::size_t third_field = second_field + Ncells * DF402.size();
+
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF401.to_string();
-            second_data_type += DF402.to_string();
-            third_data_type += DF420.to_string();
+            bit_writer.write(first_field + cell * DF401.size(), DF401);
+            bit_writer.write(second_field + cell * DF402.size(), DF402);
+            bit_writer.write(third_field + cell * DF420.size(), DF420);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type;
-    return signal_data;
 }
 
 
@@ -2600,7 +2557,9 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
             msg_number = 1073;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    bit_writer.clear();
+
+    Rtcm::write_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2610,11 +2569,11 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::write_MSM_1_content_sat_data(observables);
 
-    const std::string signal_data = Rtcm::get_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = bit_writer.frame();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2624,19 +2583,13 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -2654,20 +2607,23 @@ std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field is written for all the cells before the next one
+    const std::size_t first_field = bit_writer.skip(Ncells * (DF400.size() + DF401.size() + DF402.size() + DF420.size()));
+    const std::size_t second_field = first_field + Ncells * DF400.size();
+    const std::size_t third_field = second_field + Ncells * DF401.size();
+    const std::size_t fourth_field = third_field + Ncells * DF402.size();
+
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
+            bit_writer.write(first_field + cell * DF400.size(), DF400);
+            bit_writer.write(second_field + cell * DF401.size(), DF401);
+            bit_writer.write(third_field + cell * DF402.size(), DF402);
+            bit_writer.write(fourth_field + cell * DF420.size(), DF420);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return signal_data;
 }
 
 
@@ -2717,7 +2673,9 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
             msg_number = 1074;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    bit_writer.clear();
+
+    Rtcm::write_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2727,11 +2685,11 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::write_MSM_4_content_sat_data(observables);
 
-    const std::string signal_data = Rtcm::get_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = bit_writer.frame();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2741,12 +2699,8 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
-
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
     const uint32_t numobs = observables.size();
@@ -2772,32 +2726,27 @@ std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchr
 
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(observables_vector);
 
+    // each data field is written for all the satellites before the next one
+    const std::size_t first_field = bit_writer.skip(num_satellites * (DF397.size() + DF398.size()));
+    const std::size_t second_field = first_field + num_satellites * DF397.size();
+
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF397(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            first_data_type += DF397.to_string();
-            second_data_type += DF398.to_string();
+            bit_writer.write(first_field + nsat * DF397.size(), DF397);
+            bit_writer.write(second_field + nsat * DF398.size(), DF398);
         }
-    sat_data = first_data_type + second_data_type;
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -2815,6 +2764,13 @@ std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field is written for all the cells before the next one
+    const std::size_t first_field = bit_writer.skip(Ncells * (DF400.size() + DF401.size() + DF402.size() + DF420.size() + DF403.size()));
+    const std::size_t second_field = first_field + Ncells * DF400.size();
+    const std::size_t third_field = second_field + Ncells * DF401.size();
+    const std::size_t fourth_field = third_field + Ncells * DF402.size();
+    const std::size_t fifth_field = fourth_field + Ncells * DF420.size();
+
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
@@ -2822,15 +2778,12 @@ std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
+            bit_writer.write(first_field + cell * DF400.size(), DF400);
+            bit_writer.write(second_field + cell * DF401.size(), DF401);
+            bit_writer.write(third_field + cell * DF402.size(), DF402);
+            bit_writer.write(fourth_field + cell * DF420.size(), DF420);
+            bit_writer.write(fifth_field + cell * DF403.size(), DF403);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
 }
 
 
@@ -2880,7 +2833,9 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
             msg_number = 1075;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    bit_writer.clear();
+
+    Rtcm::write_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2890,11 +2845,11 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::write_MSM_5_content_sat_data(observables);
 
-    const std::string signal_data = Rtcm::get_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = bit_writer.frame();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -2904,14 +2859,8 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
     const uint32_t numobs = observables.size();
@@ -2937,37 +2886,33 @@ std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchr
 
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(observables_vector);
 
+    const auto reserved = std::bitset<4>("0000");
+    // each data field is written for all the satellites before the next one
+    const std::size_t first_field = bit_writer.skip(num_satellites * (DF397.size() + reserved.size() + DF398.size() + DF399.size()));
+    const std::size_t second_field = first_field + num_satellites * DF397.size();
+    const std::size_t third_field = second_field + num_satellites * reserved.size();
+    const std::size_t fourth_field = third_field + num_satellites * DF398.size();
+
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF397(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF399(ordered_by_PRN_pos.at(nsat).second);
-            auto reserved = std::bitset<4>("0000");
-            first_data_type += DF397.to_string();
-            second_data_type += reserved.to_string();
-            third_data_type += DF398.to_string();
-            fourth_data_type += DF399.to_string();
+            bit_writer.write(first_field + nsat * DF397.size(), DF397);
+            bit_writer.write(second_field + nsat * reserved.size(), reserved);
+            bit_writer.write(third_field + nsat * DF398.size(), DF398);
+            bit_writer.write(fourth_field + nsat * DF399.size(), DF399);
         }
-    sat_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
-
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -2985,6 +2930,14 @@ std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field is written for all the cells before the next one
+    const std::size_t first_field = bit_writer.skip(Ncells * (DF400.size() + DF401.size() + DF402.size() + DF420.size() + DF403.size() + DF404.size()));
+    const std::size_t second_field = first_field + Ncells * DF400.size();
+    const std::size_t third_field = second_field + Ncells * DF401.size();
+    const std::size_t fourth_field = third_field + Ncells * DF402.size();
+    const std::size_t fifth_field = fourth_field + Ncells * DF420.size();
+    const std::size_t sixth_field = fifth_field + Ncells * DF403.size();
+
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
@@ -2993,16 +2946,13 @@ std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
-            sixth_data_type += DF404.to_string();
+            bit_writer.write(first_field + cell * DF400.size(), DF400);
+            bit_writer.write(second_field + cell * DF401.size(), DF401);
+            bit_writer.write(third_field + cell * DF402.size(), DF402);
+            bit_writer.write(fourth_field + cell * DF420.size(), DF420);
+            bit_writer.write(fifth_field + cell * DF403.size(), DF403);
+            bit_writer.write(sixth_field + cell * DF404.size(), DF404);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
 }
 
 
@@ -3052,7 +3002,9 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    bit_writer.clear();
+
+    Rtcm::write_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3062,11 +3014,11 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::write_MSM_4_content_sat_data(observables);
 
-    const std::string signal_data = Rtcm::get_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = bit_writer.frame();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3076,20 +3028,13 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -3107,6 +3052,13 @@ std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field is written for all the cells before the next one
+    const std::size_t first_field = bit_writer.skip(Ncells * (DF405.size() + DF406.size() + DF407.size() + DF420.size() + DF408.size()));
+    const std::size_t second_field = first_field + Ncells * DF405.size();
+    const std::size_t third_field = second_field + Ncells * DF406.size();
+    const std::size_t fourth_field = third_field + Ncells * DF407.size();
+    const std::size_t fifth_field = fourth_field + Ncells * DF420.size();
+
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF405(ordered_by_PRN_pos.at(cell).second);
@@ -3114,15 +3066,12 @@ std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF407(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
+            bit_writer.write(first_field + cell * DF405.size(), DF405);
+            bit_writer.write(second_field + cell * DF406.size(), DF406);
+            bit_writer.write(third_field + cell * DF407.size(), DF407);
+            bit_writer.write(fourth_field + cell * DF420.size(), DF420);
+            bit_writer.write(fifth_field + cell * DF408.size(), DF408);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
 }
 
 
@@ -3172,7 +3121,9 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    bit_writer.clear();
+
+    Rtcm::write_MSM_header(msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3182,11 +3133,11 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::write_MSM_5_content_sat_data(observables);
 
-    const std::string signal_data = Rtcm::get_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = bit_writer.frame();
     if (server_is_running)
         {
             rtcm_message_queue->push(message);
@@ -3196,21 +3147,13 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
 }
 
 
-std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
-
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -3228,6 +3171,14 @@ std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
     std::reverse(ordered_by_signal.begin(), ordered_by_signal.end());
     const std::vector<std::pair<int32_t, Gnss_Synchro>> ordered_by_PRN_pos = Rtcm::sort_by_PRN_mask(ordered_by_signal);
 
+    // each data field is written for all the cells before the next one
+    const std::size_t first_field = bit_writer.skip(Ncells * (DF405.size() + DF406.size() + DF407.size() + DF420.size() + DF408.size() + DF404.size()));
+    const std::size_t second_field = first_field + Ncells * DF405.size();
+    const std::size_t third_field = second_field + Ncells * DF406.size();
+    const std::size_t fourth_field = third_field + Ncells * DF407.size();
+    const std::size_t fifth_field = fourth_field + Ncells * DF420.size();
+    const std::size_t sixth_field = fifth_field + Ncells * DF408.size();
+
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF405(ordered_by_PRN_pos.at(cell).second);
@@ -3236,16 +3187,13 @@ std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
-            sixth_data_type += DF404.to_string();
+            bit_writer.write(first_field + cell * DF405.size(), DF405);
+            bit_writer.write(second_field + cell * DF406.size(), DF406);
+            bit_writer.write(third_field + cell * DF407.size(), DF407);
+            bit_writer.write(fourth_field + cell * DF420.size(), DF420);
+            bit_writer.write(fifth_field + cell * DF408.size(), DF408);
+            bit_writer.write(sixth_field + cell * DF404.size(), DF404);
         }
-
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
 }
 
 // SSR
@@ -4044,6 +3992,7 @@ boost::posix_time::ptime Rtcm::compute_GLONASS_time(const Glonass_Gnav_Ephemeris
 uint32_t Rtcm::lock_time(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     boost::posix_time::ptime current_time = Rtcm::compute_GPS_time(eph, obs_time);
+    std::lock_guard<std::mutex> lock(lock_time_mutex);
     boost::posix_time::ptime last_lock_time = Rtcm::gps_L1_last_lock_time[65 - gnss_synchro.PRN];
     if (last_lock_time.is_not_a_date_time())  // || CHECK LLI!!......)
         {
@@ -4060,6 +4009,7 @@ uint32_t Rtcm::lock_time(const Gps_Ephemeris& eph, double obs_time, const Gnss_S
 uint32_t Rtcm::lock_time(const Gps_CNAV_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     const boost::posix_time::ptime current_time = Rtcm::compute_GPS_time(eph, obs_time);
+    std::lock_guard<std::mutex> lock(lock_time_mutex);
     boost::posix_time::ptime last_lock_time = Rtcm::gps_L2_last_lock_time[65 - gnss_synchro.PRN];
     if (last_lock_time.is_not_a_date_time())  // || CHECK LLI!!......)
         {
@@ -4074,6 +4024,7 @@ uint32_t Rtcm::lock_time(const Gps_CNAV_Ephemeris& eph, double obs_time, const G
 uint32_t Rtcm::lock_time(const Galileo_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     const boost::posix_time::ptime current_time = Rtcm::compute_Galileo_time(eph, obs_time);
+    std::lock_guard<std::mutex> lock(lock_time_mutex);
 
     boost::posix_time::ptime last_lock_time;
     const std::string sig_(gnss_synchro.Signal);
@@ -4116,6 +4067,7 @@ uint32_t Rtcm::lock_time(const Galileo_Ephemeris& eph, double obs_time, const Gn
 uint32_t Rtcm::lock_time(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     const boost::posix_time::ptime current_time = Rtcm::compute_GLONASS_time(eph, obs_time);
+    std::lock_guard<std::mutex> lock(lock_time_mutex);
 
     boost::posix_time::ptime last_lock_time;
     const std::string sig_(gnss_synchro.Signal);
@@ -5753,7 +5705,6 @@ int32_t Rtcm::set_DF395(const std::map<int32_t, Gnss_Synchro>& gnss_synchro)
 
 std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string DF396;
     std::map<int32_t, Gnss_Synchro>::const_iterator observables_iter;
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
@@ -5765,11 +5716,14 @@ std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
             std::string s("");
             return s;
         }
-    std::vector<std::vector<bool>> matrix(num_signals, std::vector<bool>());
 
     std::string sig;
     std::vector<uint32_t> list_of_sats;
     std::vector<int> list_of_signals;
+    std::vector<int> signal_of_observable;  // 0 if the signal is not in the mask
+    list_of_sats.reserve(observables.size());
+    list_of_signals.reserve(observables.size());
+    signal_of_observable.reserve(observables.size());
 
     for (observables_iter = observables.cbegin();
          observables_iter != observables.cend();
@@ -5782,32 +5736,38 @@ std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
 
             const std::string sys(&observables_iter->second.System, 1);
 
+            int signal = 0;
             if ((sig == "1C") && (sys == "G"))
                 {
-                    list_of_signals.push_back(32 - 2);
+                    signal = 32 - 2;
                 }
             if ((sig == "2S") && (sys == "G"))
                 {
-                    list_of_signals.push_back(32 - 15);
+                    signal = 32 - 15;
                 }
 
             if ((sig == "5X") && (sys == "G"))
                 {
-                    list_of_signals.push_back(32 - 24);
+                    signal = 32 - 24;
                 }
             if ((sig == "1B") && (sys == "E"))
                 {
-                    list_of_signals.push_back(32 - 4);
+                    signal = 32 - 4;
                 }
 
             if ((sig == "5X") && (sys == "E"))
                 {
-                    list_of_signals.push_back(32 - 24);
+                    signal = 32 - 24;
                 }
             if ((sig == "7X") && (sys == "E"))
                 {
-                    list_of_signals.push_back(32 - 16);
+                    signal = 32 - 16;
                 }
+            if (signal != 0)
+                {
+                    list_of_signals.push_back(signal);
+                }
+            signal_of_observable.push_back(signal);
         }
 
     std::sort(list_of_sats.begin(), list_of_sats.end());
@@ -5817,72 +5777,25 @@ std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
     std::reverse(list_of_signals.begin(), list_of_signals.end());
     list_of_signals.erase(std::unique(list_of_signals.begin(), list_of_signals.end()), list_of_signals.end());
 
-    // fill the matrix
-    bool value;
-
+    // fill the matrix, written column-wise
+    std::string DF396(num_satellites * num_signals, '0');
     for (uint32_t row = 0; row < num_signals; row++)
         {
+            const int signal = list_of_signals.at(row);
             for (uint32_t sat = 0; sat < num_satellites; sat++)
                 {
-                    value = false;
+                    const uint32_t prn = list_of_sats.at(sat);
+                    std::size_t k = 0;
                     for (observables_iter = observables.cbegin();
                          observables_iter != observables.cend();
-                         observables_iter++)
+                         observables_iter++, k++)
                         {
-                            const std::string sig_(observables_iter->second.Signal);
-                            sig = sig_.substr(0, 2);
-                            const std::string sys(&observables_iter->second.System, 1);
-
-                            if ((sig == "1C") && (sys == "G") && (list_of_signals.at(row) == 32 - 2) && (observables_iter->second.PRN == list_of_sats.at(sat)))
-                                {
-                                    value = true;
-                                }
-
-                            if ((sig == "2S") && (sys == "G") && (list_of_signals.at(row) == 32 - 15) && (observables_iter->second.PRN == list_of_sats.at(sat)))
-                                {
-                                    value = true;
-                                }
-
-                            if ((sig == "5X") && (sys == "G") && (list_of_signals.at(row) == 32 - 24) && (observables_iter->second.PRN == list_of_sats.at(sat)))
+                            if ((signal_of_observable[k] == signal) && (observables_iter->second.PRN == prn))
                                 {
-                                    value = true;
+                                    DF396[sat * num_signals + row] = '1';
+                                    break;
                                 }
-
-                            if ((sig == "1B") && (sys == "E") && (list_of_signals.at(row) == 32 - 4) && (observables_iter->second.PRN == list_of_sats.at(sat)))
-                                {
-                                    value = true;
-                                }
-
-                            if ((sig == "5X") && (sys == "E") && (list_of_signals.at(row) == 32 - 24) && (observables_iter->second.PRN == list_of_sats.at(sat)))
-                                {
-                                    value = true;
-                                }
-
-                            if ((sig == "7X") && (sys == "E") && (list_of_signals.at(row) == 32 - 16) && (observables_iter->second.PRN == list_of_sats.at(sat)))
-                                {
-                                    value = true;
-                                }
-                        }
-                    matrix[row].push_back(value);
-                }
-        }
-
-    // write the matrix column-wise
-    DF396.clear();
-    for (uint32_t col = 0; col < num_satellites; col++)
-        {
-            for (uint32_t row = 0; row < num_signals; row++)
-                {
-                    std::string ss;
-                    if (matrix[row].at(col))
-                        {
-                            ss = "1";
-                        }
-                    else
-                        {
-                            ss = "0";
                         }
-                    DF396 += ss;
                 }
         }
     return DF396;
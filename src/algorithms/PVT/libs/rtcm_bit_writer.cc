@@ -0,0 +1,113 @@
+/*!
+ * \file rtcm_bit_writer.cc
+ * \brief Bit writer for the RTCM 3 transport layer
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtcm_bit_writer.h"
+#include "crc24q.h"
+#include <algorithm>  // for std::fill, std::min
+
+
+Rtcm_Bit_Writer::Rtcm_Bit_Writer()
+    : d_buffer(HEADER_BYTES + MAX_DATA_BYTES + CRC_BYTES, 0)
+{
+}
+
+
+void Rtcm_Bit_Writer::clear()
+{
+    // the bytes used by the previous frame, including its CRC
+    const std::size_t used = std::min(d_buffer.size(), HEADER_BYTES + (d_bits + 7) / 8 + CRC_BYTES);
+    std::fill(d_buffer.begin() + HEADER_BYTES, d_buffer.begin() + used, 0);
+    d_bits = 0;
+}
+
+
+void Rtcm_Bit_Writer::reserve_bits(std::size_t bits)
+{
+    const std::size_t bytes = HEADER_BYTES + (bits + 7) / 8 + CRC_BYTES;
+    if (bytes > d_buffer.size())
+        {
+            d_buffer.resize(2 * bytes, 0);
+        }
+}
+
+
+std::size_t Rtcm_Bit_Writer::skip(std::size_t len)
+{
+    const std::size_t pos = d_bits;
+    reserve_bits(d_bits + len);
+    d_bits += len;
+    return pos;
+}
+
+
+void Rtcm_Bit_Writer::append(uint64_t value, std::size_t len)
+{
+    write(skip(len), len, value);
+}
+
+
+void Rtcm_Bit_Writer::append(const std::string& bits)
+{
+    std::size_t pos = skip(bits.size());
+    std::size_t i = 0;
+    while (i < bits.size())
+        {
+            const std::size_t len = std::min<std::size_t>(bits.size() - i, 64);
+            uint64_t value = 0ULL;
+            for (std::size_t j = 0; j < len; j++)
+                {
+                    value = (value << 1) | static_cast<uint64_t>(bits[i + j] == '1');
+                }
+            write(pos, len, value);
+            pos += len;
+            i += len;
+        }
+}
+
+
+void Rtcm_Bit_Writer::write(std::size_t pos, std::size_t len, uint64_t value)
+{
+    std::size_t bit = HEADER_BYTES * 8 + pos;
+    while (len > 0)
+        {
+            const std::size_t offset = bit % 8;
+            const std::size_t n = std::min(8 - offset, len);
+            const std::size_t shift = 8 - offset - n;
+            const uint32_t ones = (1U << n) - 1U;
+            const auto bits = static_cast<uint32_t>((value >> (len - n)) & ones);
+            uint8_t& byte = d_buffer[bit / 8];
+            byte = static_cast<uint8_t>((byte & ~(ones << shift)) | (bits << shift));
+            bit += n;
+            len -= n;
+        }
+}
+
+
+std::string Rtcm_Bit_Writer::frame()
+{
+    // the padding bits are already zero
+    const std::size_t data_bytes = (d_bits + 7) / 8;
+    // preamble, 6 reserved bits and 10 bits of message length
+    d_buffer[0] = 0xD3;
+    d_buffer[1] = static_cast<uint8_t>((data_bytes >> 8) & 0x03U);
+    d_buffer[2] = static_cast<uint8_t>(data_bytes & 0xFFU);
+    const std::size_t crc_pos = HEADER_BYTES + data_bytes;
+    const uint32_t crc = Crc24q::checksum(d_buffer.data(), crc_pos);
+    d_buffer[crc_pos] = static_cast<uint8_t>(crc >> 16);
+    d_buffer[crc_pos + 1] = static_cast<uint8_t>(crc >> 8);
+    d_buffer[crc_pos + 2] = static_cast<uint8_t>(crc);
+    return std::string(d_buffer.begin(), d_buffer.begin() + crc_pos + CRC_BYTES);
+}
+
@@ -0,0 +1,117 @@
+/*!
+ * \file rtcm_bit_writer.h
+ * \brief Bit writer for the RTCM 3 transport layer
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_BIT_WRITER_H
+#define GNSS_SDR_RTCM_BIT_WRITER_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Writes the data message of an RTCM 3 frame directly into a byte
+ * buffer, and frames it with the transport header and the CRC-24Q.
+ *
+ * Bit positions are counted from the first bit of the data message, which is
+ * written most significant bit first. The buffer is allocated once for the
+ * largest frame allowed by the standard and reused for every message.
+ */
+class Rtcm_Bit_Writer
+{
+public:
+    Rtcm_Bit_Writer();
+
+    /*!
+     * \brief Starts a new data message
+     */
+    void clear();
+
+    /*!
+     * \brief Appends the len (up to 64) least significant bits of value
+     */
+    void append(uint64_t value, std::size_t len);
+
+    /*!
+     * \brief Appends a string of '0' and '1' characters
+     */
+    void append(const std::string& bits);
+
+    template <std::size_t N>
+    void append(const std::bitset<N>& bits)
+    {
+        write(skip(N), bits);
+    }
+
+    /*!
+     * \brief Appends len zero bits and returns the position of the first
+     * one, so that they can be filled later with write()
+     */
+    std::size_t skip(std::size_t len);
+
+    /*!
+     * \brief Writes the len (up to 64) least significant bits of value at
+     * position pos, which must be already appended
+     */
+    void write(std::size_t pos, std::size_t len, uint64_t value);
+
+    template <std::size_t N>
+    void write(std::size_t pos, const std::bitset<N>& bits)
+    {
+        const std::bitset<N> mask(~0ULL);
+        for (std::size_t done = 0; done < N; done += 64)
+            {
+                const std::size_t len = N - done < 64 ? N - done : 64;
+                write(pos + done, len, ((bits >> (N - done - len)) & mask).to_ullong());
+            }
+    }
+
+    /*!
+     * \brief Number of bits of the data message written so far
+     */
+    inline std::size_t size() const
+    {
+        return d_bits;
+    }
+
+    /*!
+     * \brief Pads the data message with zeros to complete a byte, adds the
+     * preamble, the message length and the CRC-24Q, and returns the frame as
+     * a string of binary data
+     */
+    std::string frame();
+
+private:
+    static const std::size_t HEADER_BYTES = 3;
+    static const std::size_t CRC_BYTES = 3;
+    static const std::size_t MAX_DATA_BYTES = 1023;
+
+    void reserve_bits(std::size_t bits);
+
+    std::vector<uint8_t> d_buffer;  // header, data message and CRC
+    std::size_t d_bits{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTCM_BIT_WRITER_H
@@ -222,7 +222,7 @@ Rtcm_Printer::~Rtcm_Printer()
 }
 
 
-void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
+void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Navigation_Data* pvt_solver,
     const std::map<int, Gnss_Synchro>& gnss_observables_map,
     double rx_time,
     int32_t type_of_rx,
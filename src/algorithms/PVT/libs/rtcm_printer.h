@@ -39,7 +39,7 @@ class Gnss_Synchro;
 class Gps_CNAV_Ephemeris;
 class Gps_Ephemeris;
 class Rtcm;
-class Rtklib_Solver;
+class Rtklib_Navigation_Data;
 class Galileo_HAS_data;
 
 /*!
@@ -69,7 +69,7 @@ public:
     /*!
      * \brief Print RTCM messages.
      */
-    void Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
+    void Print_Rtcm_Messages(const Rtklib_Navigation_Data* pvt_solver,
         const std::map<int, Gnss_Synchro>& gnss_observables_map,
         double rx_time,
         int32_t type_of_rx,
@@ -33,11 +33,13 @@
 #include "rtklib_solver.h"
 #include "Beidou_DNAV.h"
 #include "gnss_sdr_filesystem.h"
+#include "rtklib_rtkcmn.h"
 #include "rtklib_rtkpos.h"
 #include "rtklib_solution.h"
 #include <matio.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <exception>
 #include <utility>
 #include <vector>
@@ -163,6 +165,7 @@ Rtklib_Solver::Rtklib_Solver(const rtk_t &rtk,
 Rtklib_Solver::~Rtklib_Solver()
 {
     DLOG(INFO) << "Rtklib_Solver destructor called.";
+    freeephidx(&d_nav_data);
     if (d_dump_file.is_open() == true)
         {
             const auto pos = d_dump_file.tellp();
@@ -466,6 +469,52 @@ Monitor_Pvt Rtklib_Solver::get_monitor_pvt() const
 }
 
 
+Rtklib_Solver_Snapshot Rtklib_Solver::get_snapshot(const std::shared_ptr<const Rtklib_Navigation_Data>& nav_data) const
+{
+    Rtklib_Solver_Snapshot snapshot;
+    static_cast<Pvt_Solution&>(snapshot) = *this;
+    snapshot.dop = d_dop;
+    snapshot.pvt_sol = pvt_sol;
+    for (int sat = 1; sat <= MAXSAT && snapshot.num_sats_in_view < MAXOBS; sat++)
+        {
+            const ssat_t& ssat = pvt_ssat[sat - 1];
+            if (ssat.vs)
+                {
+                    Rtklib_Solver_Snapshot::Sat_In_View& sat_in_view = snapshot.sats_in_view[snapshot.num_sats_in_view++];
+                    sat_in_view.azel = {ssat.azel[0], ssat.azel[1]};
+                    sat_in_view.sat = sat;
+                    sat_in_view.snr = ssat.snr[0];
+                }
+        }
+    snapshot.nav_data = nav_data;
+    return snapshot;
+}
+
+
+double Rtklib_Solver_Snapshot::get_gdop() const
+{
+    return dop[0];
+}
+
+
+double Rtklib_Solver_Snapshot::get_pdop() const
+{
+    return dop[1];
+}
+
+
+double Rtklib_Solver_Snapshot::get_hdop() const
+{
+    return dop[2];
+}
+
+
+double Rtklib_Solver_Snapshot::get_vdop() const
+{
+    return dop[3];
+}
+
+
 void Rtklib_Solver::store_has_data(const Galileo_HAS_data &new_has_data)
 {
     //  Compute time of application HAS SIS ICD, Issue 1.0, Section 7.7
@@ -906,6 +955,92 @@ void Rtklib_Solver::get_current_has_obs_correction(const std::string &signal, ui
 }
 
 
+const eph_t &Rtklib_Solver::rtklib_eph(const Gps_Ephemeris &gps_eph)
+{
+    const bool pre_2009_file = this->is_pre_2009();
+    if (gps_eph.PRN == 0 || gps_eph.PRN > static_cast<uint32_t>(NSATGPS))
+        {
+            d_eph_unmirrored = eph_to_rtklib(gps_eph, pre_2009_file);
+            return d_eph_unmirrored;
+        }
+    const Rtklib_Eph_Mirror<eph_t>::Fingerprint fingerprint{
+        static_cast<double>(gps_eph.WN), static_cast<double>(gps_eph.tow),
+        static_cast<double>(gps_eph.toe), static_cast<double>(gps_eph.toc),
+        gps_eph.sqrtA, gps_eph.M_0, gps_eph.af0, gps_eph.af1, gps_eph.TGD,
+        pre_2009_file ? 1.0 : 0.0};
+    return d_eph_mirror[gps_eph.PRN - 1].get(fingerprint, [&gps_eph, pre_2009_file]() { return eph_to_rtklib(gps_eph, pre_2009_file); });
+}
+
+
+const eph_t &Rtklib_Solver::rtklib_eph(const Gps_CNAV_Ephemeris &gps_cnav_eph)
+{
+    if (gps_cnav_eph.PRN == 0 || gps_cnav_eph.PRN > static_cast<uint32_t>(NSATGPS))
+        {
+            d_eph_unmirrored = eph_to_rtklib(gps_cnav_eph);
+            return d_eph_unmirrored;
+        }
+    const Rtklib_Eph_Mirror<eph_t>::Fingerprint fingerprint{
+        static_cast<double>(gps_cnav_eph.WN), static_cast<double>(gps_cnav_eph.tow),
+        static_cast<double>(gps_cnav_eph.toe1), static_cast<double>(gps_cnav_eph.toc),
+        gps_cnav_eph.sqrtA, gps_cnav_eph.M_0, gps_cnav_eph.af0, gps_cnav_eph.af1,
+        gps_cnav_eph.TGD, gps_cnav_eph.ISCL2};
+    return d_cnav_eph_mirror[gps_cnav_eph.PRN - 1].get(fingerprint, [&gps_cnav_eph]() { return eph_to_rtklib(gps_cnav_eph); });
+}
+
+
+const eph_t &Rtklib_Solver::rtklib_eph(const Galileo_Ephemeris &gal_eph)
+{
+    const uint32_t sat = gal_eph.PRN + NSATGPS + NSATGLO;
+    if (gal_eph.PRN == 0 || gal_eph.PRN > static_cast<uint32_t>(NSATGAL))
+        {
+            d_eph_unmirrored = eph_to_rtklib(gal_eph);
+            return d_eph_unmirrored;
+        }
+    const Rtklib_Eph_Mirror<eph_t>::Fingerprint fingerprint{
+        static_cast<double>(gal_eph.WN), static_cast<double>(gal_eph.tow),
+        static_cast<double>(gal_eph.toe), static_cast<double>(gal_eph.toc),
+        gal_eph.sqrtA, gal_eph.M_0, gal_eph.af0, gal_eph.af1,
+        gal_eph.BGD_E1E5a, gal_eph.BGD_E1E5b};
+    return d_eph_mirror[sat - 1].get(fingerprint, [&gal_eph]() { return eph_to_rtklib(gal_eph); });
+}
+
+
+const eph_t &Rtklib_Solver::rtklib_eph(const Beidou_Dnav_Ephemeris &bei_eph)
+{
+    const uint32_t sat = bei_eph.PRN + NSATGPS + NSATGLO + NSATGAL + NSATQZS;
+    if (bei_eph.PRN == 0 || bei_eph.PRN > static_cast<uint32_t>(NSATBDS))
+        {
+            d_eph_unmirrored = eph_to_rtklib(bei_eph);
+            return d_eph_unmirrored;
+        }
+    const Rtklib_Eph_Mirror<eph_t>::Fingerprint fingerprint{
+        static_cast<double>(bei_eph.WN), static_cast<double>(bei_eph.tow),
+        static_cast<double>(bei_eph.toe), static_cast<double>(bei_eph.toc),
+        bei_eph.sqrtA, bei_eph.M_0, bei_eph.af0, bei_eph.AODE, bei_eph.AODC,
+        static_cast<double>(bei_eph.SV_health)};
+    return d_eph_mirror[sat - 1].get(fingerprint, [&bei_eph]() { return eph_to_rtklib(bei_eph); });
+}
+
+
+const geph_t &Rtklib_Solver::rtklib_eph(const Glonass_Gnav_Ephemeris &glonass_gnav_eph, const Glonass_Gnav_Utc_Model &gnav_utc)
+{
+    const uint32_t slot = glonass_gnav_eph.i_satellite_slot_number;
+    if (slot == 0 || slot > static_cast<uint32_t>(NSATGLO))
+        {
+            d_geph_unmirrored = eph_to_rtklib(glonass_gnav_eph, gnav_utc);
+            return d_geph_unmirrored;
+        }
+    const Rtklib_Eph_Mirror<geph_t>::Fingerprint fingerprint{
+        glonass_gnav_eph.d_t_b, glonass_gnav_eph.d_t_k,
+        glonass_gnav_eph.d_N_T, glonass_gnav_eph.d_yr,
+        glonass_gnav_eph.d_Xn, glonass_gnav_eph.d_tau_n,
+        static_cast<double>(glonass_gnav_eph.i_satellite_freq_channel),
+        glonass_gnav_eph.d_l3rd_n ? 1.0 : 0.0,
+        gnav_utc.d_tau_c, gnav_utc.d_tau_gps};
+    return d_geph_mirror[slot - 1].get(fingerprint, [&glonass_gnav_eph, &gnav_utc]() { return eph_to_rtklib(glonass_gnav_eph, gnav_utc); });
+}
+
+
 bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_map, double kf_update_interval_s)
 {
     std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
@@ -924,8 +1059,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
     int glo_valid_obs = 0;  // GLONASS L1/L2 valid observations counter
 
     d_obs_data.fill({});
-    std::vector<eph_t> eph_data(MAXOBS);
-    std::vector<geph_t> geph_data(MAXOBS);
+    d_eph_data.fill({});
+    d_geph_data.fill({});
 
     // Workaround for NAV/CNAV clash problem
     bool gps_dual_band = false;
@@ -979,7 +1114,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (galileo_ephemeris_iter != galileo_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second,
+                                        d_eph_data[valid_obs] = rtklib_eph(galileo_ephemeris_iter->second);
+                                        has_corrections_to_rtklib(d_eph_data[valid_obs], static_cast<int>(galileo_ephemeris_iter->second.PRN),
                                             this->d_has_orbit_corrections_store_map[gal_str],
                                             this->d_has_clock_corrections_store_map[gal_str]);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
@@ -1007,7 +1143,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                         bool found_E1_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
+                                                if (d_eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
                                                     {
                                                         d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
                                                             gnss_observables_iter->second,
@@ -1022,7 +1158,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert Galileo E5 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second,
+                                                d_eph_data[valid_obs] = rtklib_eph(galileo_ephemeris_iter->second);
+                                                has_corrections_to_rtklib(d_eph_data[valid_obs], static_cast<int>(galileo_ephemeris_iter->second.PRN),
                                                     this->d_has_orbit_corrections_store_map[gal_str],
                                                     this->d_has_clock_corrections_store_map[gal_str]);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
@@ -1051,7 +1188,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                         bool found_E1_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
+                                                if (d_eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
                                                     {
                                                         d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
                                                             gnss_observables_iter->second,
@@ -1066,7 +1203,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert Galileo E6 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second,
+                                                d_eph_data[valid_obs] = rtklib_eph(galileo_ephemeris_iter->second);
+                                                has_corrections_to_rtklib(d_eph_data[valid_obs], static_cast<int>(galileo_ephemeris_iter->second.PRN),
                                                     this->d_has_orbit_corrections_store_map[gal_str],
                                                     this->d_has_clock_corrections_store_map[gal_str]);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
@@ -1095,7 +1233,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                         bool found_E1_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
+                                                if (d_eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
                                                     {
                                                         d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
                                                             gnss_observables_iter->second,
@@ -1109,7 +1247,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert Galileo E6 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = rtklib_eph(galileo_ephemeris_iter->second);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -1142,10 +1280,10 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (gps_ephemeris_iter != gps_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(gps_ephemeris_iter->second,
+                                        d_eph_data[valid_obs] = rtklib_eph(gps_ephemeris_iter->second);
+                                        has_corrections_to_rtklib(d_eph_data[valid_obs], static_cast<int>(gps_ephemeris_iter->second.PRN),
                                             this->d_has_orbit_corrections_store_map[gps_str],
-                                            this->d_has_clock_corrections_store_map[gps_str],
-                                            this->is_pre_2009());
+                                            this->d_has_clock_corrections_store_map[gps_str]);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -1176,12 +1314,12 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                 // (more precise!), and attach the L2 observation to the L1 observation in RTKLIB structure
                                                 for (int i = 0; i < valid_obs; i++)
                                                     {
-                                                        if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
+                                                        if (d_eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
                                                             {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                                d_eph_data[i] = rtklib_eph(gps_cnav_ephemeris_iter->second);
                                                                 d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
                                                                     gnss_observables_iter->second,
-                                                                    eph_data[i].week,
+                                                                    d_eph_data[i].week,
                                                                     d_rtklib_band_index[sig_]);
                                                                 break;
                                                             }
@@ -1192,7 +1330,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 3. If not found, insert the GPS L2 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = rtklib_eph(gps_cnav_ephemeris_iter->second);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -1224,9 +1362,9 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                 // (more precise!), and attach the L5 observation to the L1 observation in RTKLIB structure
                                                 for (int i = 0; i < valid_obs; i++)
                                                     {
-                                                        if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
+                                                        if (d_eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
                                                             {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                                d_eph_data[i] = rtklib_eph(gps_cnav_ephemeris_iter->second);
                                                                 d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i],
                                                                     gnss_observables_iter->second,
                                                                     gps_cnav_ephemeris_iter->second.WN,
@@ -1239,7 +1377,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 3. If not found, insert the GPS L5 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = rtklib_eph(gps_cnav_ephemeris_iter->second);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -1271,7 +1409,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (glonass_gnav_ephemeris_iter != glonass_gnav_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                        d_geph_data[glo_valid_obs] = rtklib_eph(glonass_gnav_ephemeris_iter->second, gnav_utc);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -1295,7 +1433,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                         bool found_L1_obs = false;
                                         for (int i = 0; i < glo_valid_obs; i++)
                                             {
-                                                if (geph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS)))
+                                                if (d_geph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS)))
                                                     {
                                                         d_obs_data[i + valid_obs] = insert_obs_to_rtklib(d_obs_data[i + valid_obs],
                                                             gnss_observables_iter->second,
@@ -1309,7 +1447,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert GLONASS GNAV L2 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                                d_geph_data[glo_valid_obs] = rtklib_eph(glonass_gnav_ephemeris_iter->second, gnav_utc);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 obsd_t newobs{};
                                                 d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -1337,7 +1475,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (beidou_ephemeris_iter != beidou_dnav_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                        d_eph_data[valid_obs] = rtklib_eph(beidou_ephemeris_iter->second);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -1360,7 +1498,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                         bool found_B1I_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO + NSATGAL + NSATQZS)))
+                                                if (d_eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO + NSATGAL + NSATQZS)))
                                                     {
                                                         d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
                                                             gnss_observables_iter->second,
@@ -1374,7 +1512,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert BeiDou B3I obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = rtklib_eph(beidou_ephemeris_iter->second);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -1409,11 +1547,21 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
     if ((valid_obs + glo_valid_obs) > 3)
         {
             int result = 0;
-            d_nav_data = {};
-            d_nav_data.eph = eph_data.data();
-            d_nav_data.geph = geph_data.data();
+            // d_nav_data persists across epochs, only the models set below are reset
+            std::fill_n(d_nav_data.ion_gps, 8, 0.0);
+            std::fill_n(d_nav_data.ion_gal, 4, 0.0);
+            std::fill_n(d_nav_data.ion_cmp, 8, 0.0);
+            std::fill_n(d_nav_data.utc_gps, 4, 0.0);
+            std::fill_n(d_nav_data.utc_glo, 4, 0.0);
+            std::fill_n(d_nav_data.utc_gal, 4, 0.0);
+            std::fill_n(d_nav_data.utc_cmp, 4, 0.0);
+            d_nav_data.leaps = 0;
+            d_nav_data.eph = d_eph_data.data();
+            d_nav_data.geph = d_geph_data.data();
             d_nav_data.n = valid_obs;
             d_nav_data.ng = glo_valid_obs;
+            // The ephemeris arrays are refilled every epoch, so is their index
+            buildephidx(&d_nav_data);
             if (gps_iono.valid)
                 {
                     d_nav_data.ion_gps[0] = gps_iono.alpha0;
@@ -1495,13 +1643,17 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                 }
 
             /* update carrier wave length using native function call in RTKlib */
-            for (int i = 0; i < MAXSAT; i++)
+            // Only the GLONASS ones depend on the ephemeris, the others are computed once
+            const int first_sat = d_nav_lam_initialized ? NSATGPS : 0;
+            const int last_sat = d_nav_lam_initialized ? NSATGPS + NSATGLO : MAXSAT;
+            for (int i = first_sat; i < last_sat; i++)
                 {
                     for (int j = 0; j < NFREQ; j++)
                         {
                             d_nav_data.lam[i][j] = satwavelen(i + 1, d_rtklib_freq_index[j], &d_nav_data);
                         }
                 }
+            d_nav_lam_initialized = true;
 
             result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data);
 
@@ -1521,31 +1673,25 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     this->set_num_valid_observations(d_rtk.sol.ns);  // record the number of valid satellites used by the PVT solver
                     pvt_sol = d_rtk.sol;
                     // DOP computation
-                    unsigned int used_sats = 0;
                     for (unsigned int i = 0; i < MAXSAT; i++)
                         {
                             pvt_ssat[i] = d_rtk.ssat[i];
-                            if (d_rtk.ssat[i].vs == 1)
-                                {
-                                    used_sats++;
-                                }
                         }
 
-                    std::vector<double> azel(used_sats * 2);
                     int index_aux = 0;
                     for (auto &i : d_rtk.ssat)
                         {
                             if (i.vs == 1)
                                 {
-                                    azel[2 * index_aux] = i.azel[0];
-                                    azel[2 * index_aux + 1] = i.azel[1];
+                                    d_azel[2 * index_aux] = i.azel[0];
+                                    d_azel[2 * index_aux + 1] = i.azel[1];
                                     index_aux++;
                                 }
                         }
 
                     if (index_aux > 0)
                         {
-                            dops(index_aux, azel.data(), 0.0, d_dop.data());
+                            dops(index_aux, d_azel.data(), 0.0, d_dop.data());
                         }
                     this->set_valid_position(true);
                     std::array<double, 4> rx_position_and_time{};
@@ -1714,14 +1860,21 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
 
                     // write UTC time string
 
-                    // Use a facet to display time in a custom format (only hour and minutes).
-                    auto *facet = new boost::posix_time::time_facet();
-                    facet->format("%Y-%m-%dT%H:%M:%S%F");
-                    std::stringstream stream;
-                    stream.imbue(std::locale(std::locale::classic(), facet));
-                    stream << p_time;
-                    stream << 'Z';
-                    d_monitor_pvt.utc_time = stream.str();
+                    // Same format as "%Y-%m-%dT%H:%M:%S%FZ", written without a stream so that no memory is allocated
+                    const boost::gregorian::date::ymd_type ymd = p_time.date().year_month_day();
+                    const boost::posix_time::time_duration tod = p_time.time_of_day();
+                    std::array<char, 48> utc_time{};
+                    int utc_time_length = std::snprintf(utc_time.data(), utc_time.size(), "%04d-%02d-%02dT%02d:%02d:%02d",
+                        static_cast<int>(ymd.year), static_cast<int>(ymd.month), static_cast<int>(ymd.day),
+                        static_cast<int>(tod.hours()), static_cast<int>(tod.minutes()), static_cast<int>(tod.seconds()));
+                    if (tod.fractional_seconds() != 0)
+                        {
+                            utc_time_length += std::snprintf(utc_time.data() + utc_time_length, utc_time.size() - utc_time_length, ".%0*lld",
+                                static_cast<int>(boost::posix_time::time_duration::num_fractional_digits()),
+                                static_cast<long long>(tod.fractional_seconds()));  // NOLINT(google-runtime-int)
+                        }
+                    utc_time[utc_time_length++] = 'Z';
+                    d_monitor_pvt.utc_time.assign(utc_time.data(), utc_time_length);
 
                     // ######## LOG FILE #########
                     if (d_flag_dump_enabled == true)
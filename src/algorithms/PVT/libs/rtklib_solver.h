@@ -65,6 +65,7 @@
 #include <cstdint>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -75,10 +76,108 @@
  * \{ */
 
 
+/*!
+ * \brief RTKLIB ephemeris of one satellite, converted from its GNSS-SDR
+ * counterpart. A fingerprint of the source ephemeris is kept along with it,
+ * so the conversion is repeated only when a new ephemeris is received.
+ */
+template <typename T>
+class Rtklib_Eph_Mirror
+{
+public:
+    using Fingerprint = std::array<double, 10>;
+
+    /*!
+     * \brief Returns the stored ephemeris, calling conversion() to refresh it
+     * if fingerprint differs from the one of the last conversion.
+     */
+    template <typename Conversion>
+    const T& get(const Fingerprint& fingerprint, Conversion conversion)
+    {
+        if (!d_valid || fingerprint != d_fingerprint)
+            {
+                d_eph = conversion();
+                d_fingerprint = fingerprint;
+                d_valid = true;
+            }
+        return d_eph;
+    }
+
+private:
+    Fingerprint d_fingerprint{};
+    T d_eph{};
+    bool d_valid{false};
+};
+
+
+/*!
+ * \brief Navigation data of a Rtklib_Solver that is read by the RINEX and
+ * RTCM printers
+ */
+class Rtklib_Navigation_Data
+{
+public:
+    std::map<int, Galileo_Ephemeris> galileo_ephemeris_map;            //!< Map storing new Galileo_Ephemeris
+    std::map<int, Gps_Ephemeris> gps_ephemeris_map;                    //!< Map storing new GPS_Ephemeris
+    std::map<int, Gps_CNAV_Ephemeris> gps_cnav_ephemeris_map;          //!< Map storing new GPS_CNAV_Ephemeris
+    std::map<int, Glonass_Gnav_Ephemeris> glonass_gnav_ephemeris_map;  //!< Map storing new GLONASS GNAV Ephemeris
+    std::map<int, Beidou_Dnav_Ephemeris> beidou_dnav_ephemeris_map;    //!< Map storing new BeiDou DNAV Ephmeris
+
+    Galileo_Utc_Model galileo_utc_model;
+    Galileo_Iono galileo_iono;
+
+    Gps_Utc_Model gps_utc_model;
+    Gps_Iono gps_iono;
+
+    Gps_CNAV_Iono gps_cnav_iono;
+    Gps_CNAV_Utc_Model gps_cnav_utc_model;
+
+    Glonass_Gnav_Utc_Model glonass_gnav_utc_model;  //!< Map storing GLONASS GNAV UTC Model
+    Glonass_Gnav_Almanac glonass_gnav_almanac;      //!< Map storing GLONASS GNAV Almanac Model
+
+    Beidou_Dnav_Utc_Model beidou_dnav_utc_model;
+    Beidou_Dnav_Iono beidou_dnav_iono;
+};
+
+
+/*!
+ * \brief Solution of a Rtklib_Solver at a given epoch, as read by the output
+ * printers. It can be handed over to another thread while the solver computes
+ * the next epochs. The navigation data is not copied, but shared.
+ */
+class Rtklib_Solver_Snapshot : public Pvt_Solution
+{
+public:
+    double get_hdop() const override;
+    double get_vdop() const override;
+    double get_pdop() const override;
+    double get_gdop() const override;
+
+    /*!
+     * \brief Satellite in view, with the fields of ssat_t used by the NMEA
+     * GSA and GSV sentences
+     */
+    struct Sat_In_View
+    {
+        std::array<double, 2> azel{};  // azimuth/elevation angles {az,el} [rad]
+        int sat{0};                    // RTKLIB satellite number
+        unsigned char snr{0};          // signal strength [0.25 dBHz]
+    };
+
+    std::array<double, 4> dop{};  // GDOP, PDOP, HDOP, VDOP
+
+    sol_t pvt_sol{};
+    std::array<Sat_In_View, MAXOBS> sats_in_view{};
+    int num_sats_in_view{0};
+
+    std::shared_ptr<const Rtklib_Navigation_Data> nav_data;
+};
+
+
 /*!
  * \brief This class implements a PVT solution based on RTKLIB
  */
-class Rtklib_Solver : public Pvt_Solution
+class Rtklib_Solver : public Pvt_Solution, public Rtklib_Navigation_Data
 {
 public:
     Rtklib_Solver(const rtk_t& rtk,
@@ -100,31 +199,17 @@ public:
     void store_has_data(const Galileo_HAS_data& new_has_data);
     void update_has_corrections(const std::map<int, Gnss_Synchro>& obs_map);
 
+    /*!
+     * \brief Returns the current solution. The snapshot refers to nav_data
+     * for the navigation data.
+     */
+    Rtklib_Solver_Snapshot get_snapshot(const std::shared_ptr<const Rtklib_Navigation_Data>& nav_data) const;
+
     sol_t pvt_sol{};
     std::array<ssat_t, MAXSAT> pvt_ssat{};
 
-    std::map<int, Galileo_Ephemeris> galileo_ephemeris_map;            //!< Map storing new Galileo_Ephemeris
-    std::map<int, Gps_Ephemeris> gps_ephemeris_map;                    //!< Map storing new GPS_Ephemeris
-    std::map<int, Gps_CNAV_Ephemeris> gps_cnav_ephemeris_map;          //!< Map storing new GPS_CNAV_Ephemeris
-    std::map<int, Glonass_Gnav_Ephemeris> glonass_gnav_ephemeris_map;  //!< Map storing new GLONASS GNAV Ephemeris
-    std::map<int, Beidou_Dnav_Ephemeris> beidou_dnav_ephemeris_map;    //!< Map storing new BeiDou DNAV Ephmeris
-
-    Galileo_Utc_Model galileo_utc_model;
-    Galileo_Iono galileo_iono;
     std::map<int, Galileo_Almanac> galileo_almanac_map;
-
-    Gps_Utc_Model gps_utc_model;
-    Gps_Iono gps_iono;
     std::map<int, Gps_Almanac> gps_almanac_map;
-
-    Gps_CNAV_Iono gps_cnav_iono;
-    Gps_CNAV_Utc_Model gps_cnav_utc_model;
-
-    Glonass_Gnav_Utc_Model glonass_gnav_utc_model;  //!< Map storing GLONASS GNAV UTC Model
-    Glonass_Gnav_Almanac glonass_gnav_almanac;      //!< Map storing GLONASS GNAV Almanac Model
-
-    Beidou_Dnav_Utc_Model beidou_dnav_utc_model;
-    Beidou_Dnav_Iono beidou_dnav_iono;
     std::map<int, Beidou_Dnav_Almanac> beidou_dnav_almanac_map;
 
 private:
@@ -134,8 +219,23 @@ private:
     void get_has_biases(const std::map<int, Gnss_Synchro>& obs_map);
     void get_current_has_obs_correction(const std::string& signal, uint32_t tow_obs, int prn);
 
+    // RTKLIB ephemeris of each satellite, converted only when it changes
+    const eph_t& rtklib_eph(const Gps_Ephemeris& gps_eph);
+    const eph_t& rtklib_eph(const Gps_CNAV_Ephemeris& gps_cnav_eph);
+    const eph_t& rtklib_eph(const Galileo_Ephemeris& gal_eph);
+    const eph_t& rtklib_eph(const Beidou_Dnav_Ephemeris& bei_eph);
+    const geph_t& rtklib_eph(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, const Glonass_Gnav_Utc_Model& gnav_utc);
+
     std::array<obsd_t, MAXOBS> d_obs_data{};
+    std::array<eph_t, MAXOBS> d_eph_data{};
+    std::array<geph_t, MAXOBS> d_geph_data{};
+    std::array<double, 2 * MAXSAT> d_azel{};  // azimuth and elevation of the satellites used in the solution
     std::array<double, 4> d_dop{};
+    std::array<Rtklib_Eph_Mirror<eph_t>, MAXSAT> d_eph_mirror{};        // GPS LNAV, Galileo and BeiDou, indexed by RTKLIB satellite number - 1
+    std::array<Rtklib_Eph_Mirror<eph_t>, NSATGPS> d_cnav_eph_mirror{};  // GPS CNAV, indexed by PRN - 1
+    std::array<Rtklib_Eph_Mirror<geph_t>, NSATGLO> d_geph_mirror{};     // GLONASS, indexed by slot number - 1
+    eph_t d_eph_unmirrored{};                                           // conversion of the satellites out of the range of the mirrors
+    geph_t d_geph_unmirrored{};
     std::map<int, int> d_rtklib_freq_index;
     std::map<std::string, int> d_rtklib_band_index;
 
@@ -157,6 +257,7 @@ private:
     uint32_t d_type_of_rx;
     bool d_flag_dump_enabled;
     bool d_flag_dump_mat_enabled;
+    bool d_nav_lam_initialized{false};
 };
 
 
@@ -163,6 +163,12 @@ void GalileoE1PcpsAmbiguousAcquisition::set_local_code()
     bool cboc = configuration_->property(
         "Acquisition" + std::to_string(channel_) + ".cboc", false);
 
+    const uint32_t code_variant = (acquire_pilot_ ? 1U : 0U) | (cboc ? 2U : 0U);
+    if (acquisition_->set_local_code_from_cache(code_variant))
+        {
+            return;
+        }
+
     volk_gnsssdr::vector<std::complex<float>> code(code_length_);
 
     if (acquire_pilot_ == true)
@@ -204,7 +210,7 @@ void GalileoE1PcpsAmbiguousAcquisition::set_local_code()
             std::copy_n(code.data(), code_length_, code_span.subspan(i * code_length_, code_length_).data());
         }
 
-    acquisition_->set_local_code(code_.data());
+    acquisition_->set_local_code(code_.data(), code_variant);
 }
 
 
@@ -156,7 +156,6 @@ void GalileoE5aPcpsAcquisition::init()
 
 void GalileoE5aPcpsAcquisition::set_local_code()
 {
-    volk_gnsssdr::vector<std::complex<float>> code(code_length_);
     std::array<char, 3> signal_{};
     signal_[0] = '5';
     signal_[2] = '\0';
@@ -174,6 +173,12 @@ void GalileoE5aPcpsAcquisition::set_local_code()
             signal_[1] = 'I';
         }
 
+    if (acquisition_->set_local_code_from_cache(signal_[1]))
+        {
+            return;
+        }
+
+    volk_gnsssdr::vector<std::complex<float>> code(code_length_);
     if (acq_parameters_.use_automatic_resampler)
         {
             galileo_e5_a_code_gen_complex_sampled(code, gnss_synchro_->PRN, signal_, acq_parameters_.resampled_fs, 0);
@@ -188,7 +193,7 @@ void GalileoE5aPcpsAcquisition::set_local_code()
             std::copy_n(code.data(), code_length_, code_span.subspan(i * code_length_, code_length_).data());
         }
 
-    acquisition_->set_local_code(code_.data());
+    acquisition_->set_local_code(code_.data(), signal_[1]);
 }
 
 
@@ -154,7 +154,6 @@ void GalileoE5bPcpsAcquisition::init()
 
 void GalileoE5bPcpsAcquisition::set_local_code()
 {
-    volk_gnsssdr::vector<std::complex<float>> code(code_length_);
     std::array<char, 3> signal_{};
     signal_[0] = '7';
     signal_[2] = '\0';
@@ -172,6 +171,12 @@ void GalileoE5bPcpsAcquisition::set_local_code()
             signal_[1] = 'I';
         }
 
+    if (acquisition_->set_local_code_from_cache(signal_[1]))
+        {
+            return;
+        }
+
+    volk_gnsssdr::vector<std::complex<float>> code(code_length_);
     if (acq_parameters_.use_automatic_resampler)
         {
             galileo_e5_b_code_gen_complex_sampled(code, gnss_synchro_->PRN, signal_, acq_parameters_.resampled_fs, 0);
@@ -186,7 +191,7 @@ void GalileoE5bPcpsAcquisition::set_local_code()
             std::copy_n(code.data(), code_length_, code_span.subspan(i * code_length_, code_length_).data());
         }
 
-    acquisition_->set_local_code(code_.data());
+    acquisition_->set_local_code(code_.data(), signal_[1]);
 }
 
 
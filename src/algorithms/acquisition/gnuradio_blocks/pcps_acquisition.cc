@@ -22,6 +22,7 @@
 #include "pcps_acquisition.h"
 #include "GLONASS_L1_L2_CA.h"  // for GLONASS_PRN
 #include "MATH_CONSTANTS.h"    // for TWO_PI
+#include "acquisition_thread_pool.h"
 #include "gnss_frequencies.h"
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_filesystem.h"
@@ -83,6 +84,7 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_)
       d_worker_active(false),
       d_step_two(false),
       d_use_CFAR_algorithm_flag(conf_.use_CFAR_algorithm_flag),
+      d_frequency_domain_doppler(conf_.frequency_domain_doppler),
       d_dump(conf_.dump)
 {
     this->message_port_register_out(pmt::mp("events"));
@@ -178,7 +180,44 @@ void pcps_acquisition::set_resampler_latency(uint32_t latency_samples)
 }
 
 
-void pcps_acquisition::set_local_code(std::complex<float>* code)
+Acquisition_Code_Cache::Key pcps_acquisition::code_cache_key(uint32_t code_variant) const
+{
+    Acquisition_Code_Cache::Key key;
+    key.system = d_gnss_synchro->System;
+    key.signal[0] = d_gnss_synchro->Signal[0];
+    key.signal[1] = d_gnss_synchro->Signal[1];
+    key.prn = d_gnss_synchro->PRN;
+    key.fs = d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampled_fs : d_acq_parameters.fs_in;
+    key.fft_size = d_fft_size;
+    key.bit_transition_flag = d_acq_parameters.bit_transition_flag;
+    key.variant = code_variant;
+    return key;
+}
+
+
+bool pcps_acquisition::set_local_code_from_cache(uint32_t code_variant)
+{
+    auto& cache = Acquisition_Code_Cache::instance();
+    if (!cache.enabled())
+        {
+            return false;
+        }
+    auto fft_codes = cache.find(code_cache_key(code_variant));
+    if (!fft_codes)
+        {
+            return false;
+        }
+    if (is_fdma())
+        {
+            update_grid_doppler_wipeoffs();
+        }
+    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+    d_cached_fft_codes = std::move(fft_codes);
+    return true;
+}
+
+
+void pcps_acquisition::set_local_code(std::complex<float>* code, uint32_t code_variant)
 {
     // This will check if it's fdma, if yes will update the intermediate frequency and the doppler grid
     if (is_fdma())
@@ -210,7 +249,19 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
         }
 
     d_fft_if->execute();  // We need the FFT of local code
-    volk_32fc_conjugate_32fc(d_fft_codes.data(), d_fft_if->get_outbuf(), d_fft_size);
+    auto& cache = Acquisition_Code_Cache::instance();
+    if (cache.enabled())
+        {
+            auto fft_codes = std::make_shared<Acquisition_Code_Cache::Code_Spectrum>(d_fft_size);
+            volk_32fc_conjugate_32fc(fft_codes->data(), d_fft_if->get_outbuf(), d_fft_size);
+            cache.insert(code_cache_key(code_variant), fft_codes);
+            d_cached_fft_codes = std::move(fft_codes);
+        }
+    else
+        {
+            volk_32fc_conjugate_32fc(d_fft_codes.data(), d_fft_if->get_outbuf(), d_fft_size);
+            d_cached_fft_codes = nullptr;
+        }
 }
 
 
@@ -267,7 +318,7 @@ void pcps_acquisition::init()
     d_num_doppler_bins = static_cast<uint32_t>(std::ceil(static_cast<double>(2 * d_acq_parameters.doppler_max) / static_cast<double>(d_doppler_step)));
 
     // Create the carrier Doppler wipeoff signals
-    if (d_grid_doppler_wipeoffs.empty())
+    if (d_grid_doppler_wipeoffs.empty() && !d_frequency_domain_doppler)
         {
             d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
         }
@@ -300,6 +351,11 @@ void pcps_acquisition::init()
 
 void pcps_acquisition::update_grid_doppler_wipeoffs()
 {
+    if (d_frequency_domain_doppler)
+        {
+            update_grid_doppler_shifts();
+            return;
+        }
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
             const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
@@ -308,6 +364,57 @@ void pcps_acquisition::update_grid_doppler_wipeoffs()
 }
 
 
+void pcps_acquisition::update_grid_doppler_shifts()
+{
+    // A Doppler shift of an integer number k of FFT bins is equivalent to a
+    // circular shift of the input spectrum by k bins. Each Doppler bin of the
+    // grid is split into that integer shift plus a fractional residual, and
+    // only one carrier wipeoff (and one forward FFT) per distinct residual is
+    // required. Here d_grid_doppler_wipeoffs holds the residual wipeoffs.
+    const double fs = static_cast<double>(d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampled_fs : d_acq_parameters.fs_in);
+    const double bin_width_hz = fs / static_cast<double>(d_fft_size);
+    const double residual_tolerance_hz = 1e-3;
+    std::vector<double> residuals_hz;
+
+    d_doppler_bin_residual_index.resize(d_num_doppler_bins);
+    d_doppler_bin_shift.resize(d_num_doppler_bins);
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
+            const double doppler_hz = static_cast<double>(d_doppler_bias + doppler);
+            auto bins = static_cast<int64_t>(std::floor(doppler_hz / bin_width_hz));
+            double residual_hz = doppler_hz - static_cast<double>(bins) * bin_width_hz;
+            if (bin_width_hz - residual_hz < residual_tolerance_hz)
+                {
+                    bins++;
+                    residual_hz = 0.0;
+                }
+            uint32_t residual_index = 0U;
+            while (residual_index < residuals_hz.size() && std::abs(residuals_hz[residual_index] - residual_hz) >= residual_tolerance_hz)
+                {
+                    residual_index++;
+                }
+            if (residual_index == residuals_hz.size())
+                {
+                    residuals_hz.push_back(residual_hz);
+                }
+            d_doppler_bin_residual_index[doppler_index] = residual_index;
+            const int64_t shift = bins % static_cast<int64_t>(d_fft_size);
+            d_doppler_bin_shift[doppler_index] = static_cast<uint32_t>(shift < 0 ? shift + d_fft_size : shift);
+        }
+
+    if (d_grid_doppler_wipeoffs.size() != residuals_hz.size())
+        {
+            d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(residuals_hz.size(), volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+            d_grid_doppler_residual_spectra = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(residuals_hz.size(), volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+        }
+    for (size_t residual_index = 0; residual_index < residuals_hz.size(); residual_index++)
+        {
+            update_local_carrier(d_grid_doppler_wipeoffs[residual_index], static_cast<float>(residuals_hz[residual_index]));
+        }
+}
+
+
 void pcps_acquisition::update_grid_doppler_wipeoffs_step2()
 {
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
@@ -624,6 +731,8 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                 }
         }
     const gr_complex* in = d_input_signal.data();  // Get the input samples pointer
+    const auto cached_fft_codes = d_cached_fft_codes;  // keep the code spectrum alive while the lock is released
+    const gr_complex* fft_codes = (cached_fft_codes ? cached_fft_codes->data() : d_fft_codes.data());
 
     d_mag = 0.0;
     d_num_noncoherent_integrations_counter++;
@@ -643,17 +752,42 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
     // Doppler frequency grid loop
     if (!d_step_two)
         {
+            if (d_frequency_domain_doppler)
+                {
+                    // Compute the FFT of the incoming signal once per fractional Doppler residual
+                    for (size_t residual_index = 0; residual_index < d_grid_doppler_residual_spectra.size(); residual_index++)
+                        {
+                            volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[residual_index].data(), d_fft_size);
+                            d_fft_if->execute();
+                            std::copy(d_fft_if->get_outbuf(), d_fft_if->get_outbuf() + d_fft_size, d_grid_doppler_residual_spectra[residual_index].data());
+                        }
+                }
             for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
                 {
-                    // Remove Doppler
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
+                    if (d_frequency_domain_doppler)
+                        {
+                            // Remove Doppler by circularly shifting the spectrum of the incoming signal,
+                            // and multiply it with the local FFT'd code reference
+                            const uint32_t shift = d_doppler_bin_shift[doppler_index];
+                            const gr_complex* spectrum = d_grid_doppler_residual_spectra[d_doppler_bin_residual_index[doppler_index]].data();
+                            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), spectrum + shift, fft_codes, d_fft_size - shift);
+                            if (shift > 0)
+                                {
+                                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf() + d_fft_size - shift, spectrum, fft_codes + d_fft_size - shift, shift);
+                                }
+                        }
+                    else
+                        {
+                            // Remove Doppler
+                            volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
 
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
+                            // Perform the FFT-based convolution  (parallel time search)
+                            // Compute the FFT of the carrier wiped--off incoming signal
+                            d_fft_if->execute();
 
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+                            // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
+                            volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), fft_codes, d_fft_size);
+                        }
 
                     // Compute the inverse FFT
                     d_ifft->execute();
@@ -712,7 +846,7 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
 
                     // Multiply carrier wiped--off, Fourier transformed incoming signal
                     // with the local FFT'd code reference using SIMD operations with VOLK library
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), fft_codes, d_fft_size);
 
                     // compute the inverse FFT
                     d_ifft->execute();
@@ -1016,7 +1150,13 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                     }
                 else
                     {
-                        gr::thread::thread d_worker(&pcps_acquisition::acquisition_core, this, d_sample_counter);
+                        // Run the dwell in the receiver-wide acquisition thread pool if available,
+                        // or in a dedicated thread otherwise
+                        const uint64_t samp_count = d_sample_counter;
+                        if (!Acquisition_Thread_Pool::instance().try_submit([this, samp_count]() { acquisition_core(samp_count); }))
+                            {
+                                gr::thread::thread d_worker(&pcps_acquisition::acquisition_core, this, d_sample_counter);
+                            }
                         d_worker_active = true;
                     }
                 consume_each(0);
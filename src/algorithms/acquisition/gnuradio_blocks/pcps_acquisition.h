@@ -43,6 +43,7 @@
 #endif
 
 #include "acq_conf.h"
+#include "acquisition_code_cache.h"
 #include "channel_fsm.h"
 #include "gnss_sdr_fft.h"
 #include <armadillo>
@@ -58,6 +59,7 @@
 #include <queue>
 #include <string>
 #include <utility>
+#include <vector>
 
 
 #if HAS_STD_SPAN
@@ -88,6 +90,11 @@ pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_);
  *
  * Check \ref Navitec2012 "An Open Source Galileo E1 Software Receiver",
  * Algorithm 1, for a pseudocode description of this implementation.
+ *
+ * If Acq_Conf::frequency_domain_doppler is set, the input signal is Fourier
+ * transformed only once per fractional Doppler residual (Doppler modulo the
+ * FFT bin width), and each Doppler hypothesis of the search grid is obtained
+ * by circularly shifting that spectrum an integer number of FFT bins.
  */
 class pcps_acquisition : public gr::block
 {
@@ -113,8 +120,19 @@ public:
     /*!
      * \brief Sets local code for PCPS acquisition algorithm.
      * \param code - Pointer to the PRN code.
+     * \param code_variant - Identifies the code generation options of the
+     * adapter in the acquisition code cache.
+     */
+    void set_local_code(std::complex<float>* code, uint32_t code_variant = 0);
+
+    /*!
+     * \brief Sets the local code spectrum from the acquisition code cache,
+     * if present. Returns false if the cache is disabled or there is no entry
+     * for the current satellite, in which case set_local_code() must be called.
+     * \param code_variant - Identifies the code generation options of the
+     * adapter in the acquisition code cache.
      */
-    void set_local_code(std::complex<float>* code);
+    bool set_local_code_from_cache(uint32_t code_variant = 0);
 
     /*!
      * \brief If set to 1, ensures that acquisition starts at the
@@ -209,8 +227,10 @@ private:
     friend pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_);
     explicit pcps_acquisition(const Acq_Conf& conf_);
 
+    Acquisition_Code_Cache::Key code_cache_key(uint32_t code_variant) const;
     void update_local_carrier(own::span<gr_complex> carrier_vector, float freq) const;
     void update_grid_doppler_wipeoffs();
+    void update_grid_doppler_shifts();
     void update_grid_doppler_wipeoffs_step2();
     void acquisition_core(uint64_t samp_count);
     void send_negative_acquisition();
@@ -227,7 +247,9 @@ private:
     volk_gnsssdr::vector<std::complex<float>> d_input_signal;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs_step_two;
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_residual_spectra;
     volk_gnsssdr::vector<std::complex<float>> d_fft_codes;
+    std::shared_ptr<const Acquisition_Code_Cache::Code_Spectrum> d_cached_fft_codes;
     volk_gnsssdr::vector<std::complex<float>> d_data_buffer;
     volk_gnsssdr::vector<lv_16sc_t> d_data_buffer_sc;
 
@@ -241,6 +263,8 @@ private:
     arma::fmat d_narrow_grid;
 
     std::queue<Gnss_Synchro> d_monitor_queue;
+    std::vector<uint32_t> d_doppler_bin_residual_index;
+    std::vector<uint32_t> d_doppler_bin_shift;
     std::string d_dump_filename;
 
     int64_t d_dump_number;
@@ -272,6 +296,7 @@ private:
     bool d_cshort;
     bool d_step_two;
     bool d_use_CFAR_algorithm_flag;
+    bool d_frequency_domain_doppler;
     bool d_dump;
 };
 
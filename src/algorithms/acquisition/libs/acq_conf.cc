@@ -81,6 +81,7 @@ void Acq_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
         }
     make_2_steps = configuration->property(role + ".make_two_steps", make_2_steps);
     blocking_on_standby = configuration->property(role + ".blocking_on_standby", blocking_on_standby);
+    frequency_domain_doppler = configuration->property(role + ".frequency_domain_doppler", frequency_domain_doppler);
 
     if (pfa <= 0.0)
         {
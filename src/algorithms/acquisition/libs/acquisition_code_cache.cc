@@ -0,0 +1,133 @@
+/*!
+ * \file acquisition_code_cache.cc
+ * \brief Process-wide, thread-safe cache of the conjugated FFTs of the local
+ * codes used by the PCPS acquisition blocks.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_code_cache.h"
+
+
+Acquisition_Code_Cache& Acquisition_Code_Cache::instance()
+{
+    static Acquisition_Code_Cache cache;
+    return cache;
+}
+
+
+void Acquisition_Code_Cache::set_capacity(size_t max_bytes)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_max_bytes = max_bytes;
+    evict();
+}
+
+
+bool Acquisition_Code_Cache::enabled() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_max_bytes > 0;
+}
+
+
+std::shared_ptr<const Acquisition_Code_Cache::Code_Spectrum> Acquisition_Code_Cache::find(const Key& key)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const auto it = d_entries.find(key);
+    if (it == d_entries.end())
+        {
+            d_misses++;
+            return nullptr;
+        }
+    d_hits++;
+    d_lru.splice(d_lru.begin(), d_lru, it->second.second);
+    return it->second.first;
+}
+
+
+void Acquisition_Code_Cache::insert(const Key& key, std::shared_ptr<const Code_Spectrum> spectrum)
+{
+    if (!spectrum)
+        {
+            return;
+        }
+    const size_t bytes = spectrum->size() * sizeof(std::complex<float>);
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (bytes > d_max_bytes)
+        {
+            return;
+        }
+    const auto it = d_entries.find(key);
+    if (it != d_entries.end())
+        {
+            d_bytes -= it->second.first->size() * sizeof(std::complex<float>);
+            it->second.first = std::move(spectrum);
+            d_lru.splice(d_lru.begin(), d_lru, it->second.second);
+        }
+    else
+        {
+            d_lru.push_front(key);
+            d_entries.emplace(key, std::make_pair(std::move(spectrum), d_lru.begin()));
+        }
+    d_bytes += bytes;
+    evict();
+}
+
+
+void Acquisition_Code_Cache::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_entries.clear();
+    d_lru.clear();
+    d_bytes = 0;
+}
+
+
+size_t Acquisition_Code_Cache::size_bytes() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_bytes;
+}
+
+
+size_t Acquisition_Code_Cache::entries() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_entries.size();
+}
+
+
+uint64_t Acquisition_Code_Cache::hits() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_hits;
+}
+
+
+uint64_t Acquisition_Code_Cache::misses() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_misses;
+}
+
+
+void Acquisition_Code_Cache::evict()
+{
+    // Called with d_mutex held
+    while (d_bytes > d_max_bytes && !d_lru.empty())
+        {
+            const auto it = d_entries.find(d_lru.back());
+            d_bytes -= it->second.first->size() * sizeof(std::complex<float>);
+            d_entries.erase(it);
+            d_lru.pop_back();
+        }
+}
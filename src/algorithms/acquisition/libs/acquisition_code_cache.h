@@ -0,0 +1,129 @@
+/*!
+ * \file acquisition_code_cache.h
+ * \brief Process-wide, thread-safe cache of the conjugated FFTs of the local
+ * codes used by the PCPS acquisition blocks.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_CODE_CACHE_H
+#define GNSS_SDR_ACQUISITION_CODE_CACHE_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Least-recently-used cache of code spectra (conjugated FFT of the
+ * sampled local code, as used by the PCPS acquisition), shared by all the
+ * acquisition channels of the receiver.
+ *
+ * Entries are immutable and reference-counted, so a cached spectrum remains
+ * valid for as long as an acquisition block holds it, even if it has been
+ * evicted. The cache is disabled (capacity of zero bytes) by default.
+ */
+class Acquisition_Code_Cache
+{
+public:
+    using Code_Spectrum = volk_gnsssdr::vector<std::complex<float>>;
+
+    /*!
+     * \brief Identifies a code spectrum. The variant field allows adapters to
+     * tell apart codes generated with different options for the same signal
+     * (e.g., pilot or data component, CBOC or sinBOC modulation).
+     */
+    struct Key
+    {
+        char system{'\0'};
+        char signal[2]{'\0', '\0'};
+        uint32_t prn{0};
+        int64_t fs{0};
+        uint32_t fft_size{0};
+        bool bit_transition_flag{false};
+        uint32_t variant{0};
+
+        bool operator<(const Key& other) const
+        {
+            return std::tie(system, signal[0], signal[1], prn, fs, fft_size, bit_transition_flag, variant) <
+                   std::tie(other.system, other.signal[0], other.signal[1], other.prn, other.fs, other.fft_size, other.bit_transition_flag, other.variant);
+        }
+    };
+
+    /*!
+     * \brief Returns the receiver-wide instance.
+     */
+    static Acquisition_Code_Cache& instance();
+
+    /*!
+     * \brief Sets the maximum memory used by the cached spectra, in bytes.
+     * Zero disables the cache and releases all the entries.
+     */
+    void set_capacity(size_t max_bytes);
+
+    /*!
+     * \brief Returns true if the cache accepts entries.
+     */
+    bool enabled() const;
+
+    /*!
+     * \brief Returns the cached spectrum for key, or nullptr if not present.
+     */
+    std::shared_ptr<const Code_Spectrum> find(const Key& key);
+
+    /*!
+     * \brief Stores a spectrum, evicting the least recently used entries if
+     * the memory bound is exceeded.
+     */
+    void insert(const Key& key, std::shared_ptr<const Code_Spectrum> spectrum);
+
+    /*!
+     * \brief Removes all the entries.
+     */
+    void clear();
+
+    size_t size_bytes() const;
+    size_t entries() const;
+    uint64_t hits() const;
+    uint64_t misses() const;
+
+private:
+    using Lru_List = std::list<Key>;
+
+    Acquisition_Code_Cache() = default;
+
+    void evict();
+
+    std::map<Key, std::pair<std::shared_ptr<const Code_Spectrum>, Lru_List::iterator>> d_entries;
+    Lru_List d_lru;  // most recently used at the front
+    mutable std::mutex d_mutex;
+    size_t d_max_bytes{0};
+    size_t d_bytes{0};
+    uint64_t d_hits{0};
+    uint64_t d_misses{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQUISITION_CODE_CACHE_H
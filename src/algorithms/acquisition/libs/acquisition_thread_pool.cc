@@ -0,0 +1,263 @@
+/*!
+ * \file acquisition_thread_pool.cc
+ * \brief Receiver-wide, fixed-size, work-stealing thread pool for
+ * acquisition jobs.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_thread_pool.h"
+#include <algorithm>  // for std::max
+#include <exception>
+#include <utility>  // for std::move
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+Acquisition_Thread_Pool& Acquisition_Thread_Pool::instance()
+{
+    static Acquisition_Thread_Pool pool;
+    return pool;
+}
+
+
+Acquisition_Thread_Pool::~Acquisition_Thread_Pool()
+{
+    stop();
+}
+
+
+void Acquisition_Thread_Pool::start(uint32_t num_threads, size_t max_queued_jobs, const std::vector<int>& cpu_affinity)
+{
+    std::lock_guard<std::mutex> lock(d_control_mutex);
+    if (d_running || num_threads == 0)
+        {
+            return;
+        }
+
+    d_max_queued_jobs = std::max<size_t>(max_queued_jobs, 1);
+    d_reserved_jobs = 0;
+    d_queued_jobs = 0;
+    d_next_queue = 0;
+    d_stopping = false;
+    {
+        std::lock_guard<std::mutex> stats_lock(d_stats_mutex);
+        d_stats = Statistics();
+        d_total_wait_us = 0.0;
+        d_total_run_us = 0.0;
+    }
+
+    d_queues.clear();
+    for (uint32_t i = 0; i < num_threads; i++)
+        {
+            d_queues.push_back(std::make_unique<Worker_Queue>());
+        }
+    for (uint32_t i = 0; i < num_threads; i++)
+        {
+            d_workers.emplace_back(&Acquisition_Thread_Pool::worker_loop, this, i);
+            if (!cpu_affinity.empty())
+                {
+                    set_worker_affinity(d_workers.back(), cpu_affinity);
+                }
+        }
+    d_running = true;
+    LOG(INFO) << "Acquisition thread pool started with " << num_threads << " workers and a queue of " << d_max_queued_jobs << " jobs";
+}
+
+
+void Acquisition_Thread_Pool::stop()
+{
+    std::lock_guard<std::mutex> lock(d_control_mutex);
+    if (!d_running)
+        {
+            return;
+        }
+    d_running = false;
+    {
+        std::lock_guard<std::mutex> wakeup_lock(d_wakeup_mutex);
+        d_stopping = true;
+    }
+    d_wakeup.notify_all();
+    for (auto& worker : d_workers)
+        {
+            if (worker.joinable())
+                {
+                    worker.join();
+                }
+        }
+    d_workers.clear();
+    d_queues.clear();
+
+    const Statistics stats = statistics();
+    LOG(INFO) << "Acquisition thread pool stopped. Jobs executed: " << stats.jobs_executed
+              << ", rejected: " << stats.jobs_rejected
+              << ", stolen: " << stats.jobs_stolen
+              << ", mean / max wait: " << stats.mean_wait_us << " / " << stats.max_wait_us << " [us]"
+              << ", mean / max run: " << stats.mean_run_us << " / " << stats.max_run_us << " [us]";
+}
+
+
+bool Acquisition_Thread_Pool::running() const
+{
+    return d_running.load();
+}
+
+
+bool Acquisition_Thread_Pool::try_submit(Job job)
+{
+    std::lock_guard<std::mutex> lock(d_control_mutex);
+    if (!d_running)
+        {
+            return false;
+        }
+    if (d_reserved_jobs.fetch_add(1) >= d_max_queued_jobs)
+        {
+            d_reserved_jobs--;
+            std::lock_guard<std::mutex> stats_lock(d_stats_mutex);
+            d_stats.jobs_rejected++;
+            return false;
+        }
+
+    auto& queue = *d_queues[d_next_queue.fetch_add(1) % d_queues.size()];
+    {
+        std::lock_guard<std::mutex> queue_lock(queue.mutex);
+        queue.jobs.push_back(Queued_Job{std::move(job), std::chrono::steady_clock::now()});
+    }
+    {
+        std::lock_guard<std::mutex> wakeup_lock(d_wakeup_mutex);
+        d_queued_jobs++;
+    }
+    d_wakeup.notify_one();
+    return true;
+}
+
+
+Acquisition_Thread_Pool::Statistics Acquisition_Thread_Pool::statistics() const
+{
+    std::lock_guard<std::mutex> stats_lock(d_stats_mutex);
+    Statistics stats = d_stats;
+    if (stats.jobs_executed > 0)
+        {
+            stats.mean_wait_us = d_total_wait_us / static_cast<double>(stats.jobs_executed);
+            stats.mean_run_us = d_total_run_us / static_cast<double>(stats.jobs_executed);
+        }
+    return stats;
+}
+
+
+bool Acquisition_Thread_Pool::pop_or_steal(size_t index, Queued_Job& queued_job, bool& stolen)
+{
+    // Own jobs are taken from the front (oldest first)
+    {
+        auto& own_queue = *d_queues[index];
+        std::lock_guard<std::mutex> lock(own_queue.mutex);
+        if (!own_queue.jobs.empty())
+            {
+                queued_job = std::move(own_queue.jobs.front());
+                own_queue.jobs.pop_front();
+                stolen = false;
+                return true;
+            }
+    }
+    // Jobs from other workers are stolen from the back
+    for (size_t i = 1; i < d_queues.size(); i++)
+        {
+            auto& victim = *d_queues[(index + i) % d_queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.jobs.empty())
+                {
+                    queued_job = std::move(victim.jobs.back());
+                    victim.jobs.pop_back();
+                    stolen = true;
+                    return true;
+                }
+        }
+    return false;
+}
+
+
+void Acquisition_Thread_Pool::worker_loop(size_t index)
+{
+    while (true)
+        {
+            Queued_Job queued_job;
+            bool stolen = false;
+            if (pop_or_steal(index, queued_job, stolen))
+                {
+                    d_queued_jobs--;
+                    d_reserved_jobs--;
+                    const auto begin = std::chrono::steady_clock::now();
+                    try
+                        {
+                            queued_job.job();
+                        }
+                    catch (const std::exception& e)
+                        {
+                            LOG(WARNING) << "Exception in acquisition job: " << e.what();
+                        }
+                    const auto end = std::chrono::steady_clock::now();
+
+                    const double wait_us = std::chrono::duration<double, std::micro>(begin - queued_job.submitted).count();
+                    const double run_us = std::chrono::duration<double, std::micro>(end - begin).count();
+                    std::lock_guard<std::mutex> stats_lock(d_stats_mutex);
+                    d_stats.jobs_executed++;
+                    if (stolen)
+                        {
+                            d_stats.jobs_stolen++;
+                        }
+                    d_total_wait_us += wait_us;
+                    d_total_run_us += run_us;
+                    d_stats.max_wait_us = std::max(d_stats.max_wait_us, wait_us);
+                    d_stats.max_run_us = std::max(d_stats.max_run_us, run_us);
+                    continue;
+                }
+
+            std::unique_lock<std::mutex> lock(d_wakeup_mutex);
+            d_wakeup.wait(lock, [this] { return d_queued_jobs.load() > 0 || d_stopping; });
+            if (d_stopping && d_queued_jobs.load() == 0)
+                {
+                    return;
+                }
+        }
+}
+
+
+void Acquisition_Thread_Pool::set_worker_affinity(std::thread& worker, const std::vector<int>& cpu_affinity) const
+{
+#if defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (const auto cpu : cpu_affinity)
+        {
+            if (cpu >= 0 && cpu < CPU_SETSIZE)
+                {
+                    CPU_SET(cpu, &cpuset);
+                }
+        }
+    if (pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set_t), &cpuset) != 0)
+        {
+            LOG(WARNING) << "Unable to set the CPU affinity of the acquisition thread pool";
+        }
+#else
+    (void)worker;
+    (void)cpu_affinity;
+    LOG(WARNING) << "CPU affinity of the acquisition thread pool is not supported in this platform";
+#endif
+}
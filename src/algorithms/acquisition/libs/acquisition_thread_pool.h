@@ -0,0 +1,149 @@
+/*!
+ * \file acquisition_thread_pool.h
+ * \brief Receiver-wide, fixed-size, work-stealing thread pool for
+ * acquisition jobs.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_THREAD_POOL_H
+#define GNSS_SDR_ACQUISITION_THREAD_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Process-wide pool of worker threads that run acquisition jobs
+ * (non-blocking dwells of the acquisition blocks, channel acquisition starts)
+ * submitted by every channel of the receiver.
+ *
+ * Each worker owns a job deque. Submitted jobs are distributed in round-robin
+ * order, workers pop jobs from the front of their own deque and steal from the
+ * back of the other workers' deques when idle. The total number of queued
+ * jobs is bounded: try_submit() returns false if the queue is full, and then
+ * the caller is responsible for running the job by other means.
+ *
+ * The pool is not running unless start() is called, which allows blocks to
+ * fall back to their own threads when it is not in use.
+ */
+class Acquisition_Thread_Pool
+{
+public:
+    using Job = std::function<void()>;
+
+    /*!
+     * \brief Job latency statistics, in microseconds.
+     */
+    struct Statistics
+    {
+        uint64_t jobs_executed{0};
+        uint64_t jobs_rejected{0};
+        uint64_t jobs_stolen{0};
+        double mean_wait_us{0.0};
+        double max_wait_us{0.0};
+        double mean_run_us{0.0};
+        double max_run_us{0.0};
+    };
+
+    /*!
+     * \brief Returns the receiver-wide instance.
+     */
+    static Acquisition_Thread_Pool& instance();
+
+    ~Acquisition_Thread_Pool();
+
+    /*!
+     * \brief Spawns num_threads workers. If cpu_affinity is not empty, the
+     * workers are restricted to that set of cores. Does nothing if the pool is
+     * already running or if num_threads is zero.
+     */
+    void start(uint32_t num_threads, size_t max_queued_jobs, const std::vector<int>& cpu_affinity = {});
+
+    /*!
+     * \brief Waits for all the queued jobs to finish, and joins the workers.
+     */
+    void stop();
+
+    /*!
+     * \brief Returns true if the pool accepts jobs.
+     */
+    bool running() const;
+
+    /*!
+     * \brief Queues a job. Returns false if the pool is not running or if the
+     * job queue is full.
+     */
+    bool try_submit(Job job);
+
+    /*!
+     * \brief Returns the latency statistics of the jobs executed since the
+     * pool was started.
+     */
+    Statistics statistics() const;
+
+private:
+    struct Queued_Job
+    {
+        Job job;
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    struct Worker_Queue
+    {
+        std::mutex mutex;
+        std::deque<Queued_Job> jobs;
+    };
+
+    Acquisition_Thread_Pool() = default;
+
+    void worker_loop(size_t index);
+    bool pop_or_steal(size_t index, Queued_Job& queued_job, bool& stolen);
+    void set_worker_affinity(std::thread& worker, const std::vector<int>& cpu_affinity) const;
+
+    std::vector<std::unique_ptr<Worker_Queue>> d_queues;
+    std::vector<std::thread> d_workers;
+
+    mutable std::mutex d_control_mutex;
+    std::mutex d_wakeup_mutex;
+    std::condition_variable d_wakeup;
+    mutable std::mutex d_stats_mutex;
+    Statistics d_stats;
+    double d_total_wait_us{0.0};
+    double d_total_run_us{0.0};
+
+    std::atomic<size_t> d_reserved_jobs{0};
+    std::atomic<size_t> d_queued_jobs{0};
+    std::atomic<size_t> d_next_queue{0};
+    size_t d_max_queued_jobs{0};
+
+    std::atomic<bool> d_running{false};
+    bool d_stopping{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQUISITION_THREAD_POOL_H
@@ -45,6 +45,7 @@ Channel::Channel(const ConfigurationInterface* configuration,
       role_(role),
       channel_(channel),
       glonass_extend_correlation_ms_(configuration->property("Tracking_1G.extend_correlation_ms", 0) + configuration->property("Tracking_2G.extend_correlation_ms", 0)),
+      trk_bank_port_(0),
       connected_(false),
       repeat_(configuration->property("Acquisition_" + signal_str + ".repeat_satellite", false)),
       flag_enable_fpga_(configuration->property("GNSS-SDR.enable_FPGA", false))
@@ -135,10 +136,10 @@ void Channel::connect(gr::top_block_sptr top_block)
     nav_->connect(top_block);
 
     // Synchronous ports
-    top_block->connect(trk_->get_right_block(), 0, nav_->get_left_block(), 0);
+    top_block->connect(get_right_block_trk(), trk_bank_port_, nav_->get_left_block(), 0);
 
     // Message ports
-    top_block->msg_connect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), trk_->get_right_block(), pmt::mp("telemetry_to_trk"));
+    top_block->msg_connect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), get_right_block_trk(), tracking_msg_port("telemetry_to_trk"));
     if (glonass_dll_pll_c_aid_tracking_check())
         {
             top_block->msg_connect(nav_->get_left_block(), pmt::mp("preamble_timestamp_samples"), trk_->get_right_block(), pmt::mp("preamble_timestamp_samples"));
@@ -150,7 +151,7 @@ void Channel::connect(gr::top_block_sptr top_block)
         {
             top_block->msg_connect(acq_->get_right_block(), pmt::mp("events"), channel_msg_rx_, pmt::mp("events"));
         }
-    top_block->msg_connect(trk_->get_right_block(), pmt::mp("events"), channel_msg_rx_, pmt::mp("events"));
+    top_block->msg_connect(get_right_block_trk(), tracking_msg_port("events"), channel_msg_rx_, pmt::mp("events"));
 
     connected_ = true;
 }
@@ -164,7 +165,7 @@ void Channel::disconnect(gr::top_block_sptr top_block)
             return;
         }
 
-    top_block->disconnect(trk_->get_right_block(), 0, nav_->get_left_block(), 0);
+    top_block->disconnect(get_right_block_trk(), trk_bank_port_, nav_->get_left_block(), 0);
     if (!flag_enable_fpga_)
         {
             acq_->disconnect(top_block);
@@ -172,7 +173,7 @@ void Channel::disconnect(gr::top_block_sptr top_block)
     trk_->disconnect(top_block);
     nav_->disconnect(top_block);
 
-    top_block->msg_disconnect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), trk_->get_right_block(), pmt::mp("telemetry_to_trk"));
+    top_block->msg_disconnect(nav_->get_left_block(), pmt::mp("telemetry_to_trk"), get_right_block_trk(), tracking_msg_port("telemetry_to_trk"));
     if (glonass_dll_pll_c_aid_tracking_check())
         {
             top_block->msg_disconnect(nav_->get_left_block(), pmt::mp("preamble_timestamp_samples"), trk_->get_right_block(), pmt::mp("preamble_timestamp_samples"));
@@ -181,7 +182,7 @@ void Channel::disconnect(gr::top_block_sptr top_block)
         {
             top_block->msg_disconnect(acq_->get_right_block(), pmt::mp("events"), channel_msg_rx_, pmt::mp("events"));
         }
-    top_block->msg_disconnect(trk_->get_right_block(), pmt::mp("events"), channel_msg_rx_, pmt::mp("events"));
+    top_block->msg_disconnect(get_right_block_trk(), tracking_msg_port("events"), channel_msg_rx_, pmt::mp("events"));
     connected_ = false;
 }
 
@@ -193,14 +194,40 @@ gr::basic_block_sptr Channel::get_left_block()
 }
 
 
+void Channel::set_tracking_bank(const gr::basic_block_sptr& bank, int32_t port)
+{
+    trk_bank_ = bank;
+    trk_bank_port_ = port;
+}
+
+
+pmt::pmt_t Channel::tracking_msg_port(const std::string& name) const
+{
+    // Banked channels use the ports of the bank named after their output port
+    if (trk_bank_)
+        {
+            return pmt::mp(name + "_" + std::to_string(trk_bank_port_));
+        }
+    return pmt::mp(name);
+}
+
+
 gr::basic_block_sptr Channel::get_left_block_trk()
 {
+    if (trk_bank_)
+        {
+            return trk_bank_;
+        }
     return trk_->get_left_block();
 }
 
 
 gr::basic_block_sptr Channel::get_right_block_trk()
 {
+    if (trk_bank_)
+        {
+            return trk_bank_;
+        }
     return trk_->get_right_block();
 }
 
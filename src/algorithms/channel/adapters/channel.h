@@ -91,23 +91,34 @@ public:
 
     void assist_acquisition_doppler(double Carrier_Doppler_hz) override;
 
+    /*!
+     * \brief Makes the tracking of this channel run in the given output port
+     * of a tracking bank block instead of in its own tracking block.
+     * Must be called before connect().
+     */
+    void set_tracking_bank(const gr::basic_block_sptr& bank, int32_t port);
+    inline int32_t get_right_block_trk_port() const { return trk_bank_port_; }  //!< Output port of get_right_block_trk()
+
     inline std::shared_ptr<AcquisitionInterface> acquisition() const { return acq_; }
     inline std::shared_ptr<TrackingInterface> tracking() const { return trk_; }
     inline std::shared_ptr<TelemetryDecoderInterface> telemetry() const { return nav_; }
 
 private:
     bool glonass_dll_pll_c_aid_tracking_check() const;
+    pmt::pmt_t tracking_msg_port(const std::string& name) const;
     std::shared_ptr<ChannelFsm> channel_fsm_;
     std::shared_ptr<AcquisitionInterface> acq_;
     std::shared_ptr<TrackingInterface> trk_;
     std::shared_ptr<TelemetryDecoderInterface> nav_;
     channel_msg_receiver_cc_sptr channel_msg_rx_;
+    gr::basic_block_sptr trk_bank_;
     Gnss_Synchro gnss_synchro_{};
     Gnss_Signal gnss_signal_;
     std::string role_;
     std::mutex mx_;
     uint32_t channel_;
     int glonass_extend_correlation_ms_;
+    int32_t trk_bank_port_;
     bool connected_;
     bool repeat_;
     bool flag_enable_fpga_;
@@ -0,0 +1,320 @@
+/*!
+ * \file fixed_kalman_filter.h
+ * \brief Linear Kalman filter with dimensions known at compile time
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FIXED_KALMAN_FILTER_H
+#define GNSS_SDR_FIXED_KALMAN_FILTER_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Linear Kalman filter with NX states and NZ measurements.
+ *
+ * All the matrices are stored in fixed-size arrays (row-major), so the filter
+ * does not allocate memory and the compiler can unroll its loops. The
+ * covariance matrix is updated in Joseph form, which keeps it symmetric and
+ * positive definite in the presence of rounding errors.
+ */
+template <std::size_t NX, std::size_t NZ>
+class Fixed_Kalman_Filter
+{
+public:
+    using State = std::array<double, NX>;
+    using Measurement = std::array<double, NZ>;
+    using Matrix_XX = std::array<std::array<double, NX>, NX>;
+    using Matrix_ZX = std::array<std::array<double, NX>, NZ>;
+    using Matrix_XZ = std::array<std::array<double, NZ>, NX>;
+    using Matrix_ZZ = std::array<std::array<double, NZ>, NZ>;
+
+    /*!
+     * \brief Prediction: x = F x, P = F P F' + Q
+     */
+    void predict()
+    {
+        State x_new{};
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t k = 0; k < NX; k++)
+                    {
+                        x_new[i] += F[i][k] * x[k];
+                    }
+            }
+        x = x_new;
+        P = propagate(P);
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NX; j++)
+                    {
+                        P[i][j] += Q[i][j];
+                    }
+            }
+    }
+
+    /*!
+     * \brief Measurement update with the measurement z, using the innovation
+     * z - H x. Returns false, leaving the filter unchanged, if the innovation
+     * covariance is singular.
+     */
+    bool update(const Measurement& z)
+    {
+        Measurement y = z;
+        for (std::size_t i = 0; i < NZ; i++)
+            {
+                for (std::size_t k = 0; k < NX; k++)
+                    {
+                        y[i] -= H[i][k] * x[k];
+                    }
+            }
+        return update_innovation(y);
+    }
+
+    /*!
+     * \brief Measurement update with an innovation y computed by the caller
+     * (e.g., the output of a discriminator). Returns false, leaving the filter
+     * unchanged, if the innovation covariance is singular.
+     */
+    bool update_innovation(const Measurement& y)
+    {
+        // PHt = P H'
+        Matrix_XZ PHt{};
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NZ; j++)
+                    {
+                        for (std::size_t k = 0; k < NX; k++)
+                            {
+                                PHt[i][j] += P[i][k] * H[j][k];
+                            }
+                    }
+            }
+        // S = H P H' + R
+        Matrix_ZZ S = R;
+        for (std::size_t i = 0; i < NZ; i++)
+            {
+                for (std::size_t j = 0; j < NZ; j++)
+                    {
+                        for (std::size_t k = 0; k < NX; k++)
+                            {
+                                S[i][j] += H[i][k] * PHt[k][j];
+                            }
+                    }
+            }
+        Matrix_ZZ S_inv{};
+        if (!invert(S, S_inv))
+            {
+                return false;
+            }
+        // Kalman gain K = P H' S^-1
+        Matrix_XZ K{};
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NZ; j++)
+                    {
+                        for (std::size_t k = 0; k < NZ; k++)
+                            {
+                                K[i][j] += PHt[i][k] * S_inv[k][j];
+                            }
+                    }
+            }
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t k = 0; k < NZ; k++)
+                    {
+                        x[i] += K[i][k] * y[k];
+                    }
+            }
+        // Joseph form: P = (I - K H) P (I - K H)' + K R K'
+        Matrix_XX A{};
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NX; j++)
+                    {
+                        double kh = 0.0;
+                        for (std::size_t k = 0; k < NZ; k++)
+                            {
+                                kh += K[i][k] * H[k][j];
+                            }
+                        A[i][j] = (i == j ? 1.0 : 0.0) - kh;
+                    }
+            }
+        P = similarity(A, P);
+        Matrix_XZ KR{};
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NZ; j++)
+                    {
+                        for (std::size_t k = 0; k < NZ; k++)
+                            {
+                                KR[i][j] += K[i][k] * R[k][j];
+                            }
+                    }
+            }
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NX; j++)
+                    {
+                        for (std::size_t k = 0; k < NZ; k++)
+                            {
+                                P[i][j] += KR[i][k] * K[j][k];
+                            }
+                    }
+            }
+        // remove the asymmetry left by rounding
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = i + 1; j < NX; j++)
+                    {
+                        const double p = 0.5 * (P[i][j] + P[j][i]);
+                        P[i][j] = p;
+                        P[j][i] = p;
+                    }
+            }
+        return true;
+    }
+
+    /*!
+     * \brief Returns F M F'
+     */
+    Matrix_XX propagate(const Matrix_XX& M) const
+    {
+        return similarity(F, M);
+    }
+
+    /*!
+     * \brief Returns A M A'
+     */
+    static Matrix_XX similarity(const Matrix_XX& A, const Matrix_XX& M)
+    {
+        Matrix_XX AM{};
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NX; j++)
+                    {
+                        for (std::size_t k = 0; k < NX; k++)
+                            {
+                                AM[i][j] += A[i][k] * M[k][j];
+                            }
+                    }
+            }
+        Matrix_XX AMAt{};
+        for (std::size_t i = 0; i < NX; i++)
+            {
+                for (std::size_t j = 0; j < NX; j++)
+                    {
+                        for (std::size_t k = 0; k < NX; k++)
+                            {
+                                AMAt[i][j] += AM[i][k] * A[j][k];
+                            }
+                    }
+            }
+        return AMAt;
+    }
+
+    Matrix_XX F{};  //!< State transition matrix
+    Matrix_ZX H{};  //!< Measurement matrix
+    Matrix_ZZ R{};  //!< Measurement noise covariance matrix
+    Matrix_XX Q{};  //!< Process noise covariance matrix
+    Matrix_XX P{};  //!< State covariance matrix
+    State x{};      //!< State vector
+
+private:
+    static bool invert(const std::array<std::array<double, 1>, 1>& S, std::array<std::array<double, 1>, 1>& S_inv)
+    {
+        if (S[0][0] == 0.0 || !std::isfinite(S[0][0]))
+            {
+                return false;
+            }
+        S_inv[0][0] = 1.0 / S[0][0];
+        return true;
+    }
+
+    static bool invert(const std::array<std::array<double, 2>, 2>& S, std::array<std::array<double, 2>, 2>& S_inv)
+    {
+        const double det = S[0][0] * S[1][1] - S[0][1] * S[1][0];
+        if (det == 0.0 || !std::isfinite(det))
+            {
+                return false;
+            }
+        const double inv_det = 1.0 / det;
+        S_inv[0][0] = S[1][1] * inv_det;
+        S_inv[0][1] = -S[0][1] * inv_det;
+        S_inv[1][0] = -S[1][0] * inv_det;
+        S_inv[1][1] = S[0][0] * inv_det;
+        return true;
+    }
+
+    // Gauss-Jordan elimination with partial pivoting
+    template <std::size_t N>
+    static bool invert(const std::array<std::array<double, N>, N>& S, std::array<std::array<double, N>, N>& S_inv)
+    {
+        std::array<std::array<double, N>, N> A = S;
+        for (std::size_t i = 0; i < N; i++)
+            {
+                for (std::size_t j = 0; j < N; j++)
+                    {
+                        S_inv[i][j] = (i == j ? 1.0 : 0.0);
+                    }
+            }
+        for (std::size_t c = 0; c < N; c++)
+            {
+                std::size_t pivot = c;
+                for (std::size_t r = c + 1; r < N; r++)
+                    {
+                        if (std::fabs(A[r][c]) > std::fabs(A[pivot][c]))
+                            {
+                                pivot = r;
+                            }
+                    }
+                if (A[pivot][c] == 0.0 || !std::isfinite(A[pivot][c]))
+                    {
+                        return false;
+                    }
+                std::swap(A[c], A[pivot]);
+                std::swap(S_inv[c], S_inv[pivot]);
+                const double inv_pivot = 1.0 / A[c][c];
+                for (std::size_t j = 0; j < N; j++)
+                    {
+                        A[c][j] *= inv_pivot;
+                        S_inv[c][j] *= inv_pivot;
+                    }
+                for (std::size_t r = 0; r < N; r++)
+                    {
+                        if (r != c)
+                            {
+                                const double f = A[r][c];
+                                for (std::size_t j = 0; j < N; j++)
+                                    {
+                                        A[r][j] -= f * A[c][j];
+                                        S_inv[r][j] -= f * S_inv[c][j];
+                                    }
+                            }
+                    }
+            }
+        return true;
+    }
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FIXED_KALMAN_FILTER_H
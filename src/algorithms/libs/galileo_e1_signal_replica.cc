@@ -18,6 +18,7 @@
 
 #include "galileo_e1_signal_replica.h"
 #include "Galileo_E1.h"
+#include "gnss_packed_code.h"
 #include "gnss_signal_replica.h"
 #include <cmath>
 #include <cstddef>  // for size_t
@@ -27,33 +28,42 @@
 #include <vector>
 
 
-void galileo_e1_code_gen_int(own::span<int> dest, const std::array<char, 3>& signal_id, int32_t prn)
+namespace
 {
-    const std::string galileo_signal = signal_id.data();
-    const int32_t prn_ = prn - 1;
-    int32_t index = 0;
+constexpr auto GALILEO_E1_B_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E1_B_PRIMARY_CODE);
+constexpr auto GALILEO_E1_C_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E1_C_PRIMARY_CODE);
+}  // namespace
+
 
-    // A simple error check
-    if ((prn < 1) || (prn > 50))
+own::span<const uint32_t> galileo_e1_packed_primary_code(const std::array<char, 3>& signal_id, int32_t prn)
+{
+    if ((prn < 1) || (prn > 50) || signal_id[0] != '1')
         {
-            return;
+            return {};
         }
+    if (signal_id[1] == 'B')
+        {
+            return GALILEO_E1_B_PACKED_PRIMARY_CODE.code(prn - 1);
+        }
+    if (signal_id[1] == 'C')
+        {
+            return GALILEO_E1_C_PACKED_PRIMARY_CODE.code(prn - 1);
+        }
+    return {};
+}
 
-    if (galileo_signal.rfind("1B") != std::string::npos && galileo_signal.length() >= 2)
+
+void galileo_e1_code_gen_int(own::span<int> dest, const std::array<char, 3>& signal_id, int32_t prn)
+{
+    const auto code = galileo_e1_packed_primary_code(signal_id, prn);
+    if (code.empty())
         {
-            for (size_t i = 0; i < GALILEO_E1_B_PRIMARY_CODE_STR_LENGTH; i++)
-                {
-                    hex_to_binary_converter(dest.subspan(index, 4), GALILEO_E1_B_PRIMARY_CODE[prn_][i]);
-                    index += 4;
-                }
+            return;
         }
-    else if (galileo_signal.rfind("1C") != std::string::npos && galileo_signal.length() >= 2)
+    constexpr auto codeLength = static_cast<uint32_t>(GALILEO_E1_B_CODE_LENGTH_CHIPS);
+    for (uint32_t i = 0; i < codeLength; i++)
         {
-            for (size_t i = 0; i < GALILEO_E1_C_PRIMARY_CODE_STR_LENGTH; i++)
-                {
-                    hex_to_binary_converter(dest.subspan(index, 4), GALILEO_E1_C_PRIMARY_CODE[prn_][i]);
-                    index += 4;
-                }
+            dest[i] = packed_code_chip(code, i);
         }
 }
 
@@ -36,6 +36,12 @@ namespace own = gsl;
  * \{ */
 
 
+/*!
+ * \brief Galileo E1B or E1C primary code packed one bit per chip (see
+ * gnss_packed_code.h). Returns an empty span for unknown signals or PRNs.
+ */
+own::span<const uint32_t> galileo_e1_packed_primary_code(const std::array<char, 3>& signal_id, int32_t prn);
+
 /*!
  * \brief This function generates Galileo E1 code (can select E1B or E1C sinboc).
  *
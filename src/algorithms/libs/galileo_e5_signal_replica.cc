@@ -21,6 +21,7 @@
 #include "galileo_e5_signal_replica.h"
 #include "Galileo_E5a.h"
 #include "Galileo_E5b.h"
+#include "gnss_packed_code.h"
 #include "gnss_signal_replica.h"
 #include <gnuradio/gr_complex.h>
 #include <memory>
@@ -28,67 +29,67 @@
 #include <vector>
 
 
+namespace
+{
+constexpr auto GALILEO_E5A_I_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E5A_I_PRIMARY_CODE);
+constexpr auto GALILEO_E5A_Q_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E5A_Q_PRIMARY_CODE);
+constexpr auto GALILEO_E5B_I_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E5B_I_PRIMARY_CODE);
+constexpr auto GALILEO_E5B_Q_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E5B_Q_PRIMARY_CODE);
+
+
+// Writes the chips of code_real in the real part and the chips of code_imag
+// (if any) in the imaginary part
+void packed_codes_to_complex(own::span<std::complex<float>> dest,
+    own::span<const uint32_t> code_real,
+    own::span<const uint32_t> code_imag,
+    uint32_t code_length)
+{
+    if (code_real.empty())
+        {
+            return;
+        }
+    for (uint32_t i = 0; i < code_length; i++)
+        {
+            dest[i] = std::complex<float>(static_cast<float>(packed_code_chip(code_real, i)),
+                code_imag.empty() ? 0.0F : static_cast<float>(packed_code_chip(code_imag, i)));
+        }
+}
+}  // namespace
+
+
+own::span<const uint32_t> galileo_e5_a_packed_primary_code(const std::array<char, 3>& signal_id, int32_t prn)
+{
+    if ((prn < 1) || (prn > 50) || signal_id[0] != '5')
+        {
+            return {};
+        }
+    if (signal_id[1] == 'I')
+        {
+            return GALILEO_E5A_I_PACKED_PRIMARY_CODE.code(prn - 1);
+        }
+    if (signal_id[1] == 'Q')
+        {
+            return GALILEO_E5A_Q_PACKED_PRIMARY_CODE.code(prn - 1);
+        }
+    return {};
+}
+
+
 void galileo_e5_a_code_gen_complex_primary(own::span<std::complex<float>> dest,
     int32_t prn,
     const std::array<char, 3>& signal_id)
 {
-    const uint32_t prn_ = prn - 1;
-    uint32_t index = 0;
-    std::array<int32_t, 4> a{};
-    if ((prn < 1) || (prn > 50))
+    if (signal_id[0] == '5' && signal_id[1] == 'X')
         {
-            return;
+            // data component in phase, pilot component in quadrature
+            packed_codes_to_complex(dest,
+                galileo_e5_a_packed_primary_code({'5', 'I', '\0'}, prn),
+                galileo_e5_a_packed_primary_code({'5', 'Q', '\0'}, prn),
+                GALILEO_E5A_CODE_LENGTH_CHIPS);
         }
-    if (signal_id[0] == '5' && signal_id[1] == 'Q')
-        {
-            for (size_t i = 0; i < GALILEO_E5A_Q_PRIMARY_CODE_STR_LENGTH - 1; i++)
-                {
-                    hex_to_binary_converter(a, GALILEO_E5A_Q_PRIMARY_CODE[prn_][i]);
-                    dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-                    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-                    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
-                    dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), 0.0);
-                    index = index + 4;
-                }
-            // last 2 bits are filled up zeros
-            hex_to_binary_converter(a, GALILEO_E5A_Q_PRIMARY_CODE[prn_][GALILEO_E5A_Q_PRIMARY_CODE_STR_LENGTH - 1]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-        }
-    else if (signal_id[0] == '5' && signal_id[1] == 'I')
-        {
-            for (size_t i = 0; i < GALILEO_E5A_I_PRIMARY_CODE_STR_LENGTH - 1; i++)
-                {
-                    hex_to_binary_converter(a, GALILEO_E5A_I_PRIMARY_CODE[prn_][i]);
-                    dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-                    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-                    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
-                    dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), 0.0);
-                    index = index + 4;
-                }
-            // last 2 bits are filled up zeros
-            hex_to_binary_converter(a, GALILEO_E5A_I_PRIMARY_CODE[prn_][GALILEO_E5A_I_PRIMARY_CODE_STR_LENGTH - 1]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-        }
-    else if (signal_id[0] == '5' && signal_id[1] == 'X')
-        {
-            std::array<int32_t, 4> b{};
-            for (size_t i = 0; i < GALILEO_E5A_I_PRIMARY_CODE_STR_LENGTH - 1; i++)
-                {
-                    hex_to_binary_converter(a, GALILEO_E5A_I_PRIMARY_CODE[prn_][i]);
-                    hex_to_binary_converter(b, GALILEO_E5A_Q_PRIMARY_CODE[prn_][i]);
-                    dest[index] = std::complex<float>(static_cast<float>(a[0]), static_cast<float>(b[0]));
-                    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), static_cast<float>(b[1]));
-                    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), static_cast<float>(b[2]));
-                    dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), static_cast<float>(b[3]));
-                    index = index + 4;
-                }
-            // last 2 bits are filled up zeros
-            hex_to_binary_converter(a, GALILEO_E5A_I_PRIMARY_CODE[prn_][GALILEO_E5A_I_PRIMARY_CODE_STR_LENGTH - 1]);
-            hex_to_binary_converter(b, GALILEO_E5A_Q_PRIMARY_CODE[prn_][GALILEO_E5A_Q_PRIMARY_CODE_STR_LENGTH - 1]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), static_cast<float>(b[0]));
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), static_cast<float>(b[1]));
+    else
+        {
+            packed_codes_to_complex(dest, galileo_e5_a_packed_primary_code(signal_id, prn), {}, GALILEO_E5A_CODE_LENGTH_CHIPS);
         }
 }
 
@@ -122,67 +123,39 @@ void galileo_e5_a_code_gen_complex_sampled(own::span<std::complex<float>> dest,
 }
 
 
+own::span<const uint32_t> galileo_e5_b_packed_primary_code(const std::array<char, 3>& signal_id, int32_t prn)
+{
+    if ((prn < 1) || (prn > 50) || signal_id[0] != '7')
+        {
+            return {};
+        }
+    if (signal_id[1] == 'I')
+        {
+            return GALILEO_E5B_I_PACKED_PRIMARY_CODE.code(prn - 1);
+        }
+    if (signal_id[1] == 'Q')
+        {
+            return GALILEO_E5B_Q_PACKED_PRIMARY_CODE.code(prn - 1);
+        }
+    return {};
+}
+
+
 void galileo_e5_b_code_gen_complex_primary(own::span<std::complex<float>> dest,
     int32_t prn,
     const std::array<char, 3>& signal_id)
 {
-    const uint32_t prn_ = prn - 1;
-    uint32_t index = 0;
-    std::array<int32_t, 4> a{};
-    if ((prn < 1) || (prn > 50))
+    if (signal_id[0] == '7' && signal_id[1] == 'X')
         {
-            return;
+            // data component in phase, pilot component in quadrature
+            packed_codes_to_complex(dest,
+                galileo_e5_b_packed_primary_code({'7', 'I', '\0'}, prn),
+                galileo_e5_b_packed_primary_code({'7', 'Q', '\0'}, prn),
+                GALILEO_E5B_CODE_LENGTH_CHIPS);
         }
-    if (signal_id[0] == '7' && signal_id[1] == 'Q')
-        {
-            for (size_t i = 0; i < GALILEO_E5B_Q_PRIMARY_CODE_STR_LENGTH - 1; i++)
-                {
-                    hex_to_binary_converter(a, GALILEO_E5B_Q_PRIMARY_CODE[prn_][i]);
-                    dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-                    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-                    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
-                    dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), 0.0);
-                    index = index + 4;
-                }
-            // last 2 bits are filled up zeros
-            hex_to_binary_converter(a, GALILEO_E5B_Q_PRIMARY_CODE[prn_][GALILEO_E5B_Q_PRIMARY_CODE_STR_LENGTH - 1]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-        }
-    else if (signal_id[0] == '7' && signal_id[1] == 'I')
-        {
-            for (size_t i = 0; i < GALILEO_E5B_I_PRIMARY_CODE_STR_LENGTH - 1; i++)
-                {
-                    hex_to_binary_converter(a, GALILEO_E5B_I_PRIMARY_CODE[prn_][i]);
-                    dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-                    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-                    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
-                    dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), 0.0);
-                    index = index + 4;
-                }
-            // last 2 bits are filled up zeros
-            hex_to_binary_converter(a, GALILEO_E5B_I_PRIMARY_CODE[prn_][GALILEO_E5B_I_PRIMARY_CODE_STR_LENGTH - 1]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-        }
-    else if (signal_id[0] == '7' && signal_id[1] == 'X')
-        {
-            std::array<int32_t, 4> b{};
-            for (size_t i = 0; i < GALILEO_E5B_I_PRIMARY_CODE_STR_LENGTH - 1; i++)
-                {
-                    hex_to_binary_converter(a, GALILEO_E5B_I_PRIMARY_CODE[prn_][i]);
-                    hex_to_binary_converter(b, GALILEO_E5B_Q_PRIMARY_CODE[prn_][i]);
-                    dest[index] = std::complex<float>(static_cast<float>(a[0]), static_cast<float>(b[0]));
-                    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), static_cast<float>(b[1]));
-                    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), static_cast<float>(b[2]));
-                    dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), static_cast<float>(b[3]));
-                    index = index + 4;
-                }
-            // last 2 bits are filled up zeros
-            hex_to_binary_converter(a, GALILEO_E5B_I_PRIMARY_CODE[prn_][GALILEO_E5B_I_PRIMARY_CODE_STR_LENGTH - 1]);
-            hex_to_binary_converter(b, GALILEO_E5B_Q_PRIMARY_CODE[prn_][GALILEO_E5B_Q_PRIMARY_CODE_STR_LENGTH - 1]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), static_cast<float>(b[0]));
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), static_cast<float>(b[1]));
+    else
+        {
+            packed_codes_to_complex(dest, galileo_e5_b_packed_primary_code(signal_id, prn), {}, GALILEO_E5B_CODE_LENGTH_CHIPS);
         }
 }
 
@@ -214,3 +187,23 @@ void galileo_e5_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
             dest[(i + delay) % samplesPerCode] = code_aux[i];
         }
 }
+
+
+void galileo_e5_component_code_gen_float(own::span<float> dest,
+    uint32_t prn,
+    char band,
+    bool pilot)
+{
+    const std::array<char, 3> signal_id = {{band, pilot ? 'Q' : 'I', '\0'}};
+    const auto code = (band == '5') ? galileo_e5_a_packed_primary_code(signal_id, static_cast<int32_t>(prn))
+                                    : galileo_e5_b_packed_primary_code(signal_id, static_cast<int32_t>(prn));
+    const auto code_length = static_cast<uint32_t>((band == '5') ? GALILEO_E5A_CODE_LENGTH_CHIPS : GALILEO_E5B_CODE_LENGTH_CHIPS);
+    if (code.empty())
+        {
+            return;
+        }
+    for (uint32_t i = 0; i < code_length; i++)
+        {
+            dest[i] = static_cast<float>(packed_code_chip(code, i));
+        }
+}
@@ -38,6 +38,14 @@ namespace own = gsl;
  * \{ */
 
 
+/*!
+ * \brief Galileo E5a-I ("5I") or E5a-Q ("5Q") primary code packed one
+ * bit per chip (see gnss_packed_code.h). Returns an empty span for other
+ * signals or unknown PRNs.
+ */
+own::span<const uint32_t> galileo_e5_a_packed_primary_code(const std::array<char, 3>& signal_id, int32_t prn);
+
+
 /*!
  * \brief Generates Galileo E5a code at 1 sample/chip
  */
@@ -57,6 +65,14 @@ void galileo_e5_a_code_gen_complex_sampled(own::span<std::complex<float>> dest,
     uint32_t chip_shift);
 
 
+/*!
+ * \brief Galileo E5b-I ("7I") or E5b-Q ("7Q") primary code packed one
+ * bit per chip (see gnss_packed_code.h). Returns an empty span for other
+ * signals or unknown PRNs.
+ */
+own::span<const uint32_t> galileo_e5_b_packed_primary_code(const std::array<char, 3>& signal_id, int32_t prn);
+
+
 /*!
  * \brief Generates Galileo E5b code at 1 sample/chip
  */
@@ -76,6 +92,16 @@ void galileo_e5_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
     uint32_t chip_shift);
 
 
+/*!
+ * \brief Generates the data (in-phase) or pilot (quadrature) component of the
+ * Galileo E5a (band = '5') or E5b (band = '7') primary code at 1 sample/chip
+ */
+void galileo_e5_component_code_gen_float(own::span<float> dest,
+    uint32_t prn,
+    char band,
+    bool pilot);
+
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_GALILEO_E5_SIGNAL_REPLICA_H
@@ -19,62 +19,67 @@
 
 #include "galileo_e6_signal_replica.h"
 #include "Galileo_E6.h"
+#include "gnss_packed_code.h"
 #include "gnss_signal_replica.h"
 #include <utility>
 #include <vector>
 
+
+namespace
+{
+constexpr auto GALILEO_E6_B_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E6_B_PRIMARY_CODE);
+constexpr auto GALILEO_E6_C_PACKED_PRIMARY_CODE = pack_hex_codes(GALILEO_E6_C_PRIMARY_CODE);
+}  // namespace
+
+
+own::span<const uint32_t> galileo_e6_b_packed_primary_code(int32_t prn)
+{
+    if ((prn < 1) || (prn > 50))
+        {
+            return {};
+        }
+    return GALILEO_E6_B_PACKED_PRIMARY_CODE.code(prn - 1);
+}
+
+
+own::span<const uint32_t> galileo_e6_c_packed_primary_code(int32_t prn)
+{
+    if ((prn < 1) || (prn > 50))
+        {
+            return {};
+        }
+    return GALILEO_E6_C_PACKED_PRIMARY_CODE.code(prn - 1);
+}
+
+
 void galileo_e6_b_code_gen_complex_primary(own::span<std::complex<float>> dest,
     int32_t prn)
 {
-    const uint32_t prn_ = prn - 1;
-    uint32_t index = 0;
-    std::array<int32_t, 4> a{};
-    if ((prn < 1) || (prn > 50))
+    const auto code = galileo_e6_b_packed_primary_code(prn);
+    if (code.empty())
         {
             return;
         }
-
-    for (size_t i = 0; i < GALILEO_E6_B_PRIMARY_CODE_STR_LENGTH - 1; i++)
+    constexpr auto codeLength = static_cast<uint32_t>(GALILEO_E6_B_CODE_LENGTH_CHIPS);
+    for (uint32_t i = 0; i < codeLength; i++)
         {
-            hex_to_binary_converter(a, GALILEO_E6_B_PRIMARY_CODE[prn_][i]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-            dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
-            dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), 0.0);
-            index = index + 4;
+            dest[i] = std::complex<float>(static_cast<float>(packed_code_chip(code, i)), 0.0);
         }
-    // last bit is filled up with a zero
-    hex_to_binary_converter(a, GALILEO_E6_B_PRIMARY_CODE[prn_][GALILEO_E6_B_PRIMARY_CODE_STR_LENGTH - 1]);
-    dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
 }
 
 
 void galileo_e6_b_code_gen_float_primary(own::span<float> dest, int32_t prn)
 {
-    const uint32_t prn_ = prn - 1;
-    uint32_t index = 0;
-    std::array<int32_t, 4> a{};
-    if ((prn < 1) || (prn > 50))
+    const auto code = galileo_e6_b_packed_primary_code(prn);
+    if (code.empty())
         {
             return;
         }
-
-    for (size_t i = 0; i < GALILEO_E6_B_PRIMARY_CODE_STR_LENGTH - 1; i++)
+    constexpr auto codeLength = static_cast<uint32_t>(GALILEO_E6_B_CODE_LENGTH_CHIPS);
+    for (uint32_t i = 0; i < codeLength; i++)
         {
-            hex_to_binary_converter(a, GALILEO_E6_B_PRIMARY_CODE[prn_][i]);
-            dest[index] = static_cast<float>(a[0]);
-            dest[index + 1] = static_cast<float>(a[1]);
-            dest[index + 2] = static_cast<float>(a[2]);
-            dest[index + 3] = static_cast<float>(a[3]);
-            index = index + 4;
+            dest[i] = static_cast<float>(packed_code_chip(code, i));
         }
-    // last bit is filled up with a zero
-    hex_to_binary_converter(a, GALILEO_E6_B_PRIMARY_CODE[prn_][GALILEO_E6_B_PRIMARY_CODE_STR_LENGTH - 1]);
-    dest[index] = static_cast<float>(a[0]);
-    dest[index + 1] = static_cast<float>(a[1]);
-    dest[index + 2] = static_cast<float>(a[2]);
 }
 
 
@@ -109,53 +114,31 @@ void galileo_e6_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
 void galileo_e6_c_code_gen_complex_primary(own::span<std::complex<float>> dest,
     int32_t prn)
 {
-    const uint32_t prn_ = prn - 1;
-    uint32_t index = 0;
-    std::array<int32_t, 4> a{};
-    if ((prn < 1) || (prn > 50))
+    const auto code = galileo_e6_c_packed_primary_code(prn);
+    if (code.empty())
         {
             return;
         }
-    for (size_t i = 0; i < GALILEO_E6_C_PRIMARY_CODE_STR_LENGTH - 1; i++)
+    constexpr auto codeLength = static_cast<uint32_t>(GALILEO_E6_C_CODE_LENGTH_CHIPS);
+    for (uint32_t i = 0; i < codeLength; i++)
         {
-            hex_to_binary_converter(a, GALILEO_E6_C_PRIMARY_CODE[prn_][i]);
-            dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-            dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-            dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
-            dest[index + 3] = std::complex<float>(static_cast<float>(a[3]), 0.0);
-            index = index + 4;
+            dest[i] = std::complex<float>(static_cast<float>(packed_code_chip(code, i)), 0.0);
         }
-    // last bit is filled up with a zero
-    hex_to_binary_converter(a, GALILEO_E6_C_PRIMARY_CODE[prn_][GALILEO_E6_C_PRIMARY_CODE_STR_LENGTH - 1]);
-    dest[index] = std::complex<float>(static_cast<float>(a[0]), 0.0);
-    dest[index + 1] = std::complex<float>(static_cast<float>(a[1]), 0.0);
-    dest[index + 2] = std::complex<float>(static_cast<float>(a[2]), 0.0);
 }
 
 
 void galileo_e6_c_code_gen_float_primary(own::span<float> dest, int32_t prn)
 {
-    const uint32_t prn_ = prn - 1;
-    uint32_t index = 0;
-    std::array<int32_t, 4> a{};
-    if ((prn < 1) || (prn > 50))
+    const auto code = galileo_e6_c_packed_primary_code(prn);
+    if (code.empty())
         {
             return;
         }
-    for (size_t i = 0; i < GALILEO_E6_C_PRIMARY_CODE_STR_LENGTH - 1; i++)
+    constexpr auto codeLength = static_cast<uint32_t>(GALILEO_E6_C_CODE_LENGTH_CHIPS);
+    for (uint32_t i = 0; i < codeLength; i++)
         {
-            hex_to_binary_converter(a, GALILEO_E6_C_PRIMARY_CODE[prn_][i]);
-            dest[index] = static_cast<float>(a[0]);
-            dest[index + 1] = static_cast<float>(a[1]);
-            dest[index + 2] = static_cast<float>(a[2]);
-            dest[index + 3] = static_cast<float>(a[3]);
-            index = index + 4;
+            dest[i] = static_cast<float>(packed_code_chip(code, i));
         }
-    // last bit is filled up with a zero
-    hex_to_binary_converter(a, GALILEO_E6_C_PRIMARY_CODE[prn_][GALILEO_E6_C_PRIMARY_CODE_STR_LENGTH - 1]);
-    dest[index] = static_cast<float>(a[0]);
-    dest[index + 1] = static_cast<float>(a[1]);
-    dest[index + 2] = static_cast<float>(a[2]);
 }
 
 
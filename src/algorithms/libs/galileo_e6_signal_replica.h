@@ -37,6 +37,13 @@ namespace own = gsl;
  * \{ */
 
 
+/*!
+ * \brief Galileo E6B primary code packed one bit per chip (see
+ * gnss_packed_code.h). Returns an empty span for unknown PRNs.
+ */
+own::span<const uint32_t> galileo_e6_b_packed_primary_code(int32_t prn);
+
+
 /*!
  * \brief Generates Galileo E6B code at 1 sample/chip
  */
@@ -60,6 +67,13 @@ void galileo_e6_b_code_gen_complex_sampled(own::span<std::complex<float>> dest,
     uint32_t chip_shift);
 
 
+/*!
+ * \brief Galileo E6C primary code packed one bit per chip (see
+ * gnss_packed_code.h). Returns an empty span for unknown PRNs.
+ */
+own::span<const uint32_t> galileo_e6_c_packed_primary_code(int32_t prn);
+
+
 /*!
  * \brief Generates Galileo E6C codes at 1 sample/chip
  */
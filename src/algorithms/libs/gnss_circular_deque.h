@@ -19,6 +19,7 @@
 #define GNSS_SDR_CIRCULAR_DEQUE_H
 
 #include <boost/circular_buffer.hpp>
+#include <algorithm>
 #include <vector>
 
 /** \addtogroup Algorithms_Library
@@ -44,6 +45,10 @@ public:
     void reset(unsigned int max_size, unsigned int nchann);           //!< Removes all the elements in all the channels. Re-sets the number of channels and their capacity
     void reset();                                                     //!< Removes all the channels (Sets nchann to 0)
 
+    //! Returns the position of the first element of a channel for which comp(element, key) is false, or size(ch) if there is none. The elements of the channel must be sorted according to comp
+    template <class Key, class Compare>
+    unsigned int lower_bound(unsigned int ch, const Key& key, Compare comp) const;
+
 private:
     std::vector<boost::circular_buffer<T>> d_data;
 };
@@ -126,6 +131,14 @@ void Gnss_circular_deque<T>::reset()
 }
 
 
+template <class T>
+template <class Key, class Compare>
+unsigned int Gnss_circular_deque<T>::lower_bound(unsigned int ch, const Key& key, Compare comp) const
+{
+    return static_cast<unsigned int>(std::lower_bound(d_data[ch].begin(), d_data[ch].end(), key, comp) - d_data[ch].begin());
+}
+
+
 template <class T>
 void Gnss_circular_deque<T>::pop_front(unsigned int ch)
 {
@@ -0,0 +1,100 @@
+/*!
+ * \file gnss_packed_code.h
+ * \brief Spreading codes packed one bit per chip, built at compile time from
+ * the hexadecimal tables of the ICDs
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_PACKED_CODE_H
+#define GNSS_SDR_GNSS_PACKED_CODE_H
+
+#include <cstddef>  // for size_t
+#include <cstdint>
+#if HAS_STD_SPAN
+#include <span>
+namespace own = std;
+#else
+#include <gsl/gsl-lite.hpp>
+namespace own = gsl;
+#endif
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Codes of a signal, one bit per chip. The first chip of each code is
+ * the most significant bit of its first word, and a bit set to 1 is a chip
+ * with value -1.
+ */
+template <size_t Codes, size_t Chips>
+struct PackedCodeTable
+{
+    static constexpr size_t words_per_code = (Chips + 31) / 32;
+    uint32_t words[Codes][words_per_code];
+
+    own::span<const uint32_t> code(size_t index) const
+    {
+        return own::span<const uint32_t>(words[index], words_per_code);
+    }
+};
+
+
+/*!
+ * \brief Value (0 to 15) of the i-th hexadecimal digit of a code, or 0 past its end
+ */
+template <size_t Chars>
+constexpr uint32_t hex_code_digit(const char (&hex)[Chars], size_t i)
+{
+    return i >= Chars - 1 ? 0U : (hex[i] >= 'A' ? static_cast<uint32_t>(hex[i] - 'A' + 10) : static_cast<uint32_t>(hex[i] - '0'));
+}
+
+
+/*!
+ * \brief Packs a table of codes written as hexadecimal strings. Each digit
+ * holds four chips, so the result has 4 * (Chars - 1) chips per code, including
+ * the zeros that fill up the last digit.
+ */
+template <size_t Codes, size_t Chars>
+constexpr PackedCodeTable<Codes, 4 * (Chars - 1)> pack_hex_codes(const char (&hex)[Codes][Chars])
+{
+    PackedCodeTable<Codes, 4 * (Chars - 1)> table{};
+    for (size_t c = 0; c < Codes; c++)
+        {
+            for (size_t w = 0; w < table.words_per_code; w++)
+                {
+                    // one statement per word keeps the evaluation within the
+                    // default constexpr step limits of the compilers
+                    table.words[c][w] = hex_code_digit(hex[c], 8 * w) << 28U | hex_code_digit(hex[c], 8 * w + 1) << 24U |
+                                        hex_code_digit(hex[c], 8 * w + 2) << 20U | hex_code_digit(hex[c], 8 * w + 3) << 16U |
+                                        hex_code_digit(hex[c], 8 * w + 4) << 12U | hex_code_digit(hex[c], 8 * w + 5) << 8U |
+                                        hex_code_digit(hex[c], 8 * w + 6) << 4U | hex_code_digit(hex[c], 8 * w + 7);
+                }
+        }
+    return table;
+}
+
+
+/*!
+ * \brief Value (+1 or -1) of a chip of a packed code
+ */
+inline int32_t packed_code_chip(own::span<const uint32_t> code, uint32_t chip)
+{
+    return ((code[chip / 32] >> (31U - chip % 32)) & 1U) ? -1 : 1;
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_PACKED_CODE_H
@@ -511,6 +511,25 @@ typedef struct
 } seph_t;
 
 
+typedef struct
+{                          /* per-satellite time-sorted index of an ephemeris array */
+    const void *data;      /* indexed ephemeris array */
+    int n;                 /* number of ephemeris in the array */
+    int nmax;              /* allocated entries of idx and toe */
+    int *idx;              /* ephemeris indexes sorted by satellite and reference time */
+    double *toe;           /* reference time of each idx entry (s since 1970) */
+    int start[MAXSAT + 1]; /* idx entries of satellite sat: [start[sat-1], start[sat]) */
+} ephlist_t;
+
+
+typedef struct
+{                   /* broadcast ephemeris index type */
+    ephlist_t eph;  /* GPS/QZS/GAL/BDS ephemeris index */
+    ephlist_t geph; /* GLONASS ephemeris index */
+    ephlist_t seph; /* SBAS ephemeris index */
+} ephidx_t;
+
+
 typedef struct
 {                   /* norad two line element data type */
     char name[32];  /* common name */
@@ -795,6 +814,7 @@ typedef struct
     lexeph_t lexeph[MAXSAT];      /* LEX ephemeris */
     lexion_t lexion;              /* LEX ionosphere correction */
     pppcorr_t pppcorr;            /* ppp corrections */
+    ephidx_t *ephidx;             /* broadcast ephemeris index (nullptr: linear search) */
 } nav_t;
 
 
@@ -440,6 +440,47 @@ geph_t eph_to_rtklib(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, const Glona
 }
 
 
+void has_corrections_to_rtklib(eph_t& rtklib_sat,
+    int prn,
+    const std::map<int, HAS_orbit_corrections>& orbit_correction_map,
+    const std::map<int, HAS_clock_corrections>& clock_correction_map)
+{
+    if (!orbit_correction_map.empty() && !clock_correction_map.empty())
+        {
+            int count_has_corrections = 0;
+            const auto it_orbit = orbit_correction_map.find(prn);
+            if (it_orbit != orbit_correction_map.cend())
+                {
+                    rtklib_sat.has_orbit_radial_correction_m = it_orbit->second.radial_m;
+                    rtklib_sat.has_orbit_in_track_correction_m = it_orbit->second.in_track_m;
+                    rtklib_sat.has_orbit_cross_track_correction_m = it_orbit->second.cross_track_m;
+                    count_has_corrections++;
+                }
+
+            const auto it_clock = clock_correction_map.find(prn);
+            if (it_clock != clock_correction_map.cend())
+                {
+                    rtklib_sat.has_clock_correction_m = it_clock->second.clock_correction_m;
+                    count_has_corrections++;
+                }
+            rtklib_sat.apply_has_corrections = (count_has_corrections == 2) ? true : false;
+            if (rtklib_sat.apply_has_corrections)
+                {
+                    rtklib_sat.tgd[0] = 0.0;
+                    rtklib_sat.tgd[1] = 0.0;
+                }
+        }
+    else
+        {
+            rtklib_sat.has_orbit_radial_correction_m = 0.0;
+            rtklib_sat.has_orbit_in_track_correction_m = 0.0;
+            rtklib_sat.has_orbit_cross_track_correction_m = 0.0;
+            rtklib_sat.has_clock_correction_m = 0.0;
+            rtklib_sat.apply_has_corrections = false;
+        }
+}
+
+
 eph_t eph_to_rtklib(const Galileo_Ephemeris& gal_eph)
 {
     std::map<int, HAS_orbit_corrections> empty_orbit_map;
@@ -505,35 +546,7 @@ eph_t eph_to_rtklib(const Galileo_Ephemeris& gal_eph,
     rtklib_sat.toc = gpst2time(rtklib_sat.week, toc);
     rtklib_sat.ttr = gpst2time(rtklib_sat.week, tow);
 
-    if (!orbit_correction_map.empty() && !clock_correction_map.empty())
-        {
-            int count_has_corrections = 0;
-            const auto it_orbit = orbit_correction_map.find(static_cast<int>(gal_eph.PRN));
-            if (it_orbit != orbit_correction_map.cend())
-                {
-                    rtklib_sat.has_orbit_radial_correction_m = it_orbit->second.radial_m;
-                    rtklib_sat.has_orbit_in_track_correction_m = it_orbit->second.in_track_m;
-                    rtklib_sat.has_orbit_cross_track_correction_m = it_orbit->second.cross_track_m;
-                    count_has_corrections++;
-                }
-
-            const auto it_clock = clock_correction_map.find(static_cast<int>(gal_eph.PRN));
-            if (it_clock != clock_correction_map.cend())
-                {
-                    rtklib_sat.has_clock_correction_m = it_clock->second.clock_correction_m;
-                    count_has_corrections++;
-                }
-            rtklib_sat.apply_has_corrections = (count_has_corrections == 2) ? true : false;
-            if (rtklib_sat.apply_has_corrections)
-                {
-                    rtklib_sat.tgd[0] = 0.0;
-                    rtklib_sat.tgd[1] = 0.0;
-                }
-        }
-    else
-        {
-            rtklib_sat.apply_has_corrections = false;
-        }
+    has_corrections_to_rtklib(rtklib_sat, static_cast<int>(gal_eph.PRN), orbit_correction_map, clock_correction_map);
     return rtklib_sat;
 }
 
@@ -603,39 +616,7 @@ eph_t eph_to_rtklib(const Gps_Ephemeris& gps_eph,
     rtklib_sat.toc = gpst2time(rtklib_sat.week, toc);
     rtklib_sat.ttr = gpst2time(rtklib_sat.week, tow);
 
-    if (!orbit_correction_map.empty() && !clock_correction_map.empty())
-        {
-            int count_has_corrections = 0;
-            const auto it_orbit = orbit_correction_map.find(static_cast<int>(gps_eph.PRN));
-            if (it_orbit != orbit_correction_map.cend())
-                {
-                    rtklib_sat.has_orbit_radial_correction_m = it_orbit->second.radial_m;
-                    rtklib_sat.has_orbit_in_track_correction_m = it_orbit->second.in_track_m;
-                    rtklib_sat.has_orbit_cross_track_correction_m = it_orbit->second.cross_track_m;
-                    count_has_corrections++;
-                }
-
-            const auto it_clock = clock_correction_map.find(static_cast<int>(gps_eph.PRN));
-            if (it_clock != clock_correction_map.cend())
-                {
-                    rtklib_sat.has_clock_correction_m = it_clock->second.clock_correction_m;
-                    count_has_corrections++;
-                }
-            rtklib_sat.apply_has_corrections = (count_has_corrections == 2) ? true : false;
-            if (rtklib_sat.apply_has_corrections)
-                {
-                    rtklib_sat.tgd[0] = 0.0;
-                    rtklib_sat.tgd[1] = 0.0;
-                }
-        }
-    else
-        {
-            rtklib_sat.has_orbit_radial_correction_m = 0.0;
-            rtklib_sat.has_orbit_in_track_correction_m = 0.0;
-            rtklib_sat.has_orbit_cross_track_correction_m = 0.0;
-            rtklib_sat.has_clock_correction_m = 0.0;
-            rtklib_sat.apply_has_corrections = false;
-        }
+    has_corrections_to_rtklib(rtklib_sat, static_cast<int>(gps_eph.PRN), orbit_correction_map, clock_correction_map);
 
     return rtklib_sat;
 }
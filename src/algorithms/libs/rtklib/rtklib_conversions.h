@@ -83,6 +83,16 @@ eph_t eph_to_rtklib(const Gps_Ephemeris& gps_eph,
 eph_t eph_to_rtklib(const Gps_CNAV_Ephemeris& gps_cnav_eph);
 eph_t eph_to_rtklib(const Beidou_Dnav_Ephemeris& bei_eph);
 
+/*!
+ * \brief Sets the HAS orbit and clock corrections of an RTKLIB ephemeris of
+ * the satellite prn. They are applied only if both the orbit and the clock
+ * corrections are available for that satellite.
+ */
+void has_corrections_to_rtklib(eph_t& rtklib_sat,
+    int prn,
+    const std::map<int, HAS_orbit_corrections>& orbit_correction_map,
+    const std::map<int, HAS_clock_corrections>& clock_correction_map);
+
 alm_t alm_to_rtklib(const Gps_Almanac& gps_alm);
 alm_t alm_to_rtklib(const Galileo_Almanac& gal_alm);
 
@@ -34,6 +34,7 @@
 #include "rtklib_preceph.h"
 #include "rtklib_rtkcmn.h"
 #include "rtklib_sbas.h"
+#include <algorithm>
 #include <vector>
 
 /* constants -----------------------------------------------------------------*/
@@ -597,6 +598,65 @@ void seph2pos(gtime_t time, const seph_t *seph, double *rs, double *dts,
 }
 
 
+/* select ephemeris with the per-satellite index -------------------------------
+ * apply the selection rules of seleph(), selgeph() and selseph() to the
+ * ephemeris of sat with toe within tmax of time (or of time +/- one week, if
+ * weekwrap). With iode >= 0, the first ephemeris of the array with that iode is
+ * selected. Otherwise, the one with the toe closest to time is selected, the
+ * last one of the array in case of a tie
+ * return : selected ephemeris index (-1: no ephemeris, -2: index not usable)
+ *-----------------------------------------------------------------------------*/
+template <typename T, typename Iode, typename Tdiff>
+int selephidx(const ephlist_t *list, const T *data, int n, gtime_t time, int sat,
+    int iode, double tmax, bool weekwrap, Iode iodeof, Tdiff tdiff)
+{
+    const double wrap[] = {0.0, -604800.0, 604800.0};
+    double t;
+    double tmin = tmax + 1.0;
+    int i;
+    int j = -1;
+
+    if (list->data != data || list->n != n || sat < 1 || sat > MAXSAT)
+        {
+            return -2;
+        }
+    const double t0 = static_cast<double>(time.time) + time.sec;
+    const double *first = list->toe + list->start[sat - 1];
+    const double *last = list->toe + list->start[sat];
+
+    for (int w = 0; w < (weekwrap ? 3 : 1); w++)
+        {
+            /* 1 s margin for the rounding of toe to double */
+            for (const double *p = std::lower_bound(first, last, t0 + wrap[w] - tmax - 1.0);
+                 p < last && *p <= t0 + wrap[w] + tmax + 1.0; p++)
+                {
+                    i = list->idx[p - list->toe];
+                    if (iode >= 0 && iodeof(data[i]) != iode)
+                        {
+                            continue;
+                        }
+                    if ((t = fabs(tdiff(data[i], time))) > tmax)
+                        {
+                            continue;
+                        }
+                    if (iode >= 0)
+                        {
+                            if (j < 0 || i < j)
+                                {
+                                    j = i;
+                                }
+                        }
+                    else if (t < tmin || (t == tmin && i > j))
+                        {
+                            j = i;
+                            tmin = t;
+                        }
+                }
+        }
+    return j;
+}
+
+
 /* select ephemeris --------------------------------------------------------*/
 eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
 {
@@ -625,31 +685,38 @@ eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
         }
     tmin = tmax + 1.0;
 
-    for (i = 0; i < nav->n; i++)
+    if (!nav->ephidx || (j = selephidx(&nav->ephidx->eph, nav->eph, nav->n, time, sat, iode, tmax, true,
+                             [](const eph_t &e) { return e.iode; },
+                             [](const eph_t &e, gtime_t t0) { return timediffweekcrossover(e.toe, t0); })) == -2)
         {
-            if (nav->eph[i].sat != sat)
-                {
-                    continue;
-                }
-            if (iode >= 0 && nav->eph[i].iode != iode)
-                {
-                    continue;
-                }
-            if ((t = fabs(timediffweekcrossover(nav->eph[i].toe, time))) > tmax)
-                {
-                    continue;
-                }
-            if (iode >= 0)
+            j = -1;
+            for (i = 0; i < nav->n; i++)
                 {
-                    return nav->eph + i;
+                    if (nav->eph[i].sat != sat)
+                        {
+                            continue;
+                        }
+                    if (iode >= 0 && nav->eph[i].iode != iode)
+                        {
+                            continue;
+                        }
+                    if ((t = fabs(timediffweekcrossover(nav->eph[i].toe, time))) > tmax)
+                        {
+                            continue;
+                        }
+                    if (iode >= 0)
+                        {
+                            j = i;
+                            break;
+                        }
+                    if (t <= tmin)
+                        {
+                            j = i;
+                            tmin = t;
+                        } /* toe closest to time */
                 }
-            if (t <= tmin)
-                {
-                    j = i;
-                    tmin = t;
-                } /* toe closest to time */
         }
-    if (iode >= 0 || j < 0)
+    if (j < 0)
         {
             trace(3, "no broadcast ephemeris: %s sat=%2d iode=%3d\n", time_str(time, 0),
                 sat, iode);
@@ -670,31 +737,38 @@ geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav)
 
     trace(4, "selgeph : time=%s sat=%2d iode=%2d\n", time_str(time, 3), sat, iode);
 
-    for (i = 0; i < nav->ng; i++)
+    if (!nav->ephidx || (j = selephidx(&nav->ephidx->geph, nav->geph, nav->ng, time, sat, iode, tmax, false,
+                             [](const geph_t &e) { return e.iode; },
+                             [](const geph_t &e, gtime_t t0) { return timediff(e.toe, t0); })) == -2)
         {
-            if (nav->geph[i].sat != sat)
-                {
-                    continue;
-                }
-            if (iode >= 0 && nav->geph[i].iode != iode)
+            j = -1;
+            for (i = 0; i < nav->ng; i++)
                 {
-                    continue;
-                }
-            if ((t = fabs(timediff(nav->geph[i].toe, time))) > tmax)
-                {
-                    continue;
-                }
-            if (iode >= 0)
-                {
-                    return nav->geph + i;
+                    if (nav->geph[i].sat != sat)
+                        {
+                            continue;
+                        }
+                    if (iode >= 0 && nav->geph[i].iode != iode)
+                        {
+                            continue;
+                        }
+                    if ((t = fabs(timediff(nav->geph[i].toe, time))) > tmax)
+                        {
+                            continue;
+                        }
+                    if (iode >= 0)
+                        {
+                            j = i;
+                            break;
+                        }
+                    if (t <= tmin)
+                        {
+                            j = i;
+                            tmin = t;
+                        } /* toe closest to time */
                 }
-            if (t <= tmin)
-                {
-                    j = i;
-                    tmin = t;
-                } /* toe closest to time */
         }
-    if (iode >= 0 || j < 0)
+    if (j < 0)
         {
             trace(3, "no glonass ephemeris  : %s sat=%2d iode=%2d\n", time_str(time, 0),
                 sat, iode);
@@ -715,21 +789,27 @@ seph_t *selseph(gtime_t time, int sat, const nav_t *nav)
 
     trace(4, "selseph : time=%s sat=%2d\n", time_str(time, 3), sat);
 
-    for (i = 0; i < nav->ns; i++)
+    if (!nav->ephidx || (j = selephidx(&nav->ephidx->seph, nav->seph, nav->ns, time, sat, -1, tmax, true,
+                             [](const seph_t & /* e */) { return -1; },
+                             [](const seph_t &e, gtime_t t0) { return timediffweekcrossover(e.t0, t0); })) == -2)
         {
-            if (nav->seph[i].sat != sat)
-                {
-                    continue;
-                }
-            if ((t = fabs(timediffweekcrossover(nav->seph[i].t0, time))) > tmax)
+            j = -1;
+            for (i = 0; i < nav->ns; i++)
                 {
-                    continue;
+                    if (nav->seph[i].sat != sat)
+                        {
+                            continue;
+                        }
+                    if ((t = fabs(timediffweekcrossover(nav->seph[i].t0, time))) > tmax)
+                        {
+                            continue;
+                        }
+                    if (t <= tmin)
+                        {
+                            j = i;
+                            tmin = t;
+                        } /* toe closest to time */
                 }
-            if (t <= tmin)
-                {
-                    j = i;
-                    tmin = t;
-                } /* toe closest to time */
         }
     if (j < 0)
         {
@@ -30,6 +30,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "rtklib_rtkcmn.h"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstring>
@@ -3516,6 +3517,9 @@ void uniqnav(nav_t *nav)
     uniqgeph(nav);
     uniqseph(nav);
 
+    /* index ephemeris by satellite and toe */
+    buildephidx(nav);
+
     /* update carrier wave length */
     for (i = 0; i < MAXSAT; i++)
         {
@@ -3527,6 +3531,127 @@ void uniqnav(nav_t *nav)
 }
 
 
+/* index one ephemeris array by satellite and reference time ---------------*/
+template <typename T, typename Reftime>
+int buildephlist(ephlist_t *list, const T *data, int n, Reftime reftime)
+{
+    int i;
+    int k;
+    int sat;
+
+    list->data = data;
+    list->n = n;
+    for (i = 0; i <= MAXSAT; i++)
+        {
+            list->start[i] = 0;
+        }
+    if (n <= 0)
+        {
+            return 1;
+        }
+    if (n > list->nmax)
+        {
+            /* the buffers are kept across rebuilds, so they only grow */
+            free(list->idx);
+            free(list->toe);
+            list->toe = nullptr;
+            list->nmax = 0;
+            if (!(list->idx = static_cast<int *>(malloc(sizeof(int) * n))) ||
+                !(list->toe = static_cast<double *>(malloc(sizeof(double) * n))))
+                {
+                    list->n = 0;
+                    return 0;
+                }
+            list->nmax = n;
+        }
+    /* records of invalid satellites are left out of the index */
+    for (i = k = 0; i < n; i++)
+        {
+            if (data[i].sat >= 1 && data[i].sat <= MAXSAT)
+                {
+                    list->idx[k++] = i;
+                }
+        }
+    std::sort(list->idx, list->idx + k, [data, &reftime](int a, int b) {
+        if (data[a].sat != data[b].sat)
+            {
+                return data[a].sat < data[b].sat;
+            }
+        const gtime_t ta = reftime(data[a]);
+        const gtime_t tb = reftime(data[b]);
+        if (ta.time != tb.time || ta.sec != tb.sec)
+            {
+                return ta.time < tb.time || (ta.time == tb.time && ta.sec < tb.sec);
+            }
+        return a < b;
+    });
+    for (i = 0; i < k; i++)
+        {
+            const gtime_t t = reftime(data[list->idx[i]]);
+            list->toe[i] = static_cast<double>(t.time) + t.sec;
+        }
+    /* start[sat] = number of entries of satellites 1..sat */
+    for (i = sat = 0; sat <= MAXSAT; sat++)
+        {
+            while (i < k && data[list->idx[i]].sat <= sat)
+                {
+                    i++;
+                }
+            list->start[sat] = i;
+        }
+    return 1;
+}
+
+
+/* build broadcast ephemeris index ---------------------------------------------
+ * index the broadcast ephemeris of navigation data by satellite and toe, so
+ * that seleph(), selgeph() and selseph() do not scan all the ephemeris
+ * args   : nav_t *nav    IO     navigation data
+ * return : status (1:ok,0:memory allocation error)
+ * notes  : the index has to be rebuilt whenever the ephemeris arrays are
+ *          modified. the buffers of a previous index are reused. seleph(),
+ *          selgeph() and selseph() fall back to a linear search if there is
+ *          no index or it does not match the current arrays
+ *-----------------------------------------------------------------------------*/
+int buildephidx(nav_t *nav)
+{
+    trace(4, "buildephidx: neph=%d ngeph=%d nseph=%d\n", nav->n, nav->ng, nav->ns);
+
+    if (!nav->ephidx && !(nav->ephidx = static_cast<ephidx_t *>(calloc(1, sizeof(ephidx_t)))))
+        {
+            trace(1, "buildephidx malloc error\n");
+            return 0;
+        }
+    if (!buildephlist(&nav->ephidx->eph, nav->eph, nav->n, [](const eph_t &e) { return e.toe; }) ||
+        !buildephlist(&nav->ephidx->geph, nav->geph, nav->ng, [](const geph_t &e) { return e.toe; }) ||
+        !buildephlist(&nav->ephidx->seph, nav->seph, nav->ns, [](const seph_t &e) { return e.t0; }))
+        {
+            trace(1, "buildephidx malloc error\n");
+            freeephidx(nav);
+            return 0;
+        }
+    return 1;
+}
+
+
+/* free broadcast ephemeris index ------------------------------------------*/
+void freeephidx(nav_t *nav)
+{
+    if (!nav->ephidx)
+        {
+            return;
+        }
+    free(nav->ephidx->eph.idx);
+    free(nav->ephidx->eph.toe);
+    free(nav->ephidx->geph.idx);
+    free(nav->ephidx->geph.toe);
+    free(nav->ephidx->seph.idx);
+    free(nav->ephidx->seph.toe);
+    free(nav->ephidx);
+    nav->ephidx = nullptr;
+}
+
+
 /* compare observation data -------------------------------------------------*/
 int cmpobs(const void *p1, const void *p2)
 {
@@ -3804,6 +3929,10 @@ void freeobs(obs_t *obs)
  *-----------------------------------------------------------------------------*/
 void freenav(nav_t *nav, int opt)
 {
+    if (opt & 0x07)
+        {
+            freeephidx(nav);
+        }
     if (opt & 0x01)
         {
             free(nav->eph);
@@ -223,6 +223,8 @@ void uniqgeph(nav_t *nav);
 int cmpseph(const void *p1, const void *p2);
 void uniqseph(nav_t *nav);
 void uniqnav(nav_t *nav);
+int buildephidx(nav_t *nav);
+void freeephidx(nav_t *nav);
 int cmpobs(const void *p1, const void *p2);
 int sortobs(obs_t *obs);
 int screent(gtime_t time, gtime_t ts, gtime_t te, double tint);
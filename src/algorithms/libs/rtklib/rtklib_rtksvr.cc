@@ -116,6 +116,8 @@ void updatenav(nav_t *nav)
                     nav->lam[i][j] = satwavelen(i + 1, j, nav);
                 }
         }
+    /* index the updated ephemeris for seleph(), selgeph() and selseph() */
+    buildephidx(nav);
 }
 
 
@@ -754,6 +756,7 @@ int rtksvrinit(rtksvr_t *svr)
     svr->thread = 0;  // NOLINT
     svr->cputime = svr->prcout = 0;
 
+    svr->nav.ephidx = nullptr;
     if (!(svr->nav.eph = static_cast<eph_t *>(malloc(sizeof(eph_t) * MAXSAT * 2))) ||
         !(svr->nav.geph = static_cast<geph_t *>(malloc(sizeof(geph_t) * NSATGLO * 2))) ||
         !(svr->nav.seph = static_cast<seph_t *>(malloc(sizeof(seph_t) * NSATSBS * 2))))
@@ -814,6 +817,7 @@ void rtksvrfree(rtksvr_t *svr)
     int i;
     int j;
 
+    freeephidx(&svr->nav);
     free(svr->nav.eph);
     free(svr->nav.geph);
     free(svr->nav.seph);
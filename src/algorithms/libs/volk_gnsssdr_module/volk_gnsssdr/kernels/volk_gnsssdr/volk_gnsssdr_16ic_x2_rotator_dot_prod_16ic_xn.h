@@ -1286,6 +1286,810 @@ static inline void volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn_a_avx2_reload(l
 #endif /* LV_HAVE_AVX2 */
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn_u_avx2_fma(lv_16sc_t* result, const lv_16sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_16sc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+
+    lv_16sc_t tmp16;
+    lv_32fc_t tmp32;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(32)
+    lv_16sc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_16sc_t dotProductVector[8];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[4];
+    double lane_inc_im[4];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 4; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[3] * inc_re - lane_inc_im[3] * inc_im;
+    const double vec_inc_im = lane_inc_re[3] * inc_im + lane_inc_im[3] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 4; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m256 ylp = _mm256_set1_ps((float)vec_inc_re);
+    const __m256 yhp = _mm256_set1_ps((float)vec_inc_im);
+    __m256 a, yl, yh, z, four_phase_acc_reg;
+    __m256i c1, c2;
+    __m256i a2, b2, b2_sl, c, real, imag;
+    __m256i acc0, acc1, acc2, acc3;
+    __m256i taps[4];
+    const lv_16sc_t* code0;
+    const lv_16sc_t* code1;
+    const lv_16sc_t* code2;
+    const lv_16sc_t* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common, rounded back to 16ic
+            for (i = 0; i < 4; i++)
+                {
+                    four_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+            for (number = 0; number < block_points; number += 8)
+                {
+                    a = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(in_common + block_start + number))));
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);  // Load yh with ci,ci,di,di
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    c1 = _mm256_cvtps_epi32(_mm256_fmaddsub_ps(a, yl, z));  // convert from 32fc to 32ic
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+
+                    // next four samples
+                    a = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(in_common + block_start + number + 4))));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    c2 = _mm256_cvtps_epi32(_mm256_fmaddsub_ps(a, yl, z));
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+
+                    // convert from 32ic to 16ic, undoing the in-lane interleaving of packs
+                    _mm256_store_si256((__m256i*)(rotated + number), _mm256_permute4x64_epi64(_mm256_packs_epi32(c1, c2), 0xD8));
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // The real part of each product is left in the even 16-bit lanes and the
+            // imaginary part in the odd ones, so one saturated accumulator holds both.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = in_a[n_vec] + block_start;
+                    code1 = in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start;
+                    code2 = in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start;
+                    code3 = in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start;
+                    acc0 = _mm256_setzero_si256();
+                    acc1 = _mm256_setzero_si256();
+                    acc2 = _mm256_setzero_si256();
+                    acc3 = _mm256_setzero_si256();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            b2 = _mm256_load_si256((__m256i*)(rotated + number));
+                            b2_sl = _mm256_slli_si256(b2, 2);
+                            a2 = _mm256_loadu_si256((const __m256i*)(code0 + number));
+                            c = _mm256_mullo_epi16(a2, b2);
+                            real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                            imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                            acc0 = _mm256_adds_epi16(acc0, _mm256_blend_epi16(real, imag, 0xAA));
+                            if (n_taps > 1)
+                                {
+                                    a2 = _mm256_loadu_si256((const __m256i*)(code1 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc1 = _mm256_adds_epi16(acc1, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a2 = _mm256_loadu_si256((const __m256i*)(code2 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc2 = _mm256_adds_epi16(acc2, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a2 = _mm256_loadu_si256((const __m256i*)(code3 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc3 = _mm256_adds_epi16(acc3, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                        }
+                    taps[0] = acc0;
+                    taps[1] = acc1;
+                    taps[2] = acc2;
+                    taps[3] = acc3;
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm256_store_si256((__m256i*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 8; n++)
+                                {
+                                    result[n_vec + i] = lv_cmake(sat_adds16i(lv_creal(result[n_vec + i]), lv_creal(dotProductVector[n])),
+                                        sat_adds16i(lv_cimag(result[n_vec + i]), lv_cimag(dotProductVector[n])));
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    (*phase) = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp16 = in_common[n];
+            tmp32 = lv_cmake((float)lv_creal(tmp16), (float)lv_cimag(tmp16)) * (*phase);
+            tmp16 = lv_cmake((int16_t)rintf(lv_creal(tmp32)), (int16_t)rintf(lv_cimag(tmp32)));
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    lv_16sc_t tmp = tmp16 * in_a[n_vec][n];
+                    result[n_vec] = lv_cmake(sat_adds16i(lv_creal(result[n_vec]), lv_creal(tmp)),
+                        sat_adds16i(lv_cimag(result[n_vec]), lv_cimag(tmp)));
+                }
+        }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn_a_avx2_fma(lv_16sc_t* result, const lv_16sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_16sc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+
+    lv_16sc_t tmp16;
+    lv_32fc_t tmp32;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(32)
+    lv_16sc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_16sc_t dotProductVector[8];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[4];
+    double lane_inc_im[4];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 4; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[3] * inc_re - lane_inc_im[3] * inc_im;
+    const double vec_inc_im = lane_inc_re[3] * inc_im + lane_inc_im[3] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 4; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m256 ylp = _mm256_set1_ps((float)vec_inc_re);
+    const __m256 yhp = _mm256_set1_ps((float)vec_inc_im);
+    __m256 a, yl, yh, z, four_phase_acc_reg;
+    __m256i c1, c2;
+    __m256i a2, b2, b2_sl, c, real, imag;
+    __m256i acc0, acc1, acc2, acc3;
+    __m256i taps[4];
+    const lv_16sc_t* code0;
+    const lv_16sc_t* code1;
+    const lv_16sc_t* code2;
+    const lv_16sc_t* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common, rounded back to 16ic
+            for (i = 0; i < 4; i++)
+                {
+                    four_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+            for (number = 0; number < block_points; number += 8)
+                {
+                    a = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_load_si128((const __m128i*)(in_common + block_start + number))));
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);  // Load yh with ci,ci,di,di
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    c1 = _mm256_cvtps_epi32(_mm256_fmaddsub_ps(a, yl, z));  // convert from 32fc to 32ic
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+
+                    // next four samples
+                    a = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_load_si128((const __m128i*)(in_common + block_start + number + 4))));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    c2 = _mm256_cvtps_epi32(_mm256_fmaddsub_ps(a, yl, z));
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+
+                    // convert from 32ic to 16ic, undoing the in-lane interleaving of packs
+                    _mm256_store_si256((__m256i*)(rotated + number), _mm256_permute4x64_epi64(_mm256_packs_epi32(c1, c2), 0xD8));
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // The real part of each product is left in the even 16-bit lanes and the
+            // imaginary part in the odd ones, so one saturated accumulator holds both.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = in_a[n_vec] + block_start;
+                    code1 = in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start;
+                    code2 = in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start;
+                    code3 = in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start;
+                    acc0 = _mm256_setzero_si256();
+                    acc1 = _mm256_setzero_si256();
+                    acc2 = _mm256_setzero_si256();
+                    acc3 = _mm256_setzero_si256();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            b2 = _mm256_load_si256((__m256i*)(rotated + number));
+                            b2_sl = _mm256_slli_si256(b2, 2);
+                            a2 = _mm256_load_si256((const __m256i*)(code0 + number));
+                            c = _mm256_mullo_epi16(a2, b2);
+                            real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                            imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                            acc0 = _mm256_adds_epi16(acc0, _mm256_blend_epi16(real, imag, 0xAA));
+                            if (n_taps > 1)
+                                {
+                                    a2 = _mm256_load_si256((const __m256i*)(code1 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc1 = _mm256_adds_epi16(acc1, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a2 = _mm256_load_si256((const __m256i*)(code2 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc2 = _mm256_adds_epi16(acc2, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a2 = _mm256_load_si256((const __m256i*)(code3 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc3 = _mm256_adds_epi16(acc3, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                        }
+                    taps[0] = acc0;
+                    taps[1] = acc1;
+                    taps[2] = acc2;
+                    taps[3] = acc3;
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm256_store_si256((__m256i*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 8; n++)
+                                {
+                                    result[n_vec + i] = lv_cmake(sat_adds16i(lv_creal(result[n_vec + i]), lv_creal(dotProductVector[n])),
+                                        sat_adds16i(lv_cimag(result[n_vec + i]), lv_cimag(dotProductVector[n])));
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    (*phase) = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp16 = in_common[n];
+            tmp32 = lv_cmake((float)lv_creal(tmp16), (float)lv_cimag(tmp16)) * (*phase);
+            tmp16 = lv_cmake((int16_t)rintf(lv_creal(tmp32)), (int16_t)rintf(lv_cimag(tmp32)));
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    lv_16sc_t tmp = tmp16 * in_a[n_vec][n];
+                    result[n_vec] = lv_cmake(sat_adds16i(lv_creal(result[n_vec]), lv_creal(tmp)),
+                        sat_adds16i(lv_cimag(result[n_vec]), lv_cimag(tmp)));
+                }
+        }
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn_u_avx512f(lv_16sc_t* result, const lv_16sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_16sc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+
+    lv_16sc_t tmp16;
+    lv_32fc_t tmp32;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(64)
+    lv_16sc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_16sc_t dotProductVector[8];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[8];
+    double lane_inc_im[8];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 8; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[7] * inc_re - lane_inc_im[7] * inc_im;
+    const double vec_inc_im = lane_inc_re[7] * inc_im + lane_inc_im[7] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 8; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m512 ylp = _mm512_set1_ps((float)vec_inc_re);
+    const __m512 yhp = _mm512_set1_ps((float)vec_inc_im);
+    __m512 a, yl, yh, z, eight_phase_acc_reg;
+    __m256i a2, b2, b2_sl, c, real, imag;
+    __m256i acc0, acc1, acc2, acc3;
+    __m256i taps[4];
+    const lv_16sc_t* code0;
+    const lv_16sc_t* code1;
+    const lv_16sc_t* code2;
+    const lv_16sc_t* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common, rounded back to 16ic
+            for (i = 0; i < 8; i++)
+                {
+                    eight_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+            for (number = 0; number < block_points; number += 8)
+                {
+                    a = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(in_common + block_start + number))));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm512_moveldup_ps(eight_phase_acc_reg);
+                    yh = _mm512_movehdup_ps(eight_phase_acc_reg);
+                    z = _mm512_mul_ps(_mm512_permute_ps(a, 0xB1), yh);
+                    // convert from 32fc to 16ic with saturation
+                    _mm256_store_si256((__m256i*)(rotated + number), _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(_mm512_fmaddsub_ps(a, yl, z))));
+                    z = _mm512_mul_ps(_mm512_permute_ps(eight_phase_acc_reg, 0xB1), yhp);
+                    eight_phase_acc_reg = _mm512_fmaddsub_ps(eight_phase_acc_reg, ylp, z);
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // The real part of each product is left in the even 16-bit lanes and the
+            // imaginary part in the odd ones, so one saturated accumulator holds both.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = in_a[n_vec] + block_start;
+                    code1 = in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start;
+                    code2 = in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start;
+                    code3 = in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start;
+                    acc0 = _mm256_setzero_si256();
+                    acc1 = _mm256_setzero_si256();
+                    acc2 = _mm256_setzero_si256();
+                    acc3 = _mm256_setzero_si256();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            b2 = _mm256_load_si256((__m256i*)(rotated + number));
+                            b2_sl = _mm256_slli_si256(b2, 2);
+                            a2 = _mm256_loadu_si256((const __m256i*)(code0 + number));
+                            c = _mm256_mullo_epi16(a2, b2);
+                            real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                            imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                            acc0 = _mm256_adds_epi16(acc0, _mm256_blend_epi16(real, imag, 0xAA));
+                            if (n_taps > 1)
+                                {
+                                    a2 = _mm256_loadu_si256((const __m256i*)(code1 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc1 = _mm256_adds_epi16(acc1, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a2 = _mm256_loadu_si256((const __m256i*)(code2 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc2 = _mm256_adds_epi16(acc2, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a2 = _mm256_loadu_si256((const __m256i*)(code3 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc3 = _mm256_adds_epi16(acc3, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                        }
+                    taps[0] = acc0;
+                    taps[1] = acc1;
+                    taps[2] = acc2;
+                    taps[3] = acc3;
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm256_store_si256((__m256i*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 8; n++)
+                                {
+                                    result[n_vec + i] = lv_cmake(sat_adds16i(lv_creal(result[n_vec + i]), lv_creal(dotProductVector[n])),
+                                        sat_adds16i(lv_cimag(result[n_vec + i]), lv_cimag(dotProductVector[n])));
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    (*phase) = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp16 = in_common[n];
+            tmp32 = lv_cmake((float)lv_creal(tmp16), (float)lv_cimag(tmp16)) * (*phase);
+            tmp16 = lv_cmake((int16_t)rintf(lv_creal(tmp32)), (int16_t)rintf(lv_cimag(tmp32)));
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    lv_16sc_t tmp = tmp16 * in_a[n_vec][n];
+                    result[n_vec] = lv_cmake(sat_adds16i(lv_creal(result[n_vec]), lv_creal(tmp)),
+                        sat_adds16i(lv_cimag(result[n_vec]), lv_cimag(tmp)));
+                }
+        }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX2 */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn_a_avx512f(lv_16sc_t* result, const lv_16sc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_16sc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+
+    lv_16sc_t tmp16;
+    lv_32fc_t tmp32;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(64)
+    lv_16sc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_16sc_t dotProductVector[8];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[8];
+    double lane_inc_im[8];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 8; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[7] * inc_re - lane_inc_im[7] * inc_im;
+    const double vec_inc_im = lane_inc_re[7] * inc_im + lane_inc_im[7] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 8; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m512 ylp = _mm512_set1_ps((float)vec_inc_re);
+    const __m512 yhp = _mm512_set1_ps((float)vec_inc_im);
+    __m512 a, yl, yh, z, eight_phase_acc_reg;
+    __m256i a2, b2, b2_sl, c, real, imag;
+    __m256i acc0, acc1, acc2, acc3;
+    __m256i taps[4];
+    const lv_16sc_t* code0;
+    const lv_16sc_t* code1;
+    const lv_16sc_t* code2;
+    const lv_16sc_t* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common, rounded back to 16ic
+            for (i = 0; i < 8; i++)
+                {
+                    eight_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+            for (number = 0; number < block_points; number += 8)
+                {
+                    a = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_load_si256((const __m256i*)(in_common + block_start + number))));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm512_moveldup_ps(eight_phase_acc_reg);
+                    yh = _mm512_movehdup_ps(eight_phase_acc_reg);
+                    z = _mm512_mul_ps(_mm512_permute_ps(a, 0xB1), yh);
+                    // convert from 32fc to 16ic with saturation
+                    _mm256_store_si256((__m256i*)(rotated + number), _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(_mm512_fmaddsub_ps(a, yl, z))));
+                    z = _mm512_mul_ps(_mm512_permute_ps(eight_phase_acc_reg, 0xB1), yhp);
+                    eight_phase_acc_reg = _mm512_fmaddsub_ps(eight_phase_acc_reg, ylp, z);
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // The real part of each product is left in the even 16-bit lanes and the
+            // imaginary part in the odd ones, so one saturated accumulator holds both.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = in_a[n_vec] + block_start;
+                    code1 = in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start;
+                    code2 = in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start;
+                    code3 = in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start;
+                    acc0 = _mm256_setzero_si256();
+                    acc1 = _mm256_setzero_si256();
+                    acc2 = _mm256_setzero_si256();
+                    acc3 = _mm256_setzero_si256();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            b2 = _mm256_load_si256((__m256i*)(rotated + number));
+                            b2_sl = _mm256_slli_si256(b2, 2);
+                            a2 = _mm256_load_si256((const __m256i*)(code0 + number));
+                            c = _mm256_mullo_epi16(a2, b2);
+                            real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                            imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                            acc0 = _mm256_adds_epi16(acc0, _mm256_blend_epi16(real, imag, 0xAA));
+                            if (n_taps > 1)
+                                {
+                                    a2 = _mm256_load_si256((const __m256i*)(code1 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc1 = _mm256_adds_epi16(acc1, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a2 = _mm256_load_si256((const __m256i*)(code2 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc2 = _mm256_adds_epi16(acc2, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a2 = _mm256_load_si256((const __m256i*)(code3 + number));
+                                    c = _mm256_mullo_epi16(a2, b2);
+                                    real = _mm256_subs_epi16(c, _mm256_srli_si256(c, 2));
+                                    imag = _mm256_adds_epi16(_mm256_mullo_epi16(a2, b2_sl), _mm256_mullo_epi16(b2, _mm256_slli_si256(a2, 2)));
+                                    acc3 = _mm256_adds_epi16(acc3, _mm256_blend_epi16(real, imag, 0xAA));
+                                }
+                        }
+                    taps[0] = acc0;
+                    taps[1] = acc1;
+                    taps[2] = acc2;
+                    taps[3] = acc3;
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm256_store_si256((__m256i*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 8; n++)
+                                {
+                                    result[n_vec + i] = lv_cmake(sat_adds16i(lv_creal(result[n_vec + i]), lv_creal(dotProductVector[n])),
+                                        sat_adds16i(lv_cimag(result[n_vec + i]), lv_cimag(dotProductVector[n])));
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    (*phase) = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp16 = in_common[n];
+            tmp32 = lv_cmake((float)lv_creal(tmp16), (float)lv_cimag(tmp16)) * (*phase);
+            tmp16 = lv_cmake((int16_t)rintf(lv_creal(tmp32)), (int16_t)rintf(lv_cimag(tmp32)));
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    lv_16sc_t tmp = tmp16 * in_a[n_vec][n];
+                    result[n_vec] = lv_cmake(sat_adds16i(lv_creal(result[n_vec]), lv_creal(tmp)),
+                        sat_adds16i(lv_cimag(result[n_vec]), lv_cimag(tmp)));
+                }
+        }
+}
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX2 */
+
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 
@@ -0,0 +1,245 @@
+/*!
+ * \file volk_gnsssdr_32f_conv_k7_r2_32u.h
+ * \brief VOLK_GNSSSDR kernel: add-compare-select steps of a Viterbi decoder
+ * for convolutional codes of constraint length 7 and rate 1/2.
+ *
+ * VOLK_GNSSSDR kernel that runs the add-compare-select (ACS) butterflies of
+ * the 64-state trellis for a block of soft symbols, storing the path metrics
+ * and one decision bit per state and trellis stage.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32f_conv_k7_r2_32u
+ *
+ * \b Overview
+ *
+ * Runs num_points stages of the trellis of a K = 7, rate 1/2 convolutional
+ * code, as the ones used by the Galileo I/NAV, F/NAV and C/NAV messages, SBAS
+ * and GPS L2C CNAV. The encoder state is made of the last six input bits, the
+ * newest one being the most significant bit, so the states 2j and 2j + 1 go to
+ * the states j (input bit 0) and j + 32 (input bit 1). The code polynomials must
+ * have their first and last taps set, so that the two branches arriving to a
+ * state have opposite expected symbols.
+ *
+ * For each stage n and butterfly j, the branch metric is
+ * bm = branch_signs[j] * symbols[2n] + branch_signs[32 + j] * symbols[2n + 1],
+ * where branch_signs holds +1 or -1 for the expected symbols of the transition
+ * from state 2j with input bit 0. The path metrics are normalized after each
+ * stage so that the metric of state 0 is zero.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32f_conv_k7_r2_32u(uint32_t* decisions, float* metrics, const float* symbols, const float* branch_signs, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li metrics: Path metrics of the 64 states before the first stage.
+ * \li symbols: 2 * num_points soft symbols, positive values meaning bit 1.
+ * \li branch_signs: 64 signs (+1.0 or -1.0) of the expected symbols.
+ * \li num_points: Number of trellis stages.
+ *
+ * \b Outputs
+ * \li decisions: 2 * num_points words. Bit k of the word 2n (resp. 2n + 1) is
+ * set if the survivor path of state k (resp. k + 32) at stage n comes from the
+ * odd predecessor state.
+ * \li metrics: Path metrics of the 64 states after the last stage.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32f_conv_k7_r2_32u_H
+#define INCLUDED_volk_gnsssdr_32f_conv_k7_r2_32u_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <inttypes.h>
+#include <string.h>
+
+#define VOLK_GNSSSDR_K7_STATES 64
+#define VOLK_GNSSSDR_K7_BUTTERFLIES 32
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32f_conv_k7_r2_32u_generic(uint32_t* decisions, float* metrics, const float* symbols, const float* branch_signs, unsigned int num_points)
+{
+    float old_metrics[VOLK_GNSSSDR_K7_STATES];
+    float new_metrics[VOLK_GNSSSDR_K7_STATES];
+    unsigned int n;
+    unsigned int j;
+    memcpy(old_metrics, metrics, VOLK_GNSSSDR_K7_STATES * sizeof(float));
+
+    for (n = 0; n < num_points; n++)
+        {
+            const float s0 = symbols[2 * n];
+            const float s1 = symbols[2 * n + 1];
+            uint32_t dec_low = 0;
+            uint32_t dec_high = 0;
+            float norm;
+            for (j = 0; j < VOLK_GNSSSDR_K7_BUTTERFLIES; j++)
+                {
+                    const float bm = branch_signs[j] * s0 + branch_signs[VOLK_GNSSSDR_K7_BUTTERFLIES + j] * s1;
+                    const float m0 = old_metrics[2 * j] + bm;
+                    const float m1 = old_metrics[2 * j + 1] - bm;
+                    const float m2 = old_metrics[2 * j] - bm;
+                    const float m3 = old_metrics[2 * j + 1] + bm;
+                    const uint32_t d0 = m1 > m0;
+                    const uint32_t d1 = m3 > m2;
+                    new_metrics[j] = d0 ? m1 : m0;
+                    new_metrics[j + VOLK_GNSSSDR_K7_BUTTERFLIES] = d1 ? m3 : m2;
+                    dec_low |= d0 << j;
+                    dec_high |= d1 << j;
+                }
+            norm = new_metrics[0];
+            for (j = 0; j < VOLK_GNSSSDR_K7_STATES; j++)
+                {
+                    old_metrics[j] = new_metrics[j] - norm;
+                }
+            decisions[2 * n] = dec_low;
+            decisions[2 * n + 1] = dec_high;
+        }
+
+    memcpy(metrics, old_metrics, VOLK_GNSSSDR_K7_STATES * sizeof(float));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32f_conv_k7_r2_32u_avx2(uint32_t* decisions, float* metrics, const float* symbols, const float* branch_signs, unsigned int num_points)
+{
+    __m256 state_metrics[8];  // the 64 path metrics are kept in registers
+    __m256 new_low[4], new_high[4];
+    __m256 sign0[4], sign1[4];
+    __m256 s0, s1, bm, even, odd, m0, m1, m2, m3, norm;
+    unsigned int n;
+    unsigned int i;
+    for (i = 0; i < 8; i++)
+        {
+            state_metrics[i] = _mm256_loadu_ps(metrics + 8 * i);
+        }
+    for (i = 0; i < 4; i++)
+        {
+            sign0[i] = _mm256_loadu_ps(branch_signs + 8 * i);
+            sign1[i] = _mm256_loadu_ps(branch_signs + VOLK_GNSSSDR_K7_BUTTERFLIES + 8 * i);
+        }
+
+    for (n = 0; n < num_points; n++)
+        {
+            uint32_t dec_low = 0;
+            uint32_t dec_high = 0;
+            s0 = _mm256_set1_ps(symbols[2 * n]);
+            s1 = _mm256_set1_ps(symbols[2 * n + 1]);
+            for (i = 0; i < 4; i++)
+                {
+                    // butterflies 8i to 8i + 7. The shuffles work within 128-bit lanes,
+                    // the permutation puts the quadwords back in order
+                    bm = _mm256_add_ps(_mm256_mul_ps(sign0[i], s0), _mm256_mul_ps(sign1[i], s1));
+                    even = _mm256_shuffle_ps(state_metrics[2 * i], state_metrics[2 * i + 1], _MM_SHUFFLE(2, 0, 2, 0));
+                    odd = _mm256_shuffle_ps(state_metrics[2 * i], state_metrics[2 * i + 1], _MM_SHUFFLE(3, 1, 3, 1));
+                    even = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(even), _MM_SHUFFLE(3, 1, 2, 0)));
+                    odd = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(odd), _MM_SHUFFLE(3, 1, 2, 0)));
+                    m0 = _mm256_add_ps(even, bm);
+                    m1 = _mm256_sub_ps(odd, bm);
+                    m2 = _mm256_sub_ps(even, bm);
+                    m3 = _mm256_add_ps(odd, bm);
+                    new_low[i] = _mm256_max_ps(m0, m1);
+                    new_high[i] = _mm256_max_ps(m2, m3);
+                    dec_low |= (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(m1, m0, _CMP_GT_OQ)) << (8 * i);
+                    dec_high |= (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(m3, m2, _CMP_GT_OQ)) << (8 * i);
+                }
+            norm = _mm256_broadcastss_ps(_mm256_castps256_ps128(new_low[0]));
+            for (i = 0; i < 4; i++)
+                {
+                    state_metrics[i] = _mm256_sub_ps(new_low[i], norm);
+                    state_metrics[4 + i] = _mm256_sub_ps(new_high[i], norm);
+                }
+            decisions[2 * n] = dec_low;
+            decisions[2 * n + 1] = dec_high;
+        }
+
+    for (i = 0; i < 8; i++)
+        {
+            _mm256_storeu_ps(metrics + 8 * i, state_metrics[i]);
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32f_conv_k7_r2_32u_avx512f(uint32_t* decisions, float* metrics, const float* symbols, const float* branch_signs, unsigned int num_points)
+{
+    // two-source permutations that pick the even and odd states out of 32
+    const __m512i even_states = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd_states = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    __m512 state_metrics[4];  // the 64 path metrics are kept in registers
+    __m512 new_low[2], new_high[2];
+    __m512 sign0[2], sign1[2];
+    __m512 s0, s1, bm, even, odd, m0, m1, m2, m3;
+    __m512 norm = _mm512_setzero_ps();
+    unsigned int n;
+    unsigned int i;
+    for (i = 0; i < 4; i++)
+        {
+            state_metrics[i] = _mm512_loadu_ps(metrics + 16 * i);
+        }
+    for (i = 0; i < 2; i++)
+        {
+            sign0[i] = _mm512_loadu_ps(branch_signs + 16 * i);
+            sign1[i] = _mm512_loadu_ps(branch_signs + VOLK_GNSSSDR_K7_BUTTERFLIES + 16 * i);
+        }
+
+    for (n = 0; n < num_points; n++)
+        {
+            uint32_t dec_low = 0;
+            uint32_t dec_high = 0;
+            s0 = _mm512_set1_ps(symbols[2 * n]);
+            s1 = _mm512_set1_ps(symbols[2 * n + 1]);
+            for (i = 0; i < 2; i++)
+                {
+                    // butterflies 16i to 16i + 15, from the states 32i to 32i + 31
+                    even = _mm512_sub_ps(_mm512_permutex2var_ps(state_metrics[2 * i], even_states, state_metrics[2 * i + 1]), norm);
+                    odd = _mm512_sub_ps(_mm512_permutex2var_ps(state_metrics[2 * i], odd_states, state_metrics[2 * i + 1]), norm);
+                    bm = _mm512_add_ps(_mm512_mul_ps(sign0[i], s0), _mm512_mul_ps(sign1[i], s1));
+                    m0 = _mm512_add_ps(even, bm);
+                    m1 = _mm512_sub_ps(odd, bm);
+                    m2 = _mm512_sub_ps(even, bm);
+                    m3 = _mm512_add_ps(odd, bm);
+                    new_low[i] = _mm512_max_ps(m0, m1);
+                    new_high[i] = _mm512_max_ps(m2, m3);
+                    dec_low |= (uint32_t)_mm512_cmp_ps_mask(m1, m0, _CMP_GT_OQ) << (16 * i);
+                    dec_high |= (uint32_t)_mm512_cmp_ps_mask(m3, m2, _CMP_GT_OQ) << (16 * i);
+                }
+            norm = _mm512_broadcastss_ps(_mm512_castps512_ps128(new_low[0]));
+            for (i = 0; i < 2; i++)
+                {
+                    state_metrics[i] = new_low[i];
+                    state_metrics[2 + i] = new_high[i];
+                }
+            decisions[2 * n] = dec_low;
+            decisions[2 * n + 1] = dec_high;
+        }
+
+    for (i = 0; i < 4; i++)
+        {
+            _mm512_storeu_ps(metrics + 16 * i, _mm512_sub_ps(state_metrics[i], norm));
+        }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#endif /* INCLUDED_volk_gnsssdr_32f_conv_k7_r2_32u_H */
@@ -0,0 +1,89 @@
+/*!
+ * \file volk_gnsssdr_32f_conv_k7_r2puppet_32u.h
+ * \brief VOLK_GNSSSDR puppet for the K = 7, rate 1/2 Viterbi decoder kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the K = 7, rate 1/2 add-compare-select
+ * kernel into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32f_conv_k7_r2puppet_32u_H
+#define INCLUDED_volk_gnsssdr_32f_conv_k7_r2puppet_32u_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32f_conv_k7_r2_32u.h"
+
+
+// Initial metrics and branch signs of the Galileo code (G1 = 171o, G2 = 133o)
+static inline void volk_gnsssdr_32f_conv_k7_r2_galileo_init(float* metrics, float* branch_signs)
+{
+    const unsigned int g[2] = {121, 91};
+    unsigned int j;
+    unsigned int k;
+    for (j = 0; j < VOLK_GNSSSDR_K7_BUTTERFLIES; j++)
+        {
+            for (k = 0; k < 2; k++)
+                {
+                    unsigned int word = (2 * j) & g[k];
+                    unsigned int parity = 0;
+                    while (word)
+                        {
+                            parity ^= word & 1;
+                            word >>= 1;
+                        }
+                    branch_signs[k * VOLK_GNSSSDR_K7_BUTTERFLIES + j] = parity ? 1.0F : -1.0F;
+                }
+        }
+    metrics[0] = 0.0F;
+    for (j = 1; j < VOLK_GNSSSDR_K7_STATES; j++)
+        {
+            metrics[j] = -10000000.0F;
+        }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32f_conv_k7_r2puppet_32u_generic(uint32_t* decisions, const float* symbols, unsigned int num_points)
+{
+    float metrics[VOLK_GNSSSDR_K7_STATES];
+    float branch_signs[VOLK_GNSSSDR_K7_STATES];
+    volk_gnsssdr_32f_conv_k7_r2_galileo_init(metrics, branch_signs);
+    volk_gnsssdr_32f_conv_k7_r2_32u_generic(decisions, metrics, symbols, branch_signs, num_points / 2);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_32f_conv_k7_r2puppet_32u_avx2(uint32_t* decisions, const float* symbols, unsigned int num_points)
+{
+    float metrics[VOLK_GNSSSDR_K7_STATES];
+    float branch_signs[VOLK_GNSSSDR_K7_STATES];
+    volk_gnsssdr_32f_conv_k7_r2_galileo_init(metrics, branch_signs);
+    volk_gnsssdr_32f_conv_k7_r2_32u_avx2(decisions, metrics, symbols, branch_signs, num_points / 2);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_gnsssdr_32f_conv_k7_r2puppet_32u_avx512f(uint32_t* decisions, const float* symbols, unsigned int num_points)
+{
+    float metrics[VOLK_GNSSSDR_K7_STATES];
+    float branch_signs[VOLK_GNSSSDR_K7_STATES];
+    volk_gnsssdr_32f_conv_k7_r2_galileo_init(metrics, branch_signs);
+    volk_gnsssdr_32f_conv_k7_r2_32u_avx512f(decisions, metrics, symbols, branch_signs, num_points / 2);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#endif /* INCLUDED_volk_gnsssdr_32f_conv_k7_r2puppet_32u_H */
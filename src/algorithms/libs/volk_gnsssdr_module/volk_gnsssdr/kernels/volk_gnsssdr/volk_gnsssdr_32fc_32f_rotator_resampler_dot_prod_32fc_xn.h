@@ -0,0 +1,467 @@
+/*!
+ * \file volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn.h
+ * \brief VOLK_GNSSSDR kernel: resamples a real local code into N delayed replicas on
+ * the fly, multiplies them by a common phase-rotated vector and accumulates the
+ * results in N float complex outputs.
+ *
+ * VOLK_GNSSSDR kernel that fuses volk_gnsssdr_32f_xn_resampler_32f_xn and
+ * volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn: the code chip index of each
+ * sample and correlator tap is computed inside the accumulation loop, so the
+ * resampled replicas are never stored in memory.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn
+ *
+ * \b Overview
+ *
+ * Rotates the reference complex vector and multiplies it by \p num_a_vectors
+ * zero-hold resampled and delayed replicas of the real \p local_code,
+ * accumulates the results and stores them in the output vector. The result is
+ * the same as calling volk_gnsssdr_32f_xn_resampler_32f_xn followed by
+ * volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, without the intermediate
+ * resampled vectors.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_common:             Pointer to the vector to be rotated, multiplied and accumulated (reference vector).
+ * \li phase_inc:             Phase increment = lv_cmake(cos(phase_step_rad), sin(phase_step_rad))
+ * \li phase:                 Initial phase = lv_cmake(cos(initial_phase_rad), sin(initial_phase_rad))
+ * \li local_code:            Real local code replica, sampled at one sample per chip.
+ * \li rem_code_phase_chips:  Remnant code phase [chips].
+ * \li code_phase_step_chips: Phase increment per sample [chips/sample].
+ * \li shifts_chips:          Vector of floats that defines the spacing (in chips) between the replicas of \p local_code
+ * \li code_length_chips:     Code length in chips.
+ * \li num_a_vectors:         Number of correlator taps.
+ * \li num_points:            Number of complex values to be multiplied together, accumulated and stored into \p result.
+ *
+ * \b Outputs
+ * \li phase:                 Final phase.
+ * \li result:                Vector of \p num_a_vectors components with the correlation of \p in_common, rotated, with each replica of \p local_code.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H
+#define INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H
+
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <math.h>
+#include <stdlib.h> /* abs */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_generic(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t tmp32_1, tmp32_2;
+    int local_code_chip_index;
+    int n_vec;
+    unsigned int n;
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+    for (n = 0; n < num_points; n++)
+        {
+            tmp32_1 = *in_common++ * (*phase);
+
+            // Regenerate phase
+            if (n % 256 == 0)
+                {
+#ifdef __cplusplus
+                    (*phase) /= std::abs((*phase));
+#else
+                    (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+#endif
+                }
+
+            (*phase) *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index = (int)floor(code_phase_step_chips * (float)n + shifts_chips[n_vec] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    tmp32_2 = tmp32_1 * local_code[local_code_chip_index];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int i;
+    int local_code_chip_index;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+    lv_32fc_t tmp32_1, tmp32_2;
+    lv_32fc_t _phase;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[4];
+    double lane_inc_im[4];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 4; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[3] * inc_re - lane_inc_im[3] * inc_im;
+    const double vec_inc_im = lane_inc_re[3] * inc_im + lane_inc_im[3] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 4; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m256 ylp = _mm256_set1_ps((float)vec_inc_re);
+    const __m256 yhp = _mm256_set1_ps((float)vec_inc_im);
+    __m256 a, yl, yh, z, four_phase_acc_reg, acc;
+
+    // code resampling registers, as in volk_gnsssdr_32f_xn_resampler_32f_xn_u_avx
+    const __m256 eights = _mm256_set1_ps(8.0f);
+    const __m256 zeros = _mm256_setzero_ps();
+    const __m256 code_phase_step_chips_reg = _mm256_set1_ps(code_phase_step_chips);
+    const __m256 code_length_chips_reg_f = _mm256_set1_ps((float)code_length_chips);
+    const __m256 n0 = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    // each real chip multiplies both components of its complex sample
+    const __m256i dup_lo = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    const __m256i dup_hi = _mm256_set_epi32(7, 7, 6, 6, 5, 5, 4, 4);
+    __m256i local_code_chip_index_reg, ii;
+    __m256 aux, aux2, aux3, c, cTrunc, base, negatives, indexn;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common
+            for (i = 0; i < 4; i++)
+                {
+                    four_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+            for (number = 0; number < block_points; number += 4)
+                {
+                    a = _mm256_loadu_ps((const float*)(in_common + block_start + number));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);  // Load yh with ci,ci,di,di
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    _mm256_store_ps((float*)(rotated + number), _mm256_fmaddsub_ps(a, yl, z));
+
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+                }
+
+            // One pass per correlator tap. The code chip indexes of eight samples are
+            // computed in registers and the chips are gathered from local_code, so
+            // the resampled replicas are never written to memory.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    aux2 = _mm256_set1_ps(shifts_chips[n_vec] - rem_code_phase_chips);
+                    indexn = _mm256_add_ps(n0, _mm256_set1_ps((float)block_start));
+                    acc = _mm256_setzero_ps();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            aux = _mm256_fmadd_ps(code_phase_step_chips_reg, indexn, aux2);
+                            // floor
+                            aux = _mm256_floor_ps(aux);
+                            // fmod
+                            c = _mm256_div_ps(aux, code_length_chips_reg_f);
+                            ii = _mm256_cvttps_epi32(c);
+                            cTrunc = _mm256_cvtepi32_ps(ii);
+                            base = _mm256_fnmadd_ps(cTrunc, code_length_chips_reg_f, aux);
+                            local_code_chip_index_reg = _mm256_cvttps_epi32(base);
+                            // no negatives
+                            c = _mm256_cvtepi32_ps(local_code_chip_index_reg);
+                            negatives = _mm256_cmp_ps(c, zeros, 0x01);
+                            aux3 = _mm256_and_ps(code_length_chips_reg_f, negatives);
+                            aux = _mm256_add_ps(c, aux3);
+                            local_code_chip_index_reg = _mm256_cvttps_epi32(aux);
+                            indexn = _mm256_add_ps(indexn, eights);
+
+                            a = _mm256_i32gather_ps(local_code, local_code_chip_index_reg, 4);
+                            z = _mm256_load_ps((float*)(rotated + number));
+                            acc = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(a, dup_lo), z, acc);
+                            z = _mm256_load_ps((float*)(rotated + number + 4));
+                            acc = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(a, dup_hi), z, acc);
+                        }
+                    _mm256_store_ps((float*)dotProductVector, acc);  // Store the results back into the dot product vector
+                    for (n = 0; n < 4; n++)
+                        {
+                            result[n_vec] += dotProductVector[n];
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    _phase = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp32_1 = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index = (int)floor(code_phase_step_chips * (float)n + shifts_chips[n_vec] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    tmp32_2 = tmp32_1 * local_code[local_code_chip_index];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int i;
+    int local_code_chip_index;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+    lv_32fc_t tmp32_1, tmp32_2;
+    lv_32fc_t _phase;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[4];
+    double lane_inc_im[4];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 4; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[3] * inc_re - lane_inc_im[3] * inc_im;
+    const double vec_inc_im = lane_inc_re[3] * inc_im + lane_inc_im[3] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 4; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m256 ylp = _mm256_set1_ps((float)vec_inc_re);
+    const __m256 yhp = _mm256_set1_ps((float)vec_inc_im);
+    __m256 a, yl, yh, z, four_phase_acc_reg, acc;
+
+    // code resampling registers, as in volk_gnsssdr_32f_xn_resampler_32f_xn_u_avx
+    const __m256 eights = _mm256_set1_ps(8.0f);
+    const __m256 zeros = _mm256_setzero_ps();
+    const __m256 code_phase_step_chips_reg = _mm256_set1_ps(code_phase_step_chips);
+    const __m256 code_length_chips_reg_f = _mm256_set1_ps((float)code_length_chips);
+    const __m256 n0 = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    // each real chip multiplies both components of its complex sample
+    const __m256i dup_lo = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    const __m256i dup_hi = _mm256_set_epi32(7, 7, 6, 6, 5, 5, 4, 4);
+    __m256i local_code_chip_index_reg, ii;
+    __m256 aux, aux2, aux3, c, cTrunc, base, negatives, indexn;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common
+            for (i = 0; i < 4; i++)
+                {
+                    four_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+            for (number = 0; number < block_points; number += 4)
+                {
+                    a = _mm256_load_ps((const float*)(in_common + block_start + number));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);  // Load yh with ci,ci,di,di
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    _mm256_store_ps((float*)(rotated + number), _mm256_fmaddsub_ps(a, yl, z));
+
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+                }
+
+            // One pass per correlator tap. The code chip indexes of eight samples are
+            // computed in registers and the chips are gathered from local_code, so
+            // the resampled replicas are never written to memory.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    aux2 = _mm256_set1_ps(shifts_chips[n_vec] - rem_code_phase_chips);
+                    indexn = _mm256_add_ps(n0, _mm256_set1_ps((float)block_start));
+                    acc = _mm256_setzero_ps();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            aux = _mm256_fmadd_ps(code_phase_step_chips_reg, indexn, aux2);
+                            // floor
+                            aux = _mm256_floor_ps(aux);
+                            // fmod
+                            c = _mm256_div_ps(aux, code_length_chips_reg_f);
+                            ii = _mm256_cvttps_epi32(c);
+                            cTrunc = _mm256_cvtepi32_ps(ii);
+                            base = _mm256_fnmadd_ps(cTrunc, code_length_chips_reg_f, aux);
+                            local_code_chip_index_reg = _mm256_cvttps_epi32(base);
+                            // no negatives
+                            c = _mm256_cvtepi32_ps(local_code_chip_index_reg);
+                            negatives = _mm256_cmp_ps(c, zeros, 0x01);
+                            aux3 = _mm256_and_ps(code_length_chips_reg_f, negatives);
+                            aux = _mm256_add_ps(c, aux3);
+                            local_code_chip_index_reg = _mm256_cvttps_epi32(aux);
+                            indexn = _mm256_add_ps(indexn, eights);
+
+                            a = _mm256_i32gather_ps(local_code, local_code_chip_index_reg, 4);
+                            z = _mm256_load_ps((float*)(rotated + number));
+                            acc = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(a, dup_lo), z, acc);
+                            z = _mm256_load_ps((float*)(rotated + number + 4));
+                            acc = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(a, dup_hi), z, acc);
+                        }
+                    _mm256_store_ps((float*)dotProductVector, acc);  // Store the results back into the dot product vector
+                    for (n = 0; n < 4; n++)
+                        {
+                            result[n_vec] += dotProductVector[n];
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    _phase = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp32_1 = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index = (int)floor(code_phase_step_chips * (float)n + shifts_chips[n_vec] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    tmp32_2 = tmp32_1 * local_code[local_code_chip_index];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_H */
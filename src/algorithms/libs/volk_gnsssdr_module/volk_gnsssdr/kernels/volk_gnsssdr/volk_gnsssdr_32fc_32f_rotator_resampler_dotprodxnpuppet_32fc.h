@@ -0,0 +1,94 @@
+/*!
+ * \file volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc.h
+ * \brief Volk puppet for the fused real code resampler and multiple dot product kernel.
+ *
+ * Volk puppet for integrating the fused kernel into volk's test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <math.h>
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_generic(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    // dyadic code phases, so that all the implementations pick the same chips
+    unsigned int code_length_chips = 1023;
+    float code_phase_step_chips = 0.25;
+    float rem_code_phase_chips = 0.125;
+    float shifts_chips[3] = {-0.5, 0.0, 0.5};
+    int num_a_vectors = 3;
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_generic(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // Generic
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    // dyadic code phases, so that all the implementations pick the same chips
+    unsigned int code_length_chips = 1023;
+    float code_phase_step_chips = 0.25;
+    float rem_code_phase_chips = 0.125;
+    float shifts_chips[3] = {-0.5, 0.0, 0.5};
+    int num_a_vectors = 3;
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_u_avx2_fma(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // AVX2 && FMA
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_a_avx2_fma(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    // phases must be normalized. Phase rotator expects a complex exponential input!
+    float rem_carrier_phase_in_rad = 0.25;
+    float phase_step_rad = 0.1;
+    lv_32fc_t phase[1];
+    phase[0] = lv_cmake(cos(rem_carrier_phase_in_rad), sin(rem_carrier_phase_in_rad));
+    lv_32fc_t phase_inc[1];
+    phase_inc[0] = lv_cmake(cos(phase_step_rad), sin(phase_step_rad));
+    // dyadic code phases, so that all the implementations pick the same chips
+    unsigned int code_length_chips = 1023;
+    float code_phase_step_chips = 0.25;
+    float rem_code_phase_chips = 0.125;
+    float shifts_chips[3] = {-0.5, 0.0, 0.5};
+    int num_a_vectors = 3;
+
+    volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn_a_avx2_fma(result, local_code, phase_inc[0], phase, in, rem_code_phase_chips, code_phase_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+
+#endif  // AVX2 && FMA
+
+#endif  // INCLUDED_volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc_H
@@ -633,6 +633,752 @@ static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_t
 #endif /* LV_HAVE_AVX */
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 4) * 4;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+    lv_32fc_t tmp32_1, tmp32_2;
+    lv_32fc_t _phase;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[4];
+    double lane_inc_im[4];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 4; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[3] * inc_re - lane_inc_im[3] * inc_im;
+    const double vec_inc_im = lane_inc_re[3] * inc_im + lane_inc_im[3] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 4; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m256 ylp = _mm256_set1_ps((float)vec_inc_re);
+    const __m256 yhp = _mm256_set1_ps((float)vec_inc_im);
+    __m256 a, yl, yh, z, four_phase_acc_reg;
+    __m256 acc0r, acc0i, acc1r, acc1i, acc2r, acc2i, acc3r, acc3i;
+    __m256 taps[4];
+    const float* code0;
+    const float* code1;
+    const float* code2;
+    const float* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common
+            for (i = 0; i < 4; i++)
+                {
+                    four_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+            for (number = 0; number < block_points; number += 4)
+                {
+                    a = _mm256_loadu_ps((const float*)(in_common + block_start + number));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);  // Load yh with ci,ci,di,di
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    _mm256_store_ps((float*)(rotated + number), _mm256_fmaddsub_ps(a, yl, z));
+
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // accXr accumulates code * real(sample) and accXi swap(code) * imag(sample),
+            // so the complex products only need an addsub at the end of the block.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = (const float*)(in_a[n_vec] + block_start);
+                    code1 = (const float*)(in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start);
+                    code2 = (const float*)(in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start);
+                    code3 = (const float*)(in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start);
+                    acc0r = _mm256_setzero_ps();
+                    acc0i = _mm256_setzero_ps();
+                    acc1r = _mm256_setzero_ps();
+                    acc1i = _mm256_setzero_ps();
+                    acc2r = _mm256_setzero_ps();
+                    acc2i = _mm256_setzero_ps();
+                    acc3r = _mm256_setzero_ps();
+                    acc3i = _mm256_setzero_ps();
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            z = _mm256_load_ps((float*)(rotated + number));
+                            yl = _mm256_moveldup_ps(z);
+                            yh = _mm256_movehdup_ps(z);
+                            a = _mm256_loadu_ps(code0 + 2 * number);
+                            acc0r = _mm256_fmadd_ps(a, yl, acc0r);
+                            acc0i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc0i);
+                            if (n_taps > 1)
+                                {
+                                    a = _mm256_loadu_ps(code1 + 2 * number);
+                                    acc1r = _mm256_fmadd_ps(a, yl, acc1r);
+                                    acc1i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc1i);
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a = _mm256_loadu_ps(code2 + 2 * number);
+                                    acc2r = _mm256_fmadd_ps(a, yl, acc2r);
+                                    acc2i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc2i);
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a = _mm256_loadu_ps(code3 + 2 * number);
+                                    acc3r = _mm256_fmadd_ps(a, yl, acc3r);
+                                    acc3i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc3i);
+                                }
+                        }
+                    taps[0] = _mm256_addsub_ps(acc0r, acc0i);
+                    taps[1] = _mm256_addsub_ps(acc1r, acc1i);
+                    taps[2] = _mm256_addsub_ps(acc2r, acc2i);
+                    taps[3] = _mm256_addsub_ps(acc3r, acc3i);
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm256_store_ps((float*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 4; n++)
+                                {
+                                    result[n_vec + i] += dotProductVector[n];
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    _phase = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp32_1 = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 4) * 4;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+    lv_32fc_t tmp32_1, tmp32_2;
+    lv_32fc_t _phase;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[4];
+    double lane_inc_im[4];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 4; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[3] * inc_re - lane_inc_im[3] * inc_im;
+    const double vec_inc_im = lane_inc_re[3] * inc_im + lane_inc_im[3] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 4; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m256 ylp = _mm256_set1_ps((float)vec_inc_re);
+    const __m256 yhp = _mm256_set1_ps((float)vec_inc_im);
+    __m256 a, yl, yh, z, four_phase_acc_reg;
+    __m256 acc0r, acc0i, acc1r, acc1i, acc2r, acc2i, acc3r, acc3i;
+    __m256 taps[4];
+    const float* code0;
+    const float* code1;
+    const float* code2;
+    const float* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common
+            for (i = 0; i < 4; i++)
+                {
+                    four_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+            for (number = 0; number < block_points; number += 4)
+                {
+                    a = _mm256_load_ps((const float*)(in_common + block_start + number));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm256_moveldup_ps(four_phase_acc_reg);  // Load yl with cr,cr,dr,dr
+                    yh = _mm256_movehdup_ps(four_phase_acc_reg);  // Load yh with ci,ci,di,di
+                    z = _mm256_mul_ps(_mm256_permute_ps(a, 0xB1), yh);
+                    _mm256_store_ps((float*)(rotated + number), _mm256_fmaddsub_ps(a, yl, z));
+
+                    z = _mm256_mul_ps(_mm256_permute_ps(four_phase_acc_reg, 0xB1), yhp);
+                    four_phase_acc_reg = _mm256_fmaddsub_ps(four_phase_acc_reg, ylp, z);
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // accXr accumulates code * real(sample) and accXi swap(code) * imag(sample),
+            // so the complex products only need an addsub at the end of the block.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = (const float*)(in_a[n_vec] + block_start);
+                    code1 = (const float*)(in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start);
+                    code2 = (const float*)(in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start);
+                    code3 = (const float*)(in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start);
+                    acc0r = _mm256_setzero_ps();
+                    acc0i = _mm256_setzero_ps();
+                    acc1r = _mm256_setzero_ps();
+                    acc1i = _mm256_setzero_ps();
+                    acc2r = _mm256_setzero_ps();
+                    acc2i = _mm256_setzero_ps();
+                    acc3r = _mm256_setzero_ps();
+                    acc3i = _mm256_setzero_ps();
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            z = _mm256_load_ps((float*)(rotated + number));
+                            yl = _mm256_moveldup_ps(z);
+                            yh = _mm256_movehdup_ps(z);
+                            a = _mm256_load_ps(code0 + 2 * number);
+                            acc0r = _mm256_fmadd_ps(a, yl, acc0r);
+                            acc0i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc0i);
+                            if (n_taps > 1)
+                                {
+                                    a = _mm256_load_ps(code1 + 2 * number);
+                                    acc1r = _mm256_fmadd_ps(a, yl, acc1r);
+                                    acc1i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc1i);
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a = _mm256_load_ps(code2 + 2 * number);
+                                    acc2r = _mm256_fmadd_ps(a, yl, acc2r);
+                                    acc2i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc2i);
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a = _mm256_load_ps(code3 + 2 * number);
+                                    acc3r = _mm256_fmadd_ps(a, yl, acc3r);
+                                    acc3i = _mm256_fmadd_ps(_mm256_permute_ps(a, 0xB1), yh, acc3i);
+                                }
+                        }
+                    taps[0] = _mm256_addsub_ps(acc0r, acc0i);
+                    taps[1] = _mm256_addsub_ps(acc1r, acc1i);
+                    taps[2] = _mm256_addsub_ps(acc2r, acc2i);
+                    taps[3] = _mm256_addsub_ps(acc3r, acc3i);
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm256_store_ps((float*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 4; n++)
+                                {
+                                    result[n_vec + i] += dotProductVector[n];
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 4)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    _phase = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp32_1 = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+    lv_32fc_t tmp32_1, tmp32_2;
+    lv_32fc_t _phase;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[8];
+    double lane_inc_im[8];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 8; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[7] * inc_re - lane_inc_im[7] * inc_im;
+    const double vec_inc_im = lane_inc_re[7] * inc_im + lane_inc_im[7] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 8; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m512 ones = _mm512_set1_ps(1.0f);
+    const __m512 ylp = _mm512_set1_ps((float)vec_inc_re);
+    const __m512 yhp = _mm512_set1_ps((float)vec_inc_im);
+    __m512 a, yl, yh, z, eight_phase_acc_reg;
+    __m512 acc0r, acc0i, acc1r, acc1i, acc2r, acc2i, acc3r, acc3i;
+    __m512 taps[4];
+    const float* code0;
+    const float* code1;
+    const float* code2;
+    const float* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common
+            for (i = 0; i < 8; i++)
+                {
+                    eight_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+            for (number = 0; number < block_points; number += 8)
+                {
+                    a = _mm512_loadu_ps((const float*)(in_common + block_start + number));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm512_moveldup_ps(eight_phase_acc_reg);
+                    yh = _mm512_movehdup_ps(eight_phase_acc_reg);
+                    z = _mm512_mul_ps(_mm512_permute_ps(a, 0xB1), yh);
+                    _mm512_store_ps((float*)(rotated + number), _mm512_fmaddsub_ps(a, yl, z));
+
+                    z = _mm512_mul_ps(_mm512_permute_ps(eight_phase_acc_reg, 0xB1), yhp);
+                    eight_phase_acc_reg = _mm512_fmaddsub_ps(eight_phase_acc_reg, ylp, z);
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // accXr accumulates code * real(sample) and accXi swap(code) * imag(sample),
+            // so the complex products only need an addsub at the end of the block.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = (const float*)(in_a[n_vec] + block_start);
+                    code1 = (const float*)(in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start);
+                    code2 = (const float*)(in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start);
+                    code3 = (const float*)(in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start);
+                    acc0r = _mm512_setzero_ps();
+                    acc0i = _mm512_setzero_ps();
+                    acc1r = _mm512_setzero_ps();
+                    acc1i = _mm512_setzero_ps();
+                    acc2r = _mm512_setzero_ps();
+                    acc2i = _mm512_setzero_ps();
+                    acc3r = _mm512_setzero_ps();
+                    acc3i = _mm512_setzero_ps();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            z = _mm512_load_ps((float*)(rotated + number));
+                            yl = _mm512_moveldup_ps(z);
+                            yh = _mm512_movehdup_ps(z);
+                            a = _mm512_loadu_ps(code0 + 2 * number);
+                            acc0r = _mm512_fmadd_ps(a, yl, acc0r);
+                            acc0i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc0i);
+                            if (n_taps > 1)
+                                {
+                                    a = _mm512_loadu_ps(code1 + 2 * number);
+                                    acc1r = _mm512_fmadd_ps(a, yl, acc1r);
+                                    acc1i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc1i);
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a = _mm512_loadu_ps(code2 + 2 * number);
+                                    acc2r = _mm512_fmadd_ps(a, yl, acc2r);
+                                    acc2i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc2i);
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a = _mm512_loadu_ps(code3 + 2 * number);
+                                    acc3r = _mm512_fmadd_ps(a, yl, acc3r);
+                                    acc3i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc3i);
+                                }
+                        }
+                    taps[0] = _mm512_fmaddsub_ps(acc0r, ones, acc0i);
+                    taps[1] = _mm512_fmaddsub_ps(acc1r, ones, acc1i);
+                    taps[2] = _mm512_fmaddsub_ps(acc2r, ones, acc2i);
+                    taps[3] = _mm512_fmaddsub_ps(acc3r, ones, acc3i);
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm512_store_ps((float*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 8; n++)
+                                {
+                                    result[n_vec + i] += dotProductVector[n];
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    _phase = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp32_1 = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int ROTATOR_BLOCK = 256;
+    const unsigned int vec_points = (num_points / 8) * 8;
+    int n_vec;
+    int n_taps;
+    int i;
+    unsigned int block_start;
+    unsigned int block_points;
+    unsigned int number;
+    unsigned int n;
+    lv_32fc_t tmp32_1, tmp32_2;
+    lv_32fc_t _phase;
+
+    // in_common rotated by the carrier, one block at a time (stays in L1 cache)
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t rotated[256];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    // The phasor of the first sample of each block is computed in double
+    // precision from a unit-modulus increment, and the single precision
+    // recurrence only runs inside a block, so no renormalization is needed.
+    double mag = sqrt((double)lv_creal(phase_inc) * (double)lv_creal(phase_inc) + (double)lv_cimag(phase_inc) * (double)lv_cimag(phase_inc));
+    const double inc_re = (double)lv_creal(phase_inc) / mag;
+    const double inc_im = (double)lv_cimag(phase_inc) / mag;
+    mag = sqrt((double)lv_creal(*phase) * (double)lv_creal(*phase) + (double)lv_cimag(*phase) * (double)lv_cimag(*phase));
+    double block_phase_re = (double)lv_creal(*phase) / mag;
+    double block_phase_im = (double)lv_cimag(*phase) / mag;
+    double tmp_re;
+
+    double lane_inc_re[8];
+    double lane_inc_im[8];
+    lane_inc_re[0] = 1.0;
+    lane_inc_im[0] = 0.0;
+    for (i = 1; i < 8; i++)
+        {
+            lane_inc_re[i] = lane_inc_re[i - 1] * inc_re - lane_inc_im[i - 1] * inc_im;
+            lane_inc_im[i] = lane_inc_re[i - 1] * inc_im + lane_inc_im[i - 1] * inc_re;
+        }
+    const double vec_inc_re = lane_inc_re[7] * inc_re - lane_inc_im[7] * inc_im;
+    const double vec_inc_im = lane_inc_re[7] * inc_im + lane_inc_im[7] * inc_re;
+    double block_inc_re = vec_inc_re;
+    double block_inc_im = vec_inc_im;
+    for (n = 8; n < ROTATOR_BLOCK; n *= 2)
+        {
+            tmp_re = block_inc_re * block_inc_re - block_inc_im * block_inc_im;
+            block_inc_im = 2.0 * block_inc_re * block_inc_im;
+            block_inc_re = tmp_re;
+        }
+
+    const __m512 ones = _mm512_set1_ps(1.0f);
+    const __m512 ylp = _mm512_set1_ps((float)vec_inc_re);
+    const __m512 yhp = _mm512_set1_ps((float)vec_inc_im);
+    __m512 a, yl, yh, z, eight_phase_acc_reg;
+    __m512 acc0r, acc0i, acc1r, acc1i, acc2r, acc2i, acc3r, acc3i;
+    __m512 taps[4];
+    const float* code0;
+    const float* code1;
+    const float* code2;
+    const float* code3;
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0.0f, 0.0f);
+        }
+
+    for (block_start = 0; block_start < vec_points; block_start += ROTATOR_BLOCK)
+        {
+            block_points = vec_points - block_start < ROTATOR_BLOCK ? vec_points - block_start : ROTATOR_BLOCK;
+
+            // Phase rotation of the block of in_common
+            for (i = 0; i < 8; i++)
+                {
+                    eight_phase_acc[i] = lv_cmake((float)(block_phase_re * lane_inc_re[i] - block_phase_im * lane_inc_im[i]), (float)(block_phase_re * lane_inc_im[i] + block_phase_im * lane_inc_re[i]));
+                }
+            eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+            for (number = 0; number < block_points; number += 8)
+                {
+                    a = _mm512_load_ps((const float*)(in_common + block_start + number));
+                    __VOLK_GNSSSDR_PREFETCH(in_common + block_start + number + 16);
+                    yl = _mm512_moveldup_ps(eight_phase_acc_reg);
+                    yh = _mm512_movehdup_ps(eight_phase_acc_reg);
+                    z = _mm512_mul_ps(_mm512_permute_ps(a, 0xB1), yh);
+                    _mm512_store_ps((float*)(rotated + number), _mm512_fmaddsub_ps(a, yl, z));
+
+                    z = _mm512_mul_ps(_mm512_permute_ps(eight_phase_acc_reg, 0xB1), yhp);
+                    eight_phase_acc_reg = _mm512_fmaddsub_ps(eight_phase_acc_reg, ylp, z);
+                }
+
+            // Up to four correlator taps per pass, with their accumulators held in registers.
+            // accXr accumulates code * real(sample) and accXi swap(code) * imag(sample),
+            // so the complex products only need an addsub at the end of the block.
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec += 4)
+                {
+                    n_taps = num_a_vectors - n_vec < 4 ? num_a_vectors - n_vec : 4;
+                    code0 = (const float*)(in_a[n_vec] + block_start);
+                    code1 = (const float*)(in_a[n_vec + (n_taps > 1 ? 1 : 0)] + block_start);
+                    code2 = (const float*)(in_a[n_vec + (n_taps > 2 ? 2 : 0)] + block_start);
+                    code3 = (const float*)(in_a[n_vec + (n_taps > 3 ? 3 : 0)] + block_start);
+                    acc0r = _mm512_setzero_ps();
+                    acc0i = _mm512_setzero_ps();
+                    acc1r = _mm512_setzero_ps();
+                    acc1i = _mm512_setzero_ps();
+                    acc2r = _mm512_setzero_ps();
+                    acc2i = _mm512_setzero_ps();
+                    acc3r = _mm512_setzero_ps();
+                    acc3i = _mm512_setzero_ps();
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            z = _mm512_load_ps((float*)(rotated + number));
+                            yl = _mm512_moveldup_ps(z);
+                            yh = _mm512_movehdup_ps(z);
+                            a = _mm512_load_ps(code0 + 2 * number);
+                            acc0r = _mm512_fmadd_ps(a, yl, acc0r);
+                            acc0i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc0i);
+                            if (n_taps > 1)
+                                {
+                                    a = _mm512_load_ps(code1 + 2 * number);
+                                    acc1r = _mm512_fmadd_ps(a, yl, acc1r);
+                                    acc1i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc1i);
+                                }
+                            if (n_taps > 2)
+                                {
+                                    a = _mm512_load_ps(code2 + 2 * number);
+                                    acc2r = _mm512_fmadd_ps(a, yl, acc2r);
+                                    acc2i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc2i);
+                                }
+                            if (n_taps > 3)
+                                {
+                                    a = _mm512_load_ps(code3 + 2 * number);
+                                    acc3r = _mm512_fmadd_ps(a, yl, acc3r);
+                                    acc3i = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc3i);
+                                }
+                        }
+                    taps[0] = _mm512_fmaddsub_ps(acc0r, ones, acc0i);
+                    taps[1] = _mm512_fmaddsub_ps(acc1r, ones, acc1i);
+                    taps[2] = _mm512_fmaddsub_ps(acc2r, ones, acc2i);
+                    taps[3] = _mm512_fmaddsub_ps(acc3r, ones, acc3i);
+                    for (i = 0; i < n_taps; i++)
+                        {
+                            _mm512_store_ps((float*)dotProductVector, taps[i]);  // Store the results back into the dot product vector
+                            for (n = 0; n < 8; n++)
+                                {
+                                    result[n_vec + i] += dotProductVector[n];
+                                }
+                        }
+                }
+
+            // Phasor of the first sample of the next block
+            if (block_points == ROTATOR_BLOCK)
+                {
+                    tmp_re = block_phase_re * block_inc_re - block_phase_im * block_inc_im;
+                    block_phase_im = block_phase_re * block_inc_im + block_phase_im * block_inc_re;
+                    block_phase_re = tmp_re;
+                }
+            else
+                {
+                    for (number = 0; number < block_points; number += 8)
+                        {
+                            tmp_re = block_phase_re * vec_inc_re - block_phase_im * vec_inc_im;
+                            block_phase_im = block_phase_re * vec_inc_im + block_phase_im * vec_inc_re;
+                            block_phase_re = tmp_re;
+                        }
+                }
+        }
+
+    _phase = lv_cmake((float)block_phase_re, (float)block_phase_im);
+    for (n = vec_points; n < num_points; n++)
+        {
+            tmp32_1 = in_common[n] * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_NEON
 #include <arm_neon.h>
 
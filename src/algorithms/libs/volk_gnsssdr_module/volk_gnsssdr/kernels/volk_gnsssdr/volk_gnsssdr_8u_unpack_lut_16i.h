@@ -0,0 +1,153 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack_lut_16i.h
+ * \brief VOLK_GNSSSDR kernel: expands packed 1, 2 or 4-bit samples to 16-bit
+ * integers through nibble lookup tables.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack_lut_16i
+ *
+ * \b Overview
+ *
+ * Same as volk_gnsssdr_8u_unpack_lut_8i, but writing 16-bit integers. The
+ * samples are unpacked in blocks that stay in the L1 cache and then widened.
+ * Interleaved I/Q samples are written as lv_16sc_t values.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack_lut_16i(int16_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples, num_points * bits_per_sample / 8 bytes.
+ * \li lut: 128 / bits_per_sample values (32, 64 or 128).
+ * \li bits_per_sample: Bits per sample (1, 2 or 4).
+ * \li flags: Bitwise OR of the VOLK_GNSSSDR_UNPACK_* flags.
+ * \li num_points: Number of samples to be unpacked.
+ *
+ * \b Outputs
+ * \li result: The unpacked samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack_lut_16i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack_lut_16i_H
+
+#include "volk_gnsssdr/volk_gnsssdr_8u_unpack_lut_8i.h"
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack_lut_16i_generic(int16_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            volk_gnsssdr_8u_unpack_lut_8i_generic(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i < block_points; i++)
+                {
+                    result[n + i] = (int16_t)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_16i_u_ssse3(int16_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(16)
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    __m128i x;
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            volk_gnsssdr_8u_unpack_lut_8i_u_ssse3(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i + 16 <= block_points; i += 16)
+                {
+                    x = _mm_load_si128((const __m128i*)(block + i));
+                    // Sign extension: duplicate each byte and shift it down
+                    _mm_storeu_si128((__m128i*)(result + n + i), _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8));
+                    _mm_storeu_si128((__m128i*)(result + n + i + 8), _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8));
+                }
+            for (; i < block_points; i++)
+                {
+                    result[n + i] = (int16_t)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_16i_u_avx2(int16_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32)
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            volk_gnsssdr_8u_unpack_lut_8i_u_avx2(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i + 16 <= block_points; i += 16)
+                {
+                    _mm256_storeu_si256((__m256i*)(result + n + i), _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i*)(block + i))));
+                }
+            for (; i < block_points; i++)
+                {
+                    result[n + i] = (int16_t)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_16i_neon(int16_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            volk_gnsssdr_8u_unpack_lut_8i_neon(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i + 8 <= block_points; i += 8)
+                {
+                    vst1q_s16(result + n + i, vmovl_s8(vld1_s8(block + i)));
+                }
+            for (; i < block_points; i++)
+                {
+                    result[n + i] = (int16_t)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack_lut_16i_H */
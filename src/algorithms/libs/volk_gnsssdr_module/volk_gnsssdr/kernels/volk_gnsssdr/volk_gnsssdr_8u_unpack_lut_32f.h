@@ -0,0 +1,169 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack_lut_32f.h
+ * \brief VOLK_GNSSSDR kernel: expands packed 1, 2 or 4-bit samples to 32-bit
+ * floats through nibble lookup tables.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack_lut_32f
+ *
+ * \b Overview
+ *
+ * Same as volk_gnsssdr_8u_unpack_lut_8i, but writing floats. The samples are
+ * unpacked in blocks that stay in the L1 cache and then converted. Interleaved
+ * I/Q samples are written as lv_32fc_t values.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack_lut_32f(float* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples, num_points * bits_per_sample / 8 bytes.
+ * \li lut: 128 / bits_per_sample values (32, 64 or 128).
+ * \li bits_per_sample: Bits per sample (1, 2 or 4).
+ * \li flags: Bitwise OR of the VOLK_GNSSSDR_UNPACK_* flags.
+ * \li num_points: Number of samples to be unpacked.
+ *
+ * \b Outputs
+ * \li result: The unpacked samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack_lut_32f_H
+#define INCLUDED_volk_gnsssdr_8u_unpack_lut_32f_H
+
+#include "volk_gnsssdr/volk_gnsssdr_8u_unpack_lut_8i.h"
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack_lut_32f_generic(float* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            volk_gnsssdr_8u_unpack_lut_8i_generic(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i < block_points; i++)
+                {
+                    result[n + i] = (float)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_32f_u_ssse3(float* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(16)
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    __m128i x, low, high;
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            float* out_ptr = result + n;
+            volk_gnsssdr_8u_unpack_lut_8i_u_ssse3(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i + 16 <= block_points; i += 16)
+                {
+                    x = _mm_load_si128((const __m128i*)(block + i));
+                    // Sign extension: duplicate each byte (word) and shift it down
+                    low = _mm_unpacklo_epi8(x, x);
+                    high = _mm_unpackhi_epi8(x, x);
+                    _mm_storeu_ps(out_ptr, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(low, low), 24)));
+                    _mm_storeu_ps(out_ptr + 4, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(low, low), 24)));
+                    _mm_storeu_ps(out_ptr + 8, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(high, high), 24)));
+                    _mm_storeu_ps(out_ptr + 12, _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(high, high), 24)));
+                    out_ptr += 16;
+                }
+            for (; i < block_points; i++)
+                {
+                    *out_ptr++ = (float)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_32f_u_avx2(float* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32)
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    __m128i x;
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            float* out_ptr = result + n;
+            volk_gnsssdr_8u_unpack_lut_8i_u_avx2(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i + 16 <= block_points; i += 16)
+                {
+                    x = _mm_load_si128((const __m128i*)(block + i));
+                    _mm256_storeu_ps(out_ptr, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(x)));
+                    _mm256_storeu_ps(out_ptr + 8, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(x, 8))));
+                    out_ptr += 16;
+                }
+            for (; i < block_points; i++)
+                {
+                    *out_ptr++ = (float)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_32f_neon(float* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    int8_t block[VOLK_GNSSSDR_UNPACK_BLOCK];
+    int16x8_t x;
+    unsigned int n;
+    unsigned int i;
+    for (n = 0; n < num_points; n += VOLK_GNSSSDR_UNPACK_BLOCK)
+        {
+            const unsigned int block_points = num_points - n < VOLK_GNSSSDR_UNPACK_BLOCK ? num_points - n : VOLK_GNSSSDR_UNPACK_BLOCK;
+            float* out_ptr = result + n;
+            volk_gnsssdr_8u_unpack_lut_8i_neon(block, packed + n / 8 * bits_per_sample, lut, bits_per_sample, flags, block_points);
+            for (i = 0; i + 8 <= block_points; i += 8)
+                {
+                    x = vmovl_s8(vld1_s8(block + i));
+                    vst1q_f32(out_ptr, vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))));
+                    vst1q_f32(out_ptr + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))));
+                    out_ptr += 8;
+                }
+            for (; i < block_points; i++)
+                {
+                    *out_ptr++ = (float)block[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack_lut_32f_H */
@@ -0,0 +1,440 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack_lut_8i.h
+ * \brief VOLK_GNSSSDR kernel: expands packed 1, 2 or 4-bit samples to 8-bit
+ * integers through nibble lookup tables.
+ *
+ * VOLK_GNSSSDR kernel that unpacks the samples delivered by front-ends that
+ * pack several samples per byte, as most raw IF recordings do.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack_lut_8i
+ *
+ * \b Overview
+ *
+ * Expands num_points samples of bits_per_sample bits (1, 2 or 4), packed in
+ * bytes, into one signed 8-bit integer per sample. Each byte is split in two
+ * nibbles, and each nibble holds 4 / bits_per_sample samples. The m-th output
+ * sample of a byte is lut[16 * m + nibble], where nibble is the first nibble
+ * of the byte for the first half of the samples of the byte and the second
+ * nibble for the rest. The tables can be filled with
+ * volk_gnsssdr_8u_unpack_lut_init(), which takes care of the sample order,
+ * the sample coding, and optionally of swapping the I and Q samples and of
+ * inverting the spectrum (negating the Q samples) for free. The SIMD versions
+ * look up 16 or 32 nibbles at once with byte shuffles.
+ *
+ * The following flags change the way bytes are read:
+ * \li VOLK_GNSSSDR_UNPACK_HIGH_NIBBLE_FIRST: the most significant nibble of each
+ * byte comes first.
+ * \li VOLK_GNSSSDR_UNPACK_SWAP_BYTES_32: the bytes of each 32-bit word are read
+ * in reverse order, as in big endian words. num_points must then cover whole
+ * words.
+ * \li VOLK_GNSSSDR_UNPACK_SWAP_IQ: with 4-bit samples, reverses the order of the
+ * nibbles. For the other sample sizes the swap is done by the lookup tables.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack_lut_8i(int8_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples, num_points * bits_per_sample / 8 bytes.
+ * \li lut: 128 / bits_per_sample values (32, 64 or 128).
+ * \li bits_per_sample: Bits per sample (1, 2 or 4).
+ * \li flags: Bitwise OR of the VOLK_GNSSSDR_UNPACK_* flags.
+ * \li num_points: Number of samples to be unpacked.
+ *
+ * \b Outputs
+ * \li result: The unpacked samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack_lut_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack_lut_8i_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <inttypes.h>
+
+// Flags read by the kernels
+#define VOLK_GNSSSDR_UNPACK_HIGH_NIBBLE_FIRST 0x01
+#define VOLK_GNSSSDR_UNPACK_SWAP_BYTES_32 0x02
+#define VOLK_GNSSSDR_UNPACK_SWAP_IQ 0x04
+// Flags read by volk_gnsssdr_8u_unpack_lut_init()
+#define VOLK_GNSSSDR_UNPACK_MSB_SAMPLE_FIRST 0x08  // the first sample of a nibble is in its most significant bits
+#define VOLK_GNSSSDR_UNPACK_ODD_LEVELS 0x10        // a code x means 2 * x + 1 instead of x (two's complement)
+#define VOLK_GNSSSDR_UNPACK_INVERT_Q 0x20          // negate the odd (Q) samples
+
+// Largest number of entries of the lookup tables (1-bit samples)
+#define VOLK_GNSSSDR_UNPACK_LUT_SIZE 128
+
+// Samples unpacked per block by the kernels writing wider types. A multiple
+// of 32 keeps the 32-bit words of the input aligned from block to block
+#define VOLK_GNSSSDR_UNPACK_BLOCK 1024
+
+
+/*!
+ * Fills the lookup table of the volk_gnsssdr_8u_unpack_lut kernels for
+ * samples of bits_per_sample bits in two's complement (or odd levels) coding,
+ * assuming that the I and Q samples alternate if either
+ * VOLK_GNSSSDR_UNPACK_SWAP_IQ or VOLK_GNSSSDR_UNPACK_INVERT_Q are set.
+ */
+static inline void volk_gnsssdr_8u_unpack_lut_init(int8_t* lut, unsigned int bits_per_sample, unsigned int flags)
+{
+    const unsigned int samples_per_nibble = 4 / bits_per_sample;
+    const unsigned int code_mask = (1U << bits_per_sample) - 1U;
+    const int sign_bit = 1 << (bits_per_sample - 1);
+    unsigned int m;
+    unsigned int nibble;
+    for (m = 0; m < 2 * samples_per_nibble; m++)
+        {
+            // With one sample per nibble, the kernel swaps the nibbles instead
+            const unsigned int source = ((flags & VOLK_GNSSSDR_UNPACK_SWAP_IQ) && samples_per_nibble > 1) ? (m ^ 1U) : m;
+            const unsigned int k = source % samples_per_nibble;
+            const unsigned int position = (flags & VOLK_GNSSSDR_UNPACK_MSB_SAMPLE_FIRST) ? samples_per_nibble - 1 - k : k;
+            for (nibble = 0; nibble < 16; nibble++)
+                {
+                    const int code = (int)((nibble >> (position * bits_per_sample)) & code_mask);
+                    int value = (code & sign_bit) ? code - 2 * sign_bit : code;
+                    if (flags & VOLK_GNSSSDR_UNPACK_ODD_LEVELS)
+                        {
+                            value = 2 * value + 1;
+                        }
+                    if ((flags & VOLK_GNSSSDR_UNPACK_INVERT_Q) && (m & 1U))
+                        {
+                            value = -value;
+                        }
+                    lut[16 * m + nibble] = (int8_t)value;
+                }
+        }
+}
+
+
+static inline int volk_gnsssdr_8u_unpack_lut_high_nibble_first(unsigned int bits_per_sample, unsigned int flags)
+{
+    const int high_nibble_first = (flags & VOLK_GNSSSDR_UNPACK_HIGH_NIBBLE_FIRST) != 0;
+    const int swap_nibbles = bits_per_sample == 4 && (flags & VOLK_GNSSSDR_UNPACK_SWAP_IQ) != 0;
+    return high_nibble_first != swap_nibbles;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack_lut_8i_generic(int8_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    const unsigned int samples_per_nibble = 4 / bits_per_sample;
+    const unsigned int samples_per_byte = 2 * samples_per_nibble;
+    const unsigned int whole_bytes = num_points / samples_per_byte;
+    const unsigned int byte_swap = (flags & VOLK_GNSSSDR_UNPACK_SWAP_BYTES_32) ? 3 : 0;
+    const unsigned int first_shift = volk_gnsssdr_8u_unpack_lut_high_nibble_first(bits_per_sample, flags) ? 4 : 0;
+    const int8_t* second_lut = lut + 16 * samples_per_nibble;
+    unsigned int first;
+    unsigned int second;
+    unsigned int i;
+    unsigned int m;
+    for (i = 0; i < whole_bytes; i++)
+        {
+            first = (packed[i ^ byte_swap] >> first_shift) & 0x0F;
+            second = (packed[i ^ byte_swap] >> (4 - first_shift)) & 0x0F;
+            for (m = 0; m < samples_per_nibble; m++)
+                {
+                    result[m] = lut[16 * m + first];
+                    result[samples_per_nibble + m] = second_lut[16 * m + second];
+                }
+            result += samples_per_byte;
+        }
+
+    // Last samples, if they do not fill a byte
+    if (num_points > whole_bytes * samples_per_byte)
+        {
+            first = (packed[whole_bytes ^ byte_swap] >> first_shift) & 0x0F;
+            second = (packed[whole_bytes ^ byte_swap] >> (4 - first_shift)) & 0x0F;
+            for (m = 0; m < num_points - whole_bytes * samples_per_byte; m++)
+                {
+                    result[m] = lut[16 * m + (m < samples_per_nibble ? first : second)];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_8i_u_ssse3(int8_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    const unsigned int samples_per_nibble = 4 / bits_per_sample;
+    const unsigned int samples_per_iter = 32 * samples_per_nibble;  // 16 bytes per iteration
+    const unsigned int sse_iters = num_points / samples_per_iter;
+    const int swap_bytes = (flags & VOLK_GNSSSDR_UNPACK_SWAP_BYTES_32) != 0;
+    const int high_nibble_first = volk_gnsssdr_8u_unpack_lut_high_nibble_first(bits_per_sample, flags);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i swap_mask = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+    __m128i tables[8];
+    __m128i values[8];
+    __m128i out[8];
+    __m128i x, low, high, first, second, t0, t1, t2, t3;
+    unsigned int number;
+    unsigned int m;
+
+    for (m = 0; m < 2 * samples_per_nibble; m++)
+        {
+            tables[m] = _mm_loadu_si128((const __m128i*)(lut + 16 * m));
+        }
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            x = _mm_loadu_si128((const __m128i*)in_ptr);
+            if (swap_bytes)
+                {
+                    x = _mm_shuffle_epi8(x, swap_mask);
+                }
+            low = _mm_and_si128(x, nibble_mask);
+            high = _mm_and_si128(_mm_srli_epi16(x, 4), nibble_mask);
+            first = high_nibble_first ? high : low;
+            second = high_nibble_first ? low : high;
+            for (m = 0; m < samples_per_nibble; m++)
+                {
+                    values[m] = _mm_shuffle_epi8(tables[m], first);
+                    values[samples_per_nibble + m] = _mm_shuffle_epi8(tables[samples_per_nibble + m], second);
+                }
+
+            // Interleave the samples so that those of each byte are contiguous
+            switch (samples_per_nibble)
+                {
+                case 1:
+                    out[0] = _mm_unpacklo_epi8(values[0], values[1]);
+                    out[1] = _mm_unpackhi_epi8(values[0], values[1]);
+                    break;
+                case 2:
+                    t0 = _mm_unpacklo_epi8(values[0], values[1]);
+                    t1 = _mm_unpackhi_epi8(values[0], values[1]);
+                    t2 = _mm_unpacklo_epi8(values[2], values[3]);
+                    t3 = _mm_unpackhi_epi8(values[2], values[3]);
+                    out[0] = _mm_unpacklo_epi16(t0, t2);
+                    out[1] = _mm_unpackhi_epi16(t0, t2);
+                    out[2] = _mm_unpacklo_epi16(t1, t3);
+                    out[3] = _mm_unpackhi_epi16(t1, t3);
+                    break;
+                default:
+                    for (m = 0; m < 2; m++)
+                        {
+                            // m = 0: samples of the first nibbles, m = 1: of the second ones
+                            t0 = _mm_unpacklo_epi8(values[4 * m], values[4 * m + 1]);
+                            t1 = _mm_unpackhi_epi8(values[4 * m], values[4 * m + 1]);
+                            t2 = _mm_unpacklo_epi8(values[4 * m + 2], values[4 * m + 3]);
+                            t3 = _mm_unpackhi_epi8(values[4 * m + 2], values[4 * m + 3]);
+                            values[4 * m] = _mm_unpacklo_epi16(t0, t2);
+                            values[4 * m + 1] = _mm_unpackhi_epi16(t0, t2);
+                            values[4 * m + 2] = _mm_unpacklo_epi16(t1, t3);
+                            values[4 * m + 3] = _mm_unpackhi_epi16(t1, t3);
+                        }
+                    for (m = 0; m < 4; m++)
+                        {
+                            out[2 * m] = _mm_unpacklo_epi32(values[m], values[4 + m]);
+                            out[2 * m + 1] = _mm_unpackhi_epi32(values[m], values[4 + m]);
+                        }
+                }
+
+            for (m = 0; m < 2 * samples_per_nibble; m++)
+                {
+                    _mm_storeu_si128((__m128i*)(out_ptr + 16 * m), out[m]);
+                }
+            in_ptr += 16;
+            out_ptr += samples_per_iter;
+        }
+
+    // 16-byte steps keep the 32-bit words aligned, so the generic code can go on
+    volk_gnsssdr_8u_unpack_lut_8i_generic(out_ptr, in_ptr, lut, bits_per_sample, flags, num_points - sse_iters * samples_per_iter);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_8i_u_avx2(int8_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    const unsigned int samples_per_nibble = 4 / bits_per_sample;
+    const unsigned int samples_per_iter = 64 * samples_per_nibble;  // 32 bytes per iteration
+    const unsigned int avx_iters = num_points / samples_per_iter;
+    const int swap_bytes = (flags & VOLK_GNSSSDR_UNPACK_SWAP_BYTES_32) != 0;
+    const int high_nibble_first = volk_gnsssdr_8u_unpack_lut_high_nibble_first(bits_per_sample, flags);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    const __m256i swap_mask = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+        12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+    __m256i tables[8];
+    __m256i values[8];
+    __m256i out[8];
+    __m256i x, low, high, first, second, t0, t1, t2, t3;
+    unsigned int number;
+    unsigned int m;
+
+    for (m = 0; m < 2 * samples_per_nibble; m++)
+        {
+            tables[m] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(lut + 16 * m)));
+        }
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            x = _mm256_loadu_si256((const __m256i*)in_ptr);
+            if (swap_bytes)
+                {
+                    x = _mm256_shuffle_epi8(x, swap_mask);
+                }
+            low = _mm256_and_si256(x, nibble_mask);
+            high = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask);
+            first = high_nibble_first ? high : low;
+            second = high_nibble_first ? low : high;
+            for (m = 0; m < samples_per_nibble; m++)
+                {
+                    values[m] = _mm256_shuffle_epi8(tables[m], first);
+                    values[samples_per_nibble + m] = _mm256_shuffle_epi8(tables[samples_per_nibble + m], second);
+                }
+
+            // Same interleaving as in the SSSE3 version, within each 128-bit lane
+            switch (samples_per_nibble)
+                {
+                case 1:
+                    out[0] = _mm256_unpacklo_epi8(values[0], values[1]);
+                    out[1] = _mm256_unpackhi_epi8(values[0], values[1]);
+                    break;
+                case 2:
+                    t0 = _mm256_unpacklo_epi8(values[0], values[1]);
+                    t1 = _mm256_unpackhi_epi8(values[0], values[1]);
+                    t2 = _mm256_unpacklo_epi8(values[2], values[3]);
+                    t3 = _mm256_unpackhi_epi8(values[2], values[3]);
+                    out[0] = _mm256_unpacklo_epi16(t0, t2);
+                    out[1] = _mm256_unpackhi_epi16(t0, t2);
+                    out[2] = _mm256_unpacklo_epi16(t1, t3);
+                    out[3] = _mm256_unpackhi_epi16(t1, t3);
+                    break;
+                default:
+                    for (m = 0; m < 2; m++)
+                        {
+                            t0 = _mm256_unpacklo_epi8(values[4 * m], values[4 * m + 1]);
+                            t1 = _mm256_unpackhi_epi8(values[4 * m], values[4 * m + 1]);
+                            t2 = _mm256_unpacklo_epi8(values[4 * m + 2], values[4 * m + 3]);
+                            t3 = _mm256_unpackhi_epi8(values[4 * m + 2], values[4 * m + 3]);
+                            values[4 * m] = _mm256_unpacklo_epi16(t0, t2);
+                            values[4 * m + 1] = _mm256_unpackhi_epi16(t0, t2);
+                            values[4 * m + 2] = _mm256_unpacklo_epi16(t1, t3);
+                            values[4 * m + 3] = _mm256_unpackhi_epi16(t1, t3);
+                        }
+                    for (m = 0; m < 4; m++)
+                        {
+                            out[2 * m] = _mm256_unpacklo_epi32(values[m], values[4 + m]);
+                            out[2 * m + 1] = _mm256_unpackhi_epi32(values[m], values[4 + m]);
+                        }
+                }
+
+            // The low lanes hold the samples of the first 16 bytes
+            for (m = 0; m < samples_per_nibble; m++)
+                {
+                    _mm256_storeu_si256((__m256i*)(out_ptr + 32 * m), _mm256_permute2x128_si256(out[2 * m], out[2 * m + 1], 0x20));
+                    _mm256_storeu_si256((__m256i*)(out_ptr + 32 * (samples_per_nibble + m)), _mm256_permute2x128_si256(out[2 * m], out[2 * m + 1], 0x31));
+                }
+            in_ptr += 32;
+            out_ptr += samples_per_iter;
+        }
+
+    volk_gnsssdr_8u_unpack_lut_8i_generic(out_ptr, in_ptr, lut, bits_per_sample, flags, num_points - avx_iters * samples_per_iter);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack_lut_8i_neon(int8_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points)
+{
+    const unsigned int samples_per_nibble = 4 / bits_per_sample;
+    const unsigned int samples_per_iter = 16 * samples_per_nibble;  // 8 bytes per iteration
+    const unsigned int neon_iters = num_points / samples_per_iter;
+    const int swap_bytes = (flags & VOLK_GNSSSDR_UNPACK_SWAP_BYTES_32) != 0;
+    const int high_nibble_first = volk_gnsssdr_8u_unpack_lut_high_nibble_first(bits_per_sample, flags);
+    const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+    uint8x8x2_t tables[8];
+    uint8x8_t values[8];
+    uint8x8_t x, low, high, first, second;
+    uint8x8x2_t pair;
+    uint8x8x4_t quad;
+    uint16x8x4_t wide_quad;
+    unsigned int number;
+    unsigned int m;
+
+    for (m = 0; m < 2 * samples_per_nibble; m++)
+        {
+            tables[m].val[0] = vld1_u8((const uint8_t*)(lut + 16 * m));
+            tables[m].val[1] = vld1_u8((const uint8_t*)(lut + 16 * m + 8));
+        }
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            x = vld1_u8(in_ptr);
+            __VOLK_GNSSSDR_PREFETCH(in_ptr + 64);
+            if (swap_bytes)
+                {
+                    x = vrev32_u8(x);
+                }
+            low = vand_u8(x, nibble_mask);
+            high = vshr_n_u8(x, 4);
+            first = high_nibble_first ? high : low;
+            second = high_nibble_first ? low : high;
+            for (m = 0; m < samples_per_nibble; m++)
+                {
+                    values[m] = vtbl2_u8(tables[m], first);
+                    values[samples_per_nibble + m] = vtbl2_u8(tables[samples_per_nibble + m], second);
+                }
+
+            // Interleaving stores put the samples of each byte together
+            switch (samples_per_nibble)
+                {
+                case 1:
+                    pair.val[0] = values[0];
+                    pair.val[1] = values[1];
+                    vst2_u8((uint8_t*)out_ptr, pair);
+                    break;
+                case 2:
+                    quad.val[0] = values[0];
+                    quad.val[1] = values[1];
+                    quad.val[2] = values[2];
+                    quad.val[3] = values[3];
+                    vst4_u8((uint8_t*)out_ptr, quad);
+                    break;
+                default:
+                    for (m = 0; m < 4; m++)
+                        {
+                            pair = vzip_u8(values[2 * m], values[2 * m + 1]);
+                            wide_quad.val[m] = vreinterpretq_u16_u8(vcombine_u8(pair.val[0], pair.val[1]));
+                        }
+                    vst4q_u16((uint16_t*)out_ptr, wide_quad);
+                }
+            in_ptr += 8;
+            out_ptr += samples_per_iter;
+        }
+
+    volk_gnsssdr_8u_unpack_lut_8i_generic(out_ptr, in_ptr, lut, bits_per_sample, flags, num_points - neon_iters * samples_per_iter);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack_lut_8i_H */
@@ -0,0 +1,84 @@
+/*!
+ * \file volk_gnsssdr_8u_unpackpuppet_8i.h
+ * \brief VOLK_GNSSSDR puppet for the volk_gnsssdr_8u_unpack_lut_8i kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the lookup table unpacking kernel into
+ * the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpackpuppet_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpackpuppet_8i_H
+
+#include "volk_gnsssdr/volk_gnsssdr_8u_unpack_lut_8i.h"
+
+
+typedef void (*volk_gnsssdr_8u_unpack_lut_8i_fn)(int8_t* result, const uint8_t* packed, const int8_t* lut, unsigned int bits_per_sample, unsigned int flags, unsigned int num_points);
+
+// Unpacks 2, 4 and 1-bit samples, each one with different flags, in a third of the output
+static inline void volk_gnsssdr_8u_unpackpuppet_8i_run(volk_gnsssdr_8u_unpack_lut_8i_fn kernel, int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int bits[3] = {2, 4, 1};
+    const unsigned int flags[3] = {
+        VOLK_GNSSSDR_UNPACK_HIGH_NIBBLE_FIRST | VOLK_GNSSSDR_UNPACK_ODD_LEVELS | VOLK_GNSSSDR_UNPACK_SWAP_IQ,
+        VOLK_GNSSSDR_UNPACK_SWAP_BYTES_32 | VOLK_GNSSSDR_UNPACK_SWAP_IQ | VOLK_GNSSSDR_UNPACK_INVERT_Q,
+        VOLK_GNSSSDR_UNPACK_MSB_SAMPLE_FIRST | VOLK_GNSSSDR_UNPACK_ODD_LEVELS | VOLK_GNSSSDR_UNPACK_INVERT_Q};
+    const unsigned int part = (num_points / 3) & ~31U;  // whole 32-bit words for any sample size
+    int8_t lut[VOLK_GNSSSDR_UNPACK_LUT_SIZE];
+    unsigned int k;
+    for (k = 0; k < 3; k++)
+        {
+            const unsigned int points = k < 2 ? part : num_points - 2 * part;
+            volk_gnsssdr_8u_unpack_lut_init(lut, bits[k], flags[k]);
+            kernel(result, packed, lut, bits[k], flags[k], points);
+            result += points;
+            packed += points / 8 * bits[k];
+        }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_8u_unpackpuppet_8i_generic(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_8u_unpackpuppet_8i_run(volk_gnsssdr_8u_unpack_lut_8i_generic, result, packed, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+static inline void volk_gnsssdr_8u_unpackpuppet_8i_u_ssse3(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_8u_unpackpuppet_8i_run(volk_gnsssdr_8u_unpack_lut_8i_u_ssse3, result, packed, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_8u_unpackpuppet_8i_u_avx2(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_8u_unpackpuppet_8i_run(volk_gnsssdr_8u_unpack_lut_8i_u_avx2, result, packed, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_8u_unpackpuppet_8i_neon(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_8u_unpackpuppet_8i_run(volk_gnsssdr_8u_unpack_lut_8i_neon, result, packed, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpackpuppet_8i_H */
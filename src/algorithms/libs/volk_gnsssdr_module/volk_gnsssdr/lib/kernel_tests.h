@@ -85,8 +85,13 @@ std::vector<volk_gnsssdr_test_case_t> init_test_list(volk_gnsssdr_test_params_t
     QA(VOLK_INIT_PUPP(volk_gnsssdr_16ic_x2_rotator_dotprodxnpuppet_16ic, volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn, test_params_int16))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_16ic_16i_rotator_dotprodxnpuppet_16ic, volk_gnsssdr_16ic_16i_rotator_dot_prod_16ic_xn, test_params_int16))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_x2_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_rotator_resampler_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_rotator_resampler_dot_prod_32fc_xn, test_params_inacc))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, test_params_inacc));
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_high_dynamic_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32f_conv_k7_r2puppet_32u, volk_gnsssdr_32f_conv_k7_r2_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpackpuppet_8i, volk_gnsssdr_8u_unpack_lut_8i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpackpuppet_16i, volk_gnsssdr_8u_unpack_lut_16i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpackpuppet_32f, volk_gnsssdr_8u_unpack_lut_32f, test_params))
 
     return test_cases;
 }
@@ -49,6 +49,13 @@ HybridObservables::HybridObservables(const ConfigurationInterface* configuration
     conf.enable_carrier_smoothing = configuration->property(role + ".enable_carrier_smoothing", conf.enable_carrier_smoothing);
     conf.always_output_gs = configuration->property("PVT.an_output_enabled", conf.always_output_gs) || configuration->property(role + ".always_output_gs", conf.always_output_gs);
     conf.enable_E6 = configuration->property("PVT.use_e6_for_pvt", conf.enable_E6);
+    conf.interpolation_order = configuration->property(role + ".interpolation_order", conf.interpolation_order);
+    if (conf.interpolation_order < 1 or conf.interpolation_order > MAX_INTERPOLATION_ORDER)
+        {
+            LOG(WARNING) << "Invalid value of " << role << ".interpolation_order (" << conf.interpolation_order
+                         << "), it must be between 1 and " << MAX_INTERPOLATION_ORDER << ". Using linear interpolation.";
+            conf.interpolation_order = 1U;
+        }
 
 #if USE_GLOG_AND_GFLAGS
     if (FLAGS_carrier_smoothing_factor == DEFAULT_CARRIER_SMOOTHING_FACTOR)
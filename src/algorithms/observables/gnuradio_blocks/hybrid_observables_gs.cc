@@ -23,6 +23,7 @@
 #include "gnss_sdr_filesystem.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro.h"
+#include "gnss_synchro_epoch.h"
 #include <gnuradio/io_signature.h>
 #include <matio.h>
 #include <pmt/pmt.h>
@@ -32,7 +33,6 @@
 #include <cstdlib>    // for size_t, llabs
 #include <exception>  // for exception
 #include <iostream>   // for cerr, cout
-#include <limits>     // for numeric_limits
 #include <utility>    // for move
 
 #if USE_GLOG_AND_GFLAGS
@@ -64,7 +64,7 @@ hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf &conf_)
 hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
     : gr::block("hybrid_observables_gs",
           gr::io_signature::make(conf_.nchannels_in, conf_.nchannels_in, sizeof(Gnss_Synchro)),
-          gr::io_signature::make(conf_.nchannels_out, conf_.nchannels_out, sizeof(Gnss_Synchro))),
+          gr::io_signature::make(1, 1, sizeof(Gnss_Synchro_Epoch))),
       d_conf(conf_),
       d_dump_filename(conf_.dump_filename),
       d_smooth_filter_M(static_cast<double>(conf_.smoothing_factor)),
@@ -80,6 +80,13 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
       d_dump(conf_.dump),
       d_dump_mat(conf_.dump_mat && d_dump)
 {
+    if (d_nchannels_out > Gnss_Synchro_Epoch::MAX_CHANNELS)
+        {
+            // the flowgraph refuses to connect such a receiver, just keep the output record in bounds
+            LOG(ERROR) << "The Observables block supports up to " << Gnss_Synchro_Epoch::MAX_CHANNELS << " channels";
+            d_nchannels_out = Gnss_Synchro_Epoch::MAX_CHANNELS;
+        }
+
     // PVT input message port
     this->message_port_register_in(pmt::mp("pvt_to_observables"));
     this->set_msg_handler(pmt::mp("pvt_to_observables"),
@@ -104,6 +111,7 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_)
     d_channel_last_pll_lock = std::vector<bool>(d_nchannels_out, false);
     d_channel_last_pseudorange_smooth = std::vector<double>(d_nchannels_out, 0.0);
     d_channel_last_carrier_phase_rads = std::vector<double>(d_nchannels_out, 0.0);
+    d_epoch_data = std::vector<Gnss_Synchro>(d_nchannels_out);
 
     d_SourceTagTimestamps = std::vector<std::queue<GnssTime>>(d_nchannels_out);
 
@@ -390,99 +398,164 @@ double hybrid_observables_gs::compute_T_rx_s(const Gnss_Synchro &a) const
 
 bool hybrid_observables_gs::interp_trk_obs(Gnss_Synchro &interpolated_obs, uint32_t ch, uint64_t rx_clock) const
 {
-    int32_t nearest_element = -1;
-    int64_t old_abs_diff = std::numeric_limits<int64_t>::max();
-    for (uint32_t i = 0; i < d_gnss_synchro_history->size(ch); i++)
+    const auto history_size = static_cast<int32_t>(d_gnss_synchro_history->size(ch));
+    if (history_size == 0)
+        {
+            return false;
+        }
+
+    // The history of each channel is sorted by sample counter, so the nearest
+    // element is one of the two around the first element not older than rx_clock
+    int32_t nearest_element = static_cast<int32_t>(d_gnss_synchro_history->lower_bound(ch, rx_clock,
+        [](const Gnss_Synchro &a, uint64_t clock) { return a.Tracking_sample_counter < clock; }));
+    if (nearest_element == history_size)
+        {
+            nearest_element = history_size - 1;
+        }
+    else if (nearest_element > 0)
         {
-            const int64_t abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(d_gnss_synchro_history->get(ch, i).Tracking_sample_counter));
-            if (old_abs_diff > abs_diff)
+            if (rx_clock - d_gnss_synchro_history->get(ch, nearest_element - 1).Tracking_sample_counter <=
+                d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter - rx_clock)
                 {
-                    old_abs_diff = abs_diff;
-                    nearest_element = static_cast<int32_t>(i);
+                    nearest_element--;
                 }
         }
+    const int64_t old_abs_diff = llabs(static_cast<int64_t>(rx_clock) - static_cast<int64_t>(d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter));
 
-    if (nearest_element != -1 and nearest_element != static_cast<int32_t>(d_gnss_synchro_history->size(ch)))
+    if ((static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs)) < d_T_rx_step_s)
         {
-            if ((static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs)) < d_T_rx_step_s)
+            int32_t neighbor_element;
+            if (rx_clock > d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter)
                 {
-                    int32_t neighbor_element;
+                    neighbor_element = nearest_element + 1;
+                }
+            else
+                {
+                    neighbor_element = nearest_element - 1;
+                }
+            if (neighbor_element < static_cast<int32_t>(d_gnss_synchro_history->size(ch)) and neighbor_element >= 0)
+                {
+                    int32_t t1_idx;
+                    int32_t t2_idx;
                     if (rx_clock > d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter)
                         {
-                            neighbor_element = nearest_element + 1;
+                            // std::cout << "S1= " << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter
+                            //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter << '\n';
+                            t1_idx = nearest_element;
+                            t2_idx = neighbor_element;
                         }
                     else
                         {
-                            neighbor_element = nearest_element - 1;
+                            // std::cout << "inv S1= " << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter
+                            //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter << '\n';
+                            t1_idx = neighbor_element;
+                            t2_idx = nearest_element;
                         }
-                    if (neighbor_element < static_cast<int32_t>(d_gnss_synchro_history->size(ch)) and neighbor_element >= 0)
+
+                    // 1st: copy the nearest gnss_synchro data for that channel
+                    interpolated_obs = d_gnss_synchro_history->get(ch, nearest_element);
+                    if (interpolated_obs.fs == 0LL)
                         {
-                            int32_t t1_idx;
-                            int32_t t2_idx;
-                            if (rx_clock > d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter)
-                                {
-                                    // std::cout << "S1= " << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter
-                                    //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter << '\n';
-                                    t1_idx = nearest_element;
-                                    t2_idx = neighbor_element;
-                                }
-                            else
-                                {
-                                    // std::cout << "inv S1= " << d_gnss_synchro_history->get(ch, neighbor_element).Tracking_sample_counter
-                                    //           << " Si=" << rx_clock << " S2=" << d_gnss_synchro_history->get(ch, nearest_element).Tracking_sample_counter << '\n';
-                                    t1_idx = neighbor_element;
-                                    t2_idx = nearest_element;
-                                }
+                            return false;
+                        }
 
-                            // 1st: copy the nearest gnss_synchro data for that channel
-                            interpolated_obs = d_gnss_synchro_history->get(ch, nearest_element);
-                            if (interpolated_obs.fs == 0LL)
-                                {
-                                    return false;
-                                }
+                    const double T_rx_s = static_cast<double>(rx_clock) / static_cast<double>(interpolated_obs.fs);
+                    if (d_conf.interpolation_order > 1 and history_size > static_cast<int32_t>(d_conf.interpolation_order))
+                        {
+                            interp_trk_obs_lagrange(interpolated_obs, ch, t1_idx, T_rx_s);
+                            return true;
+                        }
 
-                            // 2nd: Linear interpolation: y(t) = y(t1) + (y(t2) - y(t1)) * (t - t1) / (t2 - t1)
-                            const double T_rx_s = static_cast<double>(rx_clock) / static_cast<double>(interpolated_obs.fs);
+                    // 2nd: Linear interpolation: y(t) = y(t1) + (y(t2) - y(t1)) * (t - t1) / (t2 - t1)
 
-                            const double time_factor = (T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time) /
-                                                       (d_gnss_synchro_history->get(ch, t2_idx).RX_time -
-                                                           d_gnss_synchro_history->get(ch, t1_idx).RX_time);
+                    const double time_factor = (T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time) /
+                                               (d_gnss_synchro_history->get(ch, t2_idx).RX_time -
+                                                   d_gnss_synchro_history->get(ch, t1_idx).RX_time);
 
-                            // CARRIER PHASE INTERPOLATION
-                            interpolated_obs.Carrier_phase_rads = d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_phase_rads - d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads) * time_factor;
-                            // CARRIER DOPPLER INTERPOLATION
-                            interpolated_obs.Carrier_Doppler_hz = d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_Doppler_hz - d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz) * time_factor;
-                            // TOW INTERPOLATION
-                            // check TOW rollover
-                            if ((d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms - d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) > 0)
-                                {
-                                    interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
-                                }
-                            else
-                                {
-                                    // TOW rollover situation
-                                    interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms + 604800000) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
-                                }
+                    // CARRIER PHASE INTERPOLATION
+                    interpolated_obs.Carrier_phase_rads = d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_phase_rads - d_gnss_synchro_history->get(ch, t1_idx).Carrier_phase_rads) * time_factor;
+                    // CARRIER DOPPLER INTERPOLATION
+                    interpolated_obs.Carrier_Doppler_hz = d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz + (d_gnss_synchro_history->get(ch, t2_idx).Carrier_Doppler_hz - d_gnss_synchro_history->get(ch, t1_idx).Carrier_Doppler_hz) * time_factor;
+                    // TOW INTERPOLATION
+                    // check TOW rollover
+                    if ((d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms - d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) > 0)
+                        {
+                            interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
+                        }
+                    else
+                        {
+                            // TOW rollover situation
+                            interpolated_obs.interp_TOW_ms = static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms) + (static_cast<double>(d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms + 604800000) - static_cast<double>(d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms)) * time_factor;
+                        }
 
-                            // LOG(INFO) << "Channel " << ch << " int idx: " << t1_idx << " TOW Int: " << interpolated_obs.interp_TOW_ms
-                            //           << " TOW p1 : " << d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms
-                            //           << " TOW p2: "
-                            //           << d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms
-                            //           << " t2-t1: "
-                            //           << d_gnss_synchro_history->get(ch, t2_idx).RX_time - d_gnss_synchro_history->get(ch, t1_idx).RX_time
-                            //           << " trx - t1: "
-                            //           << T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time;
-                            // std::cout << "Rx samplestamp: " << T_rx_s << " Channel " << ch << " interp buff idx " << nearest_element
-                            //           << " ,diff: " << old_abs_diff << " samples (" << static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs) << " s)\n";
-                            return true;
+                    // LOG(INFO) << "Channel " << ch << " int idx: " << t1_idx << " TOW Int: " << interpolated_obs.interp_TOW_ms
+                    //           << " TOW p1 : " << d_gnss_synchro_history->get(ch, t1_idx).TOW_at_current_symbol_ms
+                    //           << " TOW p2: "
+                    //           << d_gnss_synchro_history->get(ch, t2_idx).TOW_at_current_symbol_ms
+                    //           << " t2-t1: "
+                    //           << d_gnss_synchro_history->get(ch, t2_idx).RX_time - d_gnss_synchro_history->get(ch, t1_idx).RX_time
+                    //           << " trx - t1: "
+                    //           << T_rx_s - d_gnss_synchro_history->get(ch, t1_idx).RX_time;
+                    // std::cout << "Rx samplestamp: " << T_rx_s << " Channel " << ch << " interp buff idx " << nearest_element
+                    //           << " ,diff: " << old_abs_diff << " samples (" << static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs) << " s)\n";
+                    return true;
+                }
+            return false;
+        }
+    // std::cout << "ALERT: Channel " << ch << " interp buff idx " << nearest_element
+    //           << " ,diff: " << old_abs_diff << " samples (" << static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs) << " s)\n";
+    // usleep(1000);
+    return false;
+}
+
+
+void hybrid_observables_gs::interp_trk_obs_lagrange(Gnss_Synchro &interpolated_obs, uint32_t ch, int32_t t1_idx, double T_rx_s) const
+{
+    // Lagrange polynomial through interpolation_order + 1 consecutive samples
+    // centered on the [t1, t2] interval. Values are taken relative to t1 to
+    // preserve the precision of the accumulated carrier phase.
+    const auto n_points = static_cast<int32_t>(d_conf.interpolation_order) + 1;
+    const int32_t first = std::max(0, std::min(t1_idx - (n_points - 2) / 2, static_cast<int32_t>(d_gnss_synchro_history->size(ch)) - n_points));
+    const Gnss_Synchro &ref = d_gnss_synchro_history->get(ch, t1_idx);
+    const double t = T_rx_s - ref.RX_time;
+
+    std::array<double, MAX_INTERPOLATION_ORDER + 1> x{};
+    for (int32_t i = 0; i < n_points; i++)
+        {
+            x[i] = d_gnss_synchro_history->get(ch, first + i).RX_time - ref.RX_time;
+        }
+
+    double carrier_phase_rads = 0.0;
+    double carrier_doppler_hz = 0.0;
+    double tow_ms = 0.0;
+    for (int32_t i = 0; i < n_points; i++)
+        {
+            double weight = 1.0;
+            for (int32_t j = 0; j < n_points; j++)
+                {
+                    if (j != i)
+                        {
+                            weight *= (t - x[j]) / (x[i] - x[j]);
                         }
-                    return false;
                 }
-            // std::cout << "ALERT: Channel " << ch << " interp buff idx " << nearest_element
-            //           << " ,diff: " << old_abs_diff << " samples (" << static_cast<double>(old_abs_diff) / static_cast<double>(d_gnss_synchro_history->get(ch, nearest_element).fs) << " s)\n";
-            // usleep(1000);
+            const Gnss_Synchro &sample = d_gnss_synchro_history->get(ch, first + i);
+            carrier_phase_rads += weight * (sample.Carrier_phase_rads - ref.Carrier_phase_rads);
+            carrier_doppler_hz += weight * (sample.Carrier_Doppler_hz - ref.Carrier_Doppler_hz);
+            // check TOW rollover
+            int64_t tow_diff_ms = static_cast<int64_t>(sample.TOW_at_current_symbol_ms) - static_cast<int64_t>(ref.TOW_at_current_symbol_ms);
+            if (tow_diff_ms < -302400000)
+                {
+                    tow_diff_ms += 604800000;
+                }
+            else if (tow_diff_ms > 302400000)
+                {
+                    tow_diff_ms -= 604800000;
+                }
+            tow_ms += weight * static_cast<double>(tow_diff_ms);
         }
-    return false;
+    interpolated_obs.Carrier_phase_rads = ref.Carrier_phase_rads + carrier_phase_rads;
+    interpolated_obs.Carrier_Doppler_hz = ref.Carrier_Doppler_hz + carrier_doppler_hz;
+    interpolated_obs.interp_TOW_ms = static_cast<double>(ref.TOW_at_current_symbol_ms) + tow_ms;
 }
 
 
@@ -660,7 +733,7 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
     gr_vector_void_star &output_items)
 {
     const auto **in = reinterpret_cast<const Gnss_Synchro **>(&input_items[0]);
-    auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
+    auto *out = reinterpret_cast<Gnss_Synchro_Epoch *>(output_items[0]);
 
     // Push receiver clock into history buffer (connected to the last of the input channels)
     // The clock buffer gives time to the channels to compute the tracking observables
@@ -754,7 +827,7 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
 
     if (d_Rx_clock_buffer.size() == d_Rx_clock_buffer.capacity())
         {
-            std::vector<Gnss_Synchro> epoch_data(d_nchannels_out);
+            std::vector<Gnss_Synchro> &epoch_data = d_epoch_data;
             int32_t n_valid = 0;
             for (uint32_t n = 0; n < d_nchannels_out; n++)
                 {
@@ -799,10 +872,15 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                     smooth_pseudoranges(epoch_data);
                 }
 
-            // output the observables set to the PVT block
+            // output the observables set to the PVT block. Only the channels
+            // with an interpolated observation are written to the record
+            out->reset(d_nchannels_out);
             for (uint32_t n = 0; n < d_nchannels_out; n++)
                 {
-                    out[n][0] = epoch_data[n];
+                    if (epoch_data[n].Flag_valid_word)
+                        {
+                            out->set(n, epoch_data[n]);
+                        }
                 }
             // report channel status every second
             d_T_status_report_timer_ms += d_T_rx_step_ms;
@@ -825,19 +903,19 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
                             double tmp_double;
                             for (uint32_t i = 0; i < d_nchannels_out; i++)
                                 {
-                                    tmp_double = out[i][0].RX_time;
+                                    tmp_double = epoch_data[i].RX_time;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].interp_TOW_ms / 1000.0;
+                                    tmp_double = epoch_data[i].interp_TOW_ms / 1000.0;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_Doppler_hz;
+                                    tmp_double = epoch_data[i].Carrier_Doppler_hz;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_phase_rads / TWO_PI;
+                                    tmp_double = epoch_data[i].Carrier_phase_rads / TWO_PI;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Pseudorange_m;
+                                    tmp_double = epoch_data[i].Pseudorange_m;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].PRN);
+                                    tmp_double = static_cast<double>(epoch_data[i].PRN);
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].Flag_valid_pseudorange);
+                                    tmp_double = static_cast<double>(epoch_data[i].Flag_valid_pseudorange);
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
                                 }
                         }
@@ -850,18 +928,14 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
 
             if (n_valid > 0)
                 {
-                    // LOG(INFO) << "OBS: diff time: " << out[0][0].RX_time * 1000.0 - old_time_debug;
-                    // old_time_debug = out[0][0].RX_time * 1000.0;
+                    // LOG(INFO) << "OBS: diff time: " << epoch_data[0].RX_time * 1000.0 - old_time_debug;
+                    // old_time_debug = epoch_data[0].RX_time * 1000.0;
                     return 1;
                 }
         }
     if (d_always_output_gs)
         {
-            Gnss_Synchro empty_gs{};
-            for (uint32_t n = 0; n < d_nchannels_out; n++)
-                {
-                    out[n][0] = empty_gs;
-                }
+            out->reset(d_nchannels_out);
             return 1;
         }
     return 0;
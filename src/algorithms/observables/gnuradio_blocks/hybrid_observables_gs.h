@@ -53,7 +53,9 @@ using hybrid_observables_gs_sptr = gnss_shared_ptr<hybrid_observables_gs>;
 hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf& conf_);
 
 /*!
- * \brief This class implements a block that computes observables
+ * \brief This class implements a block that computes observables. The
+ * observables of all the channels at each epoch are delivered as a single
+ * Gnss_Synchro_Epoch record.
  */
 class hybrid_observables_gs : public gr::block
 {
@@ -74,6 +76,7 @@ private:
     void msg_handler_pvt_to_observables(const pmt::pmt_t& msg);
     double compute_T_rx_s(const Gnss_Synchro& a) const;
     bool interp_trk_obs(Gnss_Synchro& interpolated_obs, uint32_t ch, uint64_t rx_clock) const;
+    void interp_trk_obs_lagrange(Gnss_Synchro& interpolated_obs, uint32_t ch, int32_t t1_idx, double T_rx_s) const;
     void update_TOW(const std::vector<Gnss_Synchro>& data);
     void compute_pranges(std::vector<Gnss_Synchro>& data) const;
     void smooth_pseudoranges(std::vector<Gnss_Synchro>& data);
@@ -93,6 +96,7 @@ private:
     std::vector<bool> d_channel_last_pll_lock;
     std::vector<double> d_channel_last_pseudorange_smooth;
     std::vector<double> d_channel_last_carrier_phase_rads;
+    std::vector<Gnss_Synchro> d_epoch_data;  // output observables, reused at every epoch
 
     std::string d_dump_filename;
 
@@ -21,6 +21,8 @@
 #include <cstdint>
 #include <string>
 
+constexpr uint32_t MAX_INTERPOLATION_ORDER = 7U;  // maximum order of the interpolation of tracking observables
+
 /** \addtogroup Observables
  * \{ */
 /** \addtogroup Observables_libs observables_libs
@@ -37,6 +39,7 @@ public:
     uint32_t nchannels_in{0U};
     uint32_t nchannels_out{0U};
     uint32_t observable_interval_ms{20U};
+    uint32_t interpolation_order{1U};  // 1: linear, up to MAX_INTERPOLATION_ORDER: Lagrange
     bool enable_carrier_smoothing{false};
     bool always_output_gs{false};
     bool dump{false};
@@ -53,14 +53,17 @@ FileSourceBase::FileSourceBase(ConfigurationInterface const* configuration, std:
       item_type_(configuration->property(role_ + ".item_type"s, std::move(default_item_type))),
       item_size_(0),
       header_size_(configuration->property(role_ + ".header_size"s, uint64_t(0))),
+      mmap_readahead_bytes_(configuration->property(role_ + ".mmap_readahead_mb"s, uint64_t(16)) * 1024 * 1024),
       samples_(configuration->property(role_ + ".samples"s, uint64_t(0))),
       sampling_frequency_(configuration->property(role_ + ".sampling_frequency"s, int64_t(0))),
       minimum_tail_s_(0.1),
       seconds_to_skip_(configuration->property(role_ + ".seconds_to_skip"s, 0.0)),
+      seconds_to_process_(configuration->property(role_ + ".seconds_to_process"s, 0.0)),
       is_complex_(false),
       repeat_(configuration->property(role_ + ".repeat"s, false)),
       enable_throttle_control_(configuration->property(role_ + ".enable_throttle_control"s, false)),
-      dump_(configuration->property(role_ + ".dump"s, false))
+      dump_(configuration->property(role_ + ".dump"s, false)),
+      use_mmap_(configuration->property(role_ + ".use_mmap"s, false))
 {
     minimum_tail_s_ = std::max(configuration->property("Acquisition_1C.coherent_integration_time_ms", 0.0) * 0.001 * 2.0, minimum_tail_s_);
     minimum_tail_s_ = std::max(configuration->property("Acquisition_2S.coherent_integration_time_ms", 0.0) * 0.001 * 2.0, minimum_tail_s_);
@@ -319,6 +322,32 @@ uint64_t FileSourceBase::samples() const
 }
 
 
+double FileSourceBase::signal_duration_s()
+{
+    if (sampling_frequency_ <= 0)
+        {
+            return 0.0;
+        }
+    auto item_tuple = itemTypeToSize();
+    item_size_ = std::get<0>(item_tuple);
+    is_complex_ = std::get<1>(item_tuple);
+
+    // this could throw if the file does not exist
+    const auto items_in_file = fs::file_size(filename()) / item_size();
+    if (items_in_file <= header_size_)
+        {
+            return 0.0;
+        }
+    // same accounting as in init()
+    auto signal_duration_s = packetsPerSample() * (items_in_file - header_size_) / sampling_frequency_;
+    if (is_complex())
+        {
+            signal_duration_s /= 2.0;
+        }
+    return signal_duration_s;
+}
+
+
 std::tuple<size_t, bool> FileSourceBase::itemTypeToSize()
 {
     auto is_interleaved = false;
@@ -412,6 +441,12 @@ size_t FileSourceBase::computeSamplesInFile() const
      */
     const auto tail = static_cast<size_t>(std::ceil(minimum_tail_s_ * sampling_frequency()));
 
+    if (n_samples == 0 && seconds_to_process_ > 0.0)
+        {
+            // inverse of the signal duration computed in init()
+            n_samples = static_cast<uint64_t>(std::ceil(seconds_to_process_ * sampling_frequency() * (is_complex() ? 2.0 : 1.0)));
+        }
+
     if (tail > size)
         {
             std::cout << "Warning: file " << filename() << " has " << size << " samples (it is too short).\n";
@@ -480,7 +515,7 @@ gnss_shared_ptr<gr::block> FileSourceBase::throttle() const { return throttle_;
 gnss_shared_ptr<gr::block> FileSourceBase::sink() const { return sink_; }
 
 
-gr::blocks::file_source::sptr FileSourceBase::create_file_source()
+gnss_shared_ptr<gr::block> FileSourceBase::create_file_source()
 {
     auto item_tuple = itemTypeToSize();
     item_size_ = std::get<0>(item_tuple);
@@ -488,18 +523,26 @@ gr::blocks::file_source::sptr FileSourceBase::create_file_source()
 
     try
         {
-            // TODO: why are we manually seeking, instead of passing the samples_to_skip to the file_source factory?
             auto samples_to_skip = samplesToSkip();
 
-            file_source_ = gr::blocks::file_source::make(item_size(), filename().data(), repeat());
-
-            if (samples_to_skip > 0)
+            if (use_mmap_)
+                {
+                    // skipping is just an offset into the mapping
+                    mmap_file_source_ = mmap_file_source_make(item_size(), filename(), repeat(), samples_to_skip, mmap_readahead_bytes_);
+                    file_source_ = mmap_file_source_;
+                }
+            else
                 {
-                    LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
-                    if (!file_source_->seek(samples_to_skip, SEEK_SET))
+                    auto file_source = gr::blocks::file_source::make(item_size(), filename().data(), repeat());
+                    if (samples_to_skip > 0)
                         {
-                            LOG(ERROR) << "Error skipping bytes!";
+                            LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
+                            if (!file_source->seek(samples_to_skip, SEEK_SET))
+                                {
+                                    LOG(ERROR) << "Error skipping bytes!";
+                                }
                         }
+                    file_source_ = file_source;
                 }
         }
     catch (const std::exception& e)
@@ -549,6 +592,12 @@ gnss_shared_ptr<gr::block> FileSourceBase::create_valve()
 {
     if (samples() > 0)
         {
+            if (mmap_file_source_ && source() == file_source())
+                {
+                    // the memory-mapped source can stop by itself, saving the copy through the valve
+                    mmap_file_source_->stop_after(samples(), queue_);
+                    return valve_;
+                }
             // if a number of samples is specified, honor it by creating a valve
             // in practice, this is always true
             valve_ = gnss_sdr_make_valve(source_item_size(), samples(), queue_);
@@ -19,6 +19,7 @@
 #define GNSS_SDR_FILE_SOURCE_BASE_H
 
 #include "concurrent_queue.h"
+#include "mmap_file_source.h"
 #include "signal_source_base.h"
 #include <gnuradio/blocks/file_sink.h>  // for dump
 #include <gnuradio/blocks/file_source.h>
@@ -54,10 +55,16 @@ class ConfigurationInterface;
 //!
 //!   .seconds_to_skip - number of seconds of lead-in data to skip over (default 0)
 //!
+//!   .seconds_to_process - if .samples is 0, number of seconds of data to process (default 0, the whole file)
+//!
 //!   .enable_throttle_control - whether to stop reading if the upstream buffer is full (default false)
 //!
 //!   .repeat   - whether to rewind and continue at end of file (default false)
 //!
+//!   .use_mmap - whether to read the file through a memory mapping instead of read() calls (default false)
+//!
+//!   .mmap_readahead_mb - if use_mmap, how much of the file the kernel is asked to read in advance (default 16)
+//!
 //! (probably abstracted to the base class)
 //!
 //!   .dump     - whether to archive input data
@@ -91,6 +98,9 @@ public:
     //! The number of samples in the file
     uint64_t samples() const;
 
+    //! The duration of the signal stored in the file, header excluded, in seconds
+    double signal_duration_s();
+
 protected:
     //! \brief Constructor
     //!
@@ -134,7 +144,7 @@ protected:
 
     // The methods create the various blocks, if enabled, and return access to them. The created
     // object is also held in this class
-    gr::blocks::file_source::sptr create_file_source();
+    gnss_shared_ptr<gr::block> create_file_source();
     gr::blocks::throttle::sptr create_throttle();
     gnss_shared_ptr<gr::block> create_valve();
     gr::blocks::file_sink::sptr create_sink();
@@ -152,7 +162,8 @@ protected:
     virtual void post_disconnect_hook(gr::top_block_sptr top_block);
 
 private:
-    gr::blocks::file_source::sptr file_source_;
+    gnss_shared_ptr<gr::block> file_source_;
+    mmap_file_source_sptr mmap_file_source_;  // same block as file_source_, if use_mmap
     gr::blocks::throttle::sptr throttle_;
     gr::blocks::file_sink::sptr sink_;
 
@@ -171,14 +182,17 @@ private:
     std::string item_type_;
     size_t item_size_;
     size_t header_size_;  // length (in samples) of the header (if any)
+    size_t mmap_readahead_bytes_;
     uint64_t samples_;
     int64_t sampling_frequency_;  // why is this signed
     double minimum_tail_s_;
     double seconds_to_skip_;
+    double seconds_to_process_;
     bool is_complex_;  // a misnomer; if I/Q are interleaved as integer values
     bool repeat_;
     bool enable_throttle_control_;
     bool dump_;
+    bool use_mmap_;
 };
 
 /** \} */
@@ -20,6 +20,7 @@
 #include "gnss_sdr_flags.h"
 #include "gnss_sdr_string_literals.h"
 #include "gnss_sdr_valve.h"
+#include "mmap_file_source.h"
 #include <exception>
 #include <fstream>
 #include <iomanip>
@@ -59,6 +60,8 @@ MultichannelFileSignalSource::MultichannelFileSignalSource(const ConfigurationIn
     enable_throttle_control_ = configuration->property(role + ".enable_throttle_control", false);
 
     const double seconds_to_skip = configuration->property(role + ".seconds_to_skip", default_seconds_to_skip);
+    const bool use_mmap = configuration->property(role + ".use_mmap", false);
+    const size_t mmap_readahead_bytes = configuration->property(role + ".mmap_readahead_mb", static_cast<uint64_t>(16)) * 1024 * 1024;
     size_t header_size = configuration->property(role + ".header_size", 0);
     int64_t samples_to_skip = 0;
 
@@ -96,34 +99,40 @@ MultichannelFileSignalSource::MultichannelFileSignalSource(const ConfigurationIn
                          << " unrecognized item type. Using gr_complex.";
             item_size_ = sizeof(gr_complex);
         }
+    if (seconds_to_skip > 0)
+        {
+            samples_to_skip = static_cast<int64_t>(seconds_to_skip * sampling_frequency_);
+
+            if (is_complex)
+                {
+                    samples_to_skip *= 2;
+                }
+        }
+    if (header_size > 0)
+        {
+            samples_to_skip += header_size;
+        }
+
     try
         {
             for (int32_t n = 0; n < n_channels_; n++)
                 {
-                    file_source_vec_.push_back(gr::blocks::file_source::make(item_size_, filename_vec_.at(n).c_str(), repeat_));
-
-                    if (seconds_to_skip > 0)
-                        {
-                            samples_to_skip = static_cast<int64_t>(seconds_to_skip * sampling_frequency_);
-
-                            if (is_complex)
-                                {
-                                    samples_to_skip *= 2;
-                                }
-                        }
-                    if (header_size > 0)
+                    if (use_mmap)
                         {
-                            samples_to_skip += header_size;
+                            file_source_vec_.push_back(mmap_file_source_make(item_size_, filename_vec_.at(n), repeat_, samples_to_skip, mmap_readahead_bytes));
+                            continue;
                         }
 
+                    auto file_source = gr::blocks::file_source::make(item_size_, filename_vec_.at(n).c_str(), repeat_);
                     if (samples_to_skip > 0)
                         {
                             LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file #" << n;
-                            if (not file_source_vec_.back()->seek(samples_to_skip, SEEK_SET))
+                            if (not file_source->seek(samples_to_skip, SEEK_SET))
                                 {
                                     LOG(INFO) << "Error skipping bytes!";
                                 }
                         }
+                    file_source_vec_.push_back(file_source);
                 }
         }
     catch (const std::exception& e)
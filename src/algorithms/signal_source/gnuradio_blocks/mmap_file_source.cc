@@ -0,0 +1,224 @@
+/*!
+ * \file mmap_file_source.cc
+ * \brief GNU Radio source block that reads samples from a memory-mapped file
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "mmap_file_source.h"
+#include "command_event.h"
+#include <gnuradio/io_signature.h>
+#include <fcntl.h>     // for open
+#include <sys/mman.h>  // for mmap, madvise
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+#include <algorithm>   // for std::min, std::max
+#include <cerrno>
+#include <cstring>    // for memcpy, strerror
+#include <stdexcept>  // for std::runtime_error
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+namespace
+{
+constexpr uint64_t WINDOW_ALIGNMENT = 2 * 1024 * 1024;  // huge page size on x86-64 and AArch64
+
+uint64_t align_down(uint64_t value)
+{
+    return value - value % WINDOW_ALIGNMENT;
+}
+}  // namespace
+
+
+mmap_file_source_sptr mmap_file_source_make(size_t item_size,
+    const std::string& filename,
+    bool repeat,
+    uint64_t items_to_skip,
+    size_t readahead_bytes)
+{
+    return mmap_file_source_sptr(new mmap_file_source(item_size, filename, repeat, items_to_skip, readahead_bytes));
+}
+
+
+mmap_file_source::mmap_file_source(size_t item_size,
+    const std::string& filename,
+    bool repeat,
+    uint64_t items_to_skip,
+    size_t readahead_bytes)
+    : gr::sync_block("mmap_file_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(1, 1, item_size)),
+      d_filename(filename),
+      d_queue(nullptr),
+      d_data(nullptr),
+      d_reservation(nullptr),
+      d_reservation_size(0),
+      d_item_size(item_size),
+      d_readahead_bytes(std::max(align_down(readahead_bytes + WINDOW_ALIGNMENT - 1), WINDOW_ALIGNMENT)),
+      d_file_size(0),
+      d_first_item(0),
+      d_end_item(0),
+      d_next_item(0),
+      d_nitems(0),
+      d_delivered_items(0),
+      d_advised_end(0),
+      d_released_end(0),
+      d_repeat(repeat)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        {
+            throw std::runtime_error("Cannot open " + filename + ": " + std::strerror(errno));
+        }
+    struct stat file_status = {};
+    if (::fstat(fd, &file_status) != 0 || file_status.st_size <= 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Cannot map " + filename + ": the file is empty or its size is unknown");
+        }
+    d_file_size = static_cast<uint64_t>(file_status.st_size);
+
+    // Reserve some extra address space so that the file can be mapped at a
+    // 2 MiB boundary, which allows the kernel to use huge pages where supported
+    d_reservation_size = d_file_size + WINDOW_ALIGNMENT;
+    d_reservation = ::mmap(nullptr, d_reservation_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (d_reservation == MAP_FAILED)
+        {
+            ::close(fd);
+            throw std::runtime_error("Cannot reserve memory to map " + filename + ": " + std::strerror(errno));
+        }
+    const auto reservation_start = reinterpret_cast<uintptr_t>(d_reservation);
+    const auto aligned_start = (reservation_start + WINDOW_ALIGNMENT - 1) & ~static_cast<uintptr_t>(WINDOW_ALIGNMENT - 1);
+    void* mapping = ::mmap(reinterpret_cast<void*>(aligned_start), d_file_size, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0);
+    const int map_error = errno;
+    ::close(fd);  // the mapping keeps the file open
+    if (mapping == MAP_FAILED)
+        {
+            ::munmap(d_reservation, d_reservation_size);
+            throw std::runtime_error("Cannot map " + filename + ": " + std::strerror(map_error));
+        }
+    d_data = static_cast<const char*>(mapping);
+    if (::madvise(mapping, d_file_size, MADV_SEQUENTIAL) != 0)
+        {
+            DLOG(WARNING) << "madvise(MADV_SEQUENTIAL) failed: " << std::strerror(errno);
+        }
+
+    d_end_item = d_file_size / d_item_size;
+    if (items_to_skip >= d_end_item)
+        {
+            LOG(WARNING) << "Skipping " << items_to_skip << " items, but file " << filename
+                         << " only has " << d_end_item;
+        }
+    d_first_item = std::min(items_to_skip, d_end_item);
+    d_next_item = d_first_item;
+    d_advised_end = align_down(d_first_item * d_item_size);
+    d_released_end = d_advised_end;
+    advise(d_first_item * d_item_size);
+
+    DLOG(INFO) << "Mapped " << d_file_size << " bytes of " << filename << ", starting at item " << d_first_item;
+}
+
+
+mmap_file_source::~mmap_file_source()
+{
+    if (d_reservation != nullptr)
+        {
+            // unmaps the file and the alignment padding at once
+            ::munmap(d_reservation, d_reservation_size);
+        }
+}
+
+
+void mmap_file_source::stop_after(uint64_t nitems, Concurrent_Queue<pmt::pmt_t>* queue)
+{
+    d_nitems = nitems;
+    d_queue = queue;
+}
+
+
+uint64_t mmap_file_source::items_in_file() const
+{
+    return d_end_item;
+}
+
+
+void mmap_file_source::advise(uint64_t byte_offset)
+{
+    // Both calls below happen once per 2 MiB of delivered data at most
+    const uint64_t window_start = std::max(align_down(byte_offset), d_advised_end);
+    const uint64_t window_end = std::min(align_down(byte_offset) + d_readahead_bytes, d_file_size);
+    if (window_end > window_start)
+        {
+            ::madvise(const_cast<char*>(d_data) + window_start, window_end - window_start, MADV_WILLNEED);
+            d_advised_end = window_end;
+        }
+
+    const uint64_t release_end = align_down(byte_offset);
+    if (release_end > d_released_end)
+        {
+            ::madvise(const_cast<char*>(d_data) + d_released_end, release_end - d_released_end, MADV_DONTNEED);
+            d_released_end = release_end;
+        }
+}
+
+
+int mmap_file_source::work(int noutput_items,
+    gr_vector_const_void_star& input_items __attribute__((unused)),
+    gr_vector_void_star& output_items)
+{
+    auto* out = static_cast<char*>(output_items[0]);
+    auto wanted = static_cast<uint64_t>(noutput_items);
+    if (d_nitems > 0)
+        {
+            if (d_delivered_items >= d_nitems)
+                {
+                    LOG(INFO) << "Stopping receiver, " << d_delivered_items << " samples processed";
+                    if (d_queue != nullptr)
+                        {
+                            d_queue->push(pmt::make_any(command_event_make(200, 0)));
+                        }
+                    return WORK_DONE;
+                }
+            wanted = std::min(wanted, d_nitems - d_delivered_items);
+        }
+
+    uint64_t produced = 0;
+    while (produced < wanted)
+        {
+            if (d_next_item >= d_end_item)
+                {
+                    if (!d_repeat || d_first_item >= d_end_item)
+                        {
+                            break;
+                        }
+                    d_next_item = d_first_item;
+                    d_advised_end = align_down(d_first_item * d_item_size);
+                    d_released_end = d_advised_end;
+                }
+            const uint64_t n = std::min(wanted - produced, d_end_item - d_next_item);
+            std::memcpy(out + produced * d_item_size, d_data + d_next_item * d_item_size, n * d_item_size);
+            produced += n;
+            d_next_item += n;
+            advise(d_next_item * d_item_size);
+        }
+
+    d_delivered_items += produced;
+    if (produced == 0)
+        {
+            return WORK_DONE;  // end of file
+        }
+    return static_cast<int>(produced);
+}
@@ -0,0 +1,122 @@
+/*!
+ * \file mmap_file_source.h
+ * \brief GNU Radio source block that reads samples from a memory-mapped file
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MMAP_FILE_SOURCE_H
+#define GNSS_SDR_MMAP_FILE_SOURCE_H
+
+#include "concurrent_queue.h"
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <gnuradio/types.h>  // for gr_vector_const_void_star
+#include <pmt/pmt.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+
+class mmap_file_source;
+
+using mmap_file_source_sptr = gnss_shared_ptr<mmap_file_source>;
+
+/*!
+ * \brief Creates a source of items of item_size bytes read from filename,
+ * starting at item items_to_skip. The kernel is asked to read ahead
+ * readahead_bytes of the file in advance of the samples being delivered.
+ * Throws std::runtime_error if the file cannot be mapped.
+ */
+mmap_file_source_sptr mmap_file_source_make(size_t item_size,
+    const std::string& filename,
+    bool repeat,
+    uint64_t items_to_skip,
+    size_t readahead_bytes);
+
+/*!
+ * \brief Drop-in replacement of gr::blocks::file_source that maps the whole
+ * file into memory instead of read()ing it.
+ *
+ * Samples are copied from the page cache straight into the output buffer,
+ * without a system call per work() invocation. The file is consumed through
+ * madvise() windows aligned to 2 MiB: the next window is requested with
+ * MADV_WILLNEED before it is needed, and the pages already delivered are
+ * released with MADV_DONTNEED, so that the memory footprint of the receiver
+ * does not grow with the size of the file. Skipping a header or a number of
+ * seconds is just an offset into the mapping.
+ *
+ * If stop_after() is called, the block also plays the role of
+ * Gnss_Sdr_Valve: it delivers that number of items and then notifies the
+ * control thread, saving the extra copy of the valve block.
+ */
+class mmap_file_source : public gr::sync_block
+{
+public:
+    ~mmap_file_source();
+
+    /*!
+     * \brief Stops the flow graph after nitems items, sending the same
+     * command to the control queue as Gnss_Sdr_Valve.
+     */
+    void stop_after(uint64_t nitems, Concurrent_Queue<pmt::pmt_t>* queue);
+
+    /*!
+     * \brief Number of items in the file, including the skipped ones.
+     */
+    uint64_t items_in_file() const;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+private:
+    friend mmap_file_source_sptr mmap_file_source_make(size_t item_size,
+        const std::string& filename,
+        bool repeat,
+        uint64_t items_to_skip,
+        size_t readahead_bytes);
+
+    mmap_file_source(size_t item_size,
+        const std::string& filename,
+        bool repeat,
+        uint64_t items_to_skip,
+        size_t readahead_bytes);
+
+    void advise(uint64_t byte_offset);
+
+    std::string d_filename;
+    Concurrent_Queue<pmt::pmt_t>* d_queue;
+    const char* d_data;   // start of the file in the mapping
+    void* d_reservation;  // whole mapping, including the alignment padding
+    size_t d_reservation_size;
+    size_t d_item_size;
+    size_t d_readahead_bytes;
+    uint64_t d_file_size;
+    uint64_t d_first_item;  // first item after the skipped ones
+    uint64_t d_end_item;    // one past the last complete item of the file
+    uint64_t d_next_item;   // next item to be delivered
+    uint64_t d_nitems;      // items to deliver before stopping (0: no limit)
+    uint64_t d_delivered_items;
+    uint64_t d_advised_end;   // end of the last MADV_WILLNEED window, in bytes
+    uint64_t d_released_end;  // end of the last MADV_DONTNEED region, in bytes
+    bool d_repeat;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MMAP_FILE_SOURCE_H
@@ -18,6 +18,8 @@
 
 #include "unpack_2bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_8u_unpack_lut_8i.h>  // for volk_gnsssdr_8u_unpack_lut_init
 
 struct byte_2bit_struct
 {
@@ -117,6 +119,25 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
     bool big_endian_bytes_system = systemBytesAreBigEndian();
 
     swap_endian_bytes_ = (big_endian_bytes_system != big_endian_bytes_);
+
+    // The sample_0 ... sample_3 fields of a byte take the bits 1-0 ... 7-6.
+    // Their output order is:
+    //   sample_0, sample_1, sample_2, sample_3 (no reverse interleaving nor swap)
+    //   sample_3, sample_2, sample_1, sample_0 (swap)
+    //   sample_1, sample_0, sample_3, sample_2 (reverse interleaving)
+    //   sample_2, sample_3, sample_0, sample_1 (reverse interleaving and swap)
+    unpack_flags_ = 0;
+    if (swap_endian_bytes_)
+        {
+            unpack_flags_ |= VOLK_GNSSSDR_UNPACK_HIGH_NIBBLE_FIRST;
+        }
+    unsigned int lut_flags = VOLK_GNSSSDR_UNPACK_ODD_LEVELS;
+    if (swap_endian_bytes_ != reverse_interleaving_)
+        {
+            lut_flags |= VOLK_GNSSSDR_UNPACK_MSB_SAMPLE_FIRST;
+        }
+    lut_ = std::vector<int8_t>(VOLK_GNSSSDR_UNPACK_LUT_SIZE);
+    volk_gnsssdr_8u_unpack_lut_init(lut_.data(), 2, lut_flags);
 }
 
 
@@ -133,7 +154,7 @@ int unpack_2bit_samples::work(int noutput_items,
     // Handle endian swap if needed
     if (swap_endian_items_)
         {
-            work_buffer_ = std::vector<int8_t>(ninput_bytes);
+            work_buffer_.resize(ninput_bytes);
             swapEndianness(in, work_buffer_, item_size_, ninput_items);
 
             in = const_cast<signed char const *>(&work_buffer_[0]);
@@ -143,68 +164,8 @@ int unpack_2bit_samples::work(int noutput_items,
     // converted. But we now have two possibilities:
     // 1) The samples in a byte are in big endian order
     // 2) The samples in a byte are in little endian order
-
-    byte_and_samples raw_byte{};
-    int n = 0;
-
-    if (!reverse_interleaving_)
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                        }
-                }
-        }
-    else
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                        }
-                }
-        }
+    // Both are handled by the lookup table and the flags set in the constructor.
+    volk_gnsssdr_8u_unpack_lut_8i(out, reinterpret_cast<const uint8_t *>(in), lut_.data(), 2, unpack_flags_, ninput_bytes * 4);
 
     return noutput_items;
 }
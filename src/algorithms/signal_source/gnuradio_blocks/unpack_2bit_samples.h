@@ -103,12 +103,14 @@ private:
         bool reverse_interleaving);
 
     std::vector<int8_t> work_buffer_;
+    std::vector<int8_t> lut_;  // see volk_gnsssdr_8u_unpack_lut_init()
     size_t item_size_;
     bool big_endian_bytes_;
     bool big_endian_items_;
     bool swap_endian_items_;
     bool swap_endian_bytes_;
     bool reverse_interleaving_;
+    unsigned int unpack_flags_;
 };
 
 
@@ -24,6 +24,8 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_interpolator.h>
+#include <cstdint>
+#include <vector>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -52,6 +54,8 @@ public:
 
 private:
     friend unpack_byte_2bit_cpx_samples_sptr make_unpack_byte_2bit_cpx_samples_sptr();
+
+    std::vector<int8_t> d_lut;  // see volk_gnsssdr_8u_unpack_lut_init()
 };
 
 
@@ -20,6 +20,8 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_interpolator.h>
+#include <cstdint>
+#include <vector>
 
 
 /** \addtogroup Signal_Source
@@ -48,6 +50,8 @@ public:
 
 private:
     friend unpack_byte_2bit_samples_sptr make_unpack_byte_2bit_samples_sptr();
+
+    std::vector<int8_t> d_lut;  // see volk_gnsssdr_8u_unpack_lut_init()
 };
 
 
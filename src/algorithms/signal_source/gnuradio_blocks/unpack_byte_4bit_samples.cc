@@ -18,6 +18,9 @@
 
 #include "unpack_byte_4bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_8u_unpack_lut_8i.h>  // for volk_gnsssdr_8u_unpack_lut_init
+#include <cstdint>
 
 unpack_byte_4bit_samples_sptr make_unpack_byte_4bit_samples()
 {
@@ -28,8 +31,11 @@ unpack_byte_4bit_samples_sptr make_unpack_byte_4bit_samples()
 unpack_byte_4bit_samples::unpack_byte_4bit_samples() : sync_interpolator("unpack_byte_4bit_samples",
                                                            gr::io_signature::make(1, 1, sizeof(int8_t)),
                                                            gr::io_signature::make(1, 1, sizeof(int16_t)),
-                                                           2)
+                                                           2),
+                                                       d_lut(VOLK_GNSSSDR_UNPACK_LUT_SIZE)
 {
+    // Each sample value x (two's complement) is mapped to 2 * x + 1
+    volk_gnsssdr_8u_unpack_lut_init(d_lut.data(), 4, VOLK_GNSSSDR_UNPACK_ODD_LEVELS);
 }
 
 
@@ -37,31 +43,10 @@ int unpack_byte_4bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const int8_t *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<int16_t *>(output_items[0]);
-    int n = 0;
-    unsigned char tmp_char2;
-    for (int i = 0; i < noutput_items / 2; i++)
-        {
-            tmp_char2 = in[i] & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = static_cast<int16_t>(2 * (tmp_char2 - 16) + 1);
-                }
-            else
-                {
-                    out[n++] = static_cast<int16_t>(2 * tmp_char2 + 1);
-                }
-            tmp_char2 = in[i] >> 4;
-            tmp_char2 = tmp_char2 & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = static_cast<int16_t>(2 * (tmp_char2 - 16) + 1);
-                }
-            else
-                {
-                    out[n++] = static_cast<int16_t>(2 * tmp_char2 + 1);
-                }
-        }
+
+    // Least significant nibble first
+    volk_gnsssdr_8u_unpack_lut_16i(out, in, d_lut.data(), 4, 0, noutput_items);
     return noutput_items;
 }
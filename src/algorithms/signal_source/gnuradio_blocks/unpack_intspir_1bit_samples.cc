@@ -40,29 +40,18 @@ int unpack_intspir_1bit_samples::work(int noutput_items,
     const auto *in = reinterpret_cast<const signed int *>(input_items[0]);
     auto *out = reinterpret_cast<float *>(output_items[0]);
 
-    int n = 0;
-    int channel = 1;
+    // Read packed input sample (1 int = 1 complex sample, bit 0 is I and bit 1 is Q)
+    // For historical reasons, values are float versions of short int limits (32767)
+    static const float levels[4][2] = {
+        {-32767.0F, -32767.0F},
+        {32767.0F, -32767.0F},
+        {-32767.0F, 32767.0F},
+        {32767.0F, 32767.0F}};
     for (int i = 0; i < noutput_items / 2; i++)
         {
-            // Read packed input sample (1 byte = 1 complex sample)
-            // For historical reasons, values are float versions of short int limits (32767)
-            signed int val = in[i];
-            if (((val >> ((channel - 1) * 2)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
-            if (((val >> (2 * channel - 1)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
+            const float *sample = levels[in[i] & 3];
+            out[2 * i] = sample[0];
+            out[2 * i + 1] = sample[1];
         }
     return noutput_items;
 }
@@ -230,6 +230,8 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
         }
 
     d_page_part_symbols = std::vector<float>(d_frame_length_symbols);
+    d_page_symbols_soft_value = std::vector<float>(d_frame_length_symbols);
+    d_page_bits = std::vector<int32_t>(d_frame_length_symbols / 2);
 
     for (int32_t i = 0; i < d_bits_per_preamble; i++)
         {
@@ -359,8 +361,7 @@ void galileo_telemetry_decoder_gs::deinterleaver(int32_t rows, int32_t cols, con
 void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, int32_t frame_length, double cn0)
 {
     // 1. De-interleave
-    std::vector<float> page_part_symbols_soft_value(frame_length);
-    deinterleaver(GALILEO_INAV_INTERLEAVER_ROWS, GALILEO_INAV_INTERLEAVER_COLS, page_part_symbols, page_part_symbols_soft_value.data());
+    deinterleaver(GALILEO_INAV_INTERLEAVER_ROWS, GALILEO_INAV_INTERLEAVER_COLS, page_part_symbols, d_page_symbols_soft_value.data());
 
     // 2. Viterbi decoder
     // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
@@ -368,37 +369,25 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
         {
             if ((i + 1) % 2 == 0)
                 {
-                    page_part_symbols_soft_value[i] = -page_part_symbols_soft_value[i];
+                    d_page_symbols_soft_value[i] = -d_page_symbols_soft_value[i];
                 }
         }
     const int32_t decoded_length = frame_length / 2;
-    std::vector<int32_t> page_part_bits(decoded_length);
-    d_viterbi->decode(page_part_bits, page_part_symbols_soft_value);
+    d_viterbi->decode(d_page_bits, d_page_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
-    for (int32_t i = 0; i < decoded_length; i++)
-        {
-            if (page_part_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
-        }
+    Galileo_Inav_Page_Part page_part;
+    page_part.assign(d_page_bits.data(), decoded_length);
 
     if (d_enable_navdata_monitor)
         {
-            d_nav_msg_packet.nav_message = page_String;
+            d_nav_msg_packet.nav_message = page_part.to_string(0, decoded_length);
         }
 
-    if (page_part_bits[0] == 1)
+    if (d_page_bits[0] == 1)
         {
             // DECODE COMPLETE WORD (even + odd) and TEST CRC
-            d_inav_nav.split_page(std::move(page_String), d_flag_even_word_arrived);
+            d_inav_nav.split_page(page_part, d_flag_even_word_arrived);
             if (d_inav_nav.get_flag_CRC_test() == true)
                 {
                     if (d_band == '1')
@@ -426,7 +415,7 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
     else
         {
             // STORE HALF WORD (even page)
-            d_inav_nav.split_page(std::move(page_String), d_flag_even_word_arrived);
+            d_inav_nav.split_page(page_part, d_flag_even_word_arrived);
             d_flag_even_word_arrived = 1;
         }
 
@@ -586,8 +575,7 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
 void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t frame_length, double cn0)
 {
     // 1. De-interleave
-    std::vector<float> page_symbols_soft_value(frame_length);
-    deinterleaver(GALILEO_FNAV_INTERLEAVER_ROWS, GALILEO_FNAV_INTERLEAVER_COLS, page_symbols, page_symbols_soft_value.data());
+    deinterleaver(GALILEO_FNAV_INTERLEAVER_ROWS, GALILEO_FNAV_INTERLEAVER_COLS, page_symbols, d_page_symbols_soft_value.data());
 
     // 2. Viterbi decoder
     // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
@@ -595,36 +583,24 @@ void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t
         {
             if ((i + 1) % 2 == 0)
                 {
-                    page_symbols_soft_value[i] = -page_symbols_soft_value[i];
+                    d_page_symbols_soft_value[i] = -d_page_symbols_soft_value[i];
                 }
         }
 
     const int32_t decoded_length = frame_length / 2;
-    std::vector<int32_t> page_bits(decoded_length);
-    d_viterbi->decode(page_bits, page_symbols_soft_value);
+    d_viterbi->decode(d_page_bits, d_page_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
-    for (int32_t i = 0; i < decoded_length; i++)
-        {
-            if (page_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
-        }
+    Galileo_Fnav_Page page;
+    page.assign(d_page_bits.data(), decoded_length);
 
     if (d_enable_navdata_monitor)
         {
-            d_nav_msg_packet.nav_message = page_String;
+            d_nav_msg_packet.nav_message = page.to_string(0, decoded_length);
         }
 
     // DECODE COMPLETE WORD (even + odd) and TEST CRC
-    d_fnav_nav.split_page(page_String);
+    d_fnav_nav.split_page(page);
     if (d_fnav_nav.get_flag_CRC_test() == true)
         {
             DLOG(INFO) << "Galileo E5a CRC correct in channel " << d_channel << " from satellite " << d_satellite << " with CN0=" << cn0 << " dB-Hz";
@@ -685,8 +661,7 @@ void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t
 void galileo_telemetry_decoder_gs::decode_CNAV_word(uint64_t time_stamp, float *page_symbols, int32_t page_length, double cn0)
 {
     // 1. De-interleave
-    std::vector<float> page_symbols_soft_value(page_length);
-    deinterleaver(GALILEO_CNAV_INTERLEAVER_ROWS, GALILEO_CNAV_INTERLEAVER_COLS, page_symbols, page_symbols_soft_value.data());
+    deinterleaver(GALILEO_CNAV_INTERLEAVER_ROWS, GALILEO_CNAV_INTERLEAVER_COLS, page_symbols, d_page_symbols_soft_value.data());
 
     // 2. Viterbi decoder
     // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
@@ -694,34 +669,22 @@ void galileo_telemetry_decoder_gs::decode_CNAV_word(uint64_t time_stamp, float *
         {
             if ((i + 1) % 2 == 0)
                 {
-                    page_symbols_soft_value[i] = -page_symbols_soft_value[i];
+                    d_page_symbols_soft_value[i] = -d_page_symbols_soft_value[i];
                 }
         }
     const int32_t decoded_length = page_length / 2;
-    std::vector<int32_t> page_bits(decoded_length);
-    d_viterbi->decode(page_bits, page_symbols_soft_value);
+    d_viterbi->decode(d_page_bits, d_page_symbols_soft_value);
 
     // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
-    for (int32_t i = 0; i < decoded_length; i++)
-        {
-            if (page_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
-        }
+    Galileo_Cnav_Page page;
+    page.assign(d_page_bits.data(), decoded_length);
 
     if (d_enable_navdata_monitor)
         {
-            d_nav_msg_packet.nav_message = page_String;
+            d_nav_msg_packet.nav_message = page.to_string(0, decoded_length);
         }
 
-    d_cnav_nav.read_HAS_page(page_String);
+    d_cnav_nav.read_HAS_page(page);
     d_cnav_nav.set_time_stamp(time_stamp);
     // 4. If we have a new HAS page, read it
     if (d_cnav_nav.have_new_HAS_page() == true)
@@ -90,6 +90,8 @@ private:
     std::unique_ptr<Viterbi_Decoder> d_viterbi;
     std::vector<int32_t> d_preamble_samples;
     std::vector<float> d_page_part_symbols;
+    std::vector<float> d_page_symbols_soft_value;
+    std::vector<int32_t> d_page_bits;
 
     std::string d_dump_filename;
     std::ofstream d_dump_file;
@@ -15,6 +15,7 @@
  */
 
 #include "sbas_l1_telemetry_decoder_gs.h"
+#include "crc24q.h"
 #include "gnss_synchro.h"
 #include "viterbi_decoder_sbas.h"
 #include <gnuradio/io_signature.h>
@@ -320,9 +321,7 @@ void sbas_l1_telemetry_decoder_gs::Crc_Verifier::get_valid_frames(const std::vec
             std::vector<uint8_t> candidate_bytes;
             zerropad_back_and_convert_to_bytes(candidate_it->second, candidate_bytes);
             // verify CRC
-            d_checksum_agent.reset(0);
-            d_checksum_agent.process_bytes(candidate_bytes.data(), candidate_bytes.size());
-            const uint32_t crc = d_checksum_agent.checksum();
+            const uint32_t crc = Crc24q::checksum(candidate_bytes.data(), candidate_bytes.size());
             VLOG(SAMP_SYNC) << "candidate " << candidate_it - msg_candidates.begin()
                             << ": final crc remainder= " << std::hex << crc
                             << std::setfill(' ') << std::resetiosflags(std::ios::hex);
@@ -15,8 +15,8 @@
  */
 
 #include "viterbi_decoder.h"
-#include <volk_gnsssdr/volk_gnsssdr.h>  // for volk_gnsssdr_32f_index_max_32u
-#include <algorithm>                    // for std::copy
+#include <volk_gnsssdr/volk_gnsssdr.h>  // for volk_gnsssdr_32f_index_max_32u, volk_gnsssdr_32f_conv_k7_r2_32u
+#include <algorithm>                    // for std::copy, std::fill
 
 Viterbi_Decoder::Viterbi_Decoder(int32_t KK,
     int32_t nn,
@@ -41,10 +41,78 @@ Viterbi_Decoder::Viterbi_Decoder(int32_t KK,
     d_state1 = std::vector<int32_t>(d_states);
     nsc_transit(d_out0, d_state0, 0);
     nsc_transit(d_out1, d_state1, 1);
+
+    // The two branches arriving to a state have opposite expected symbols if
+    // both polynomials have their first and last taps set, as in the codes of
+    // Galileo, SBAS and GPS L2C. Then the SIMD butterfly kernel can be used.
+    d_use_k7_r2_kernel = (d_KK == 7) && (d_nn == 2);
+    for (int32_t i = 0; i < d_nn; i++)
+        {
+            if ((d_g[i] & 1) == 0 || (d_g[i] & (1 << d_mm)) == 0)
+                {
+                    d_use_k7_r2_kernel = false;
+                }
+        }
+    if (d_use_k7_r2_kernel)
+        {
+            const int32_t butterflies = d_states / 2;
+            d_branch_signs = std::vector<float>(d_states);
+            for (int32_t j = 0; j < butterflies; j++)
+                {
+                    // output bits of the transition from state 2j with input bit 0
+                    const int32_t out = d_out0[2 * j];
+                    d_branch_signs[j] = ((out >> 1) & 1) ? 1.0F : -1.0F;
+                    d_branch_signs[butterflies + j] = (out & 1) ? 1.0F : -1.0F;
+                }
+            d_path_metrics = std::vector<float>(d_states);
+            d_decisions = std::vector<uint32_t>(2 * (d_LL + d_mm));
+        }
 }
 
 
 void Viterbi_Decoder::decode(std::vector<int32_t>& output_u_int, const std::vector<float>& input_c)
+{
+    if (d_use_k7_r2_kernel)
+        {
+            decode_k7_r2(output_u_int.data(), input_c.data());
+        }
+    else
+        {
+            decode_generic(output_u_int.data(), input_c.data());
+        }
+}
+
+
+void Viterbi_Decoder::decode_k7_r2(int32_t* output_u_int, const float* input_c)
+{
+    const int32_t butterflies = d_states / 2;
+    int32_t t;
+    int32_t state;
+
+    // start in all-zeros state
+    d_path_metrics[0] = 0.0;
+    std::fill(d_path_metrics.begin() + 1, d_path_metrics.end(), -d_MAXLOG);
+
+    // go through trellis
+    volk_gnsssdr_32f_conv_k7_r2_32u(d_decisions.data(), d_path_metrics.data(), input_c, d_branch_signs.data(), d_LL + d_mm);
+
+    // trace-back operation, from the all-zeros state at the end of the tail
+    state = 0;
+    for (t = d_LL + d_mm - 1; t >= 0; t--)
+        {
+            const int32_t j = state & (butterflies - 1);
+            const int32_t bit = state >> (d_mm - 1);
+            const uint32_t decision = (d_decisions[2 * t + bit] >> j) & 1U;
+            if (t < d_LL)
+                {
+                    output_u_int[t] = bit;
+                }
+            state = 2 * j + static_cast<int32_t>(decision);
+        }
+}
+
+
+void Viterbi_Decoder::decode_generic(int32_t* output_u_int, const float* input_c)
 {
     int32_t i;
     int32_t t;
@@ -53,12 +121,14 @@ void Viterbi_Decoder::decode(std::vector<int32_t>& output_u_int, const std::vect
     float metric;
     float max_val;
 
-    d_prev_section[0] = 0.0;  //  start in all-zeros state
+    //  start in all-zeros state
+    std::fill(d_prev_section.begin(), d_prev_section.end(), -d_MAXLOG);
+    d_prev_section[0] = 0.0;
 
     // go through trellis
     for (t = 0; t < d_LL + d_mm; t++)
         {
-            std::copy(input_c.begin() + d_nn * t, input_c.begin() + d_nn * t + (d_nn - 1), d_rec_array.begin());
+            std::copy(input_c + d_nn * t, input_c + d_nn * (t + 1), d_rec_array.begin());
 
             // precompute all possible branch metrics
             for (i = 0; i < d_number_symbols; i++)
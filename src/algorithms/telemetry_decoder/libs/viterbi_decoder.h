@@ -101,6 +101,17 @@ private:
         int32_t input,
         int32_t state_in) const;
 
+    /*
+     * Decodes one frame with the SIMD add-compare-select kernel for K = 7,
+     * rate 1/2 codes
+     */
+    void decode_k7_r2(int32_t* output_u_int, const float* input_c);
+
+    /*
+     * Decodes one frame of a generic code, one state at a time
+     */
+    void decode_generic(int32_t* output_u_int, const float* input_c);
+
     std::vector<float> d_prev_section{};
     std::vector<float> d_next_section{};
 
@@ -115,6 +126,10 @@ private:
     std::vector<int32_t> d_state0;
     std::vector<int32_t> d_state1;
 
+    std::vector<float> d_branch_signs;  // expected symbols of each butterfly, as +1 or -1
+    std::vector<float> d_path_metrics;  // path metrics of the K = 7 trellis
+    std::vector<uint32_t> d_decisions;  // one bit per state and stage
+
     float d_MAXLOG = 1e7;  // Define infinity
     int32_t d_KK{};
     int32_t d_nn{};
@@ -123,6 +138,7 @@ private:
     int32_t d_mm{};
     int32_t d_states{};
     int32_t d_number_symbols{};
+    bool d_use_k7_r2_kernel{};
 };
 
 /** \} */
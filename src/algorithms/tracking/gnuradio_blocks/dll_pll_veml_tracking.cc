@@ -58,6 +58,7 @@
 #include <map>
 #include <memory>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #if USE_GLOG_AND_GFLAGS
@@ -79,6 +80,7 @@ namespace wht = boost;
 namespace wht = std;
 #endif
 
+
 dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_)
 {
     return dll_pll_veml_tracking_sptr(new dll_pll_veml_tracking(conf_));
@@ -109,6 +111,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
       d_code_phase_step_chips(0.0),
       d_code_phase_rate_step_chips(0.0),
       d_rem_code_phase_samples(0.0),  // Residual code phase (in chips)
+      d_sample_counter(0ULL),
       d_acq_sample_stamp(0ULL),
       d_rem_carr_phase_rad(0.0),  // Residual carrier phase
       d_state(0),                 // initial state: standby
@@ -471,8 +474,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
     d_carrier_loop_filter.set_params(d_trk_parameters.fll_bw_hz, d_trk_parameters.pll_bw_hz, d_trk_parameters.pll_filter_order);
 
     // Initialization of local code replica
-    // Get space for a vector with the sinboc(1,1) replica sampled 2x/chip
-    d_tracking_code.resize(2 * d_code_length_chips, 0.0);
+    // The replicas are shared with other channels through Tracking_Code_Cache, see start_tracking()
     // correlator outputs (scalar)
     if (d_veml)
         {
@@ -533,12 +535,13 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_)
             // Extra correlator for the data component
             d_correlator_data_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
             d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
-            d_data_code.resize(2 * d_code_length_chips, 0.0);
+            d_correlator_data_cpu.set_fused_resampler(d_trk_parameters.fused_resampler);
         }
 
     // --- Initializations ---
     d_Prompt_circular_buffer.set_capacity(d_secondary_code_length);
     d_multicorrelator_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    d_multicorrelator_cpu.set_fused_resampler(d_trk_parameters.fused_resampler);
 
     // CN0 estimation and lock detector buffers
     d_Prompt_buffer = volk_gnsssdr::vector<gr_complex>(d_trk_parameters.cn0_samples);
@@ -645,6 +648,13 @@ void dll_pll_veml_tracking::msg_handler_telemetry_to_trk(const pmt::pmt_t &msg)
 }
 
 
+std::shared_ptr<const Tracking_Code_Cache::Code> dll_pll_veml_tracking::local_code(bool pilot, const std::function<void(Tracking_Code_Cache::Code &)> &generate) const
+{
+    return Tracking_Code_Cache::instance().get_or_generate(Tracking_Code_Cache::make_key(*d_acquisition_gnss_synchro, pilot, static_cast<uint32_t>(d_code_samples_per_chip)),
+        static_cast<size_t>(d_code_samples_per_chip * d_code_length_chips), generate);
+}
+
+
 void dll_pll_veml_tracking::start_tracking()
 {
     gr::thread::scoped_lock l(d_setlock);
@@ -666,87 +676,71 @@ void dll_pll_veml_tracking::start_tracking()
 
     if (d_systemName == "GPS" and d_signal_type == "1C")
         {
-            gps_l1_ca_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l1_ca_code_gen_float(code, d_acquisition_gnss_synchro->PRN, 0); });
         }
     else if (d_systemName == "GPS" and d_signal_type == "2S")
         {
-            gps_l2c_m_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l2c_m_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
         }
     else if (d_systemName == "GPS" and d_signal_type == "L5")
         {
             if (d_trk_parameters.track_pilot)
                 {
-                    gps_l5q_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
-                    gps_l5i_code_gen_float(d_data_code, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) { gps_l5q_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
+                    d_data_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l5i_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    gps_l5i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l5i_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "1B")
         {
             if (d_trk_parameters.track_pilot)
                 {
-                    const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
-                    galileo_e1_code_gen_sinboc11_float(d_tracking_code, pilot_signal, d_acquisition_gnss_synchro->PRN);
-                    galileo_e1_code_gen_sinboc11_float(d_data_code, Signal_, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) {
+                        const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
+                        galileo_e1_code_gen_sinboc11_float(code, pilot_signal, d_acquisition_gnss_synchro->PRN);
+                    });
+                    d_data_code = local_code(false, [this, &Signal_](Tracking_Code_Cache::Code &code) { galileo_e1_code_gen_sinboc11_float(code, Signal_, d_acquisition_gnss_synchro->PRN); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    galileo_e1_code_gen_sinboc11_float(d_tracking_code, Signal_, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(false, [this, &Signal_](Tracking_Code_Cache::Code &code) { galileo_e1_code_gen_sinboc11_float(code, Signal_, d_acquisition_gnss_synchro->PRN); });
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "5X")
         {
-            volk_gnsssdr::vector<gr_complex> aux_code(d_code_length_chips);
-            const std::array<char, 3> signal_type_ = {{'5', 'X', '\0'}};
-            galileo_e5_a_code_gen_complex_primary(aux_code, d_acquisition_gnss_synchro->PRN, signal_type_);
             if (d_trk_parameters.track_pilot)
                 {
                     d_secondary_code_string = GALILEO_E5A_Q_SECONDARY_CODE[d_acquisition_gnss_synchro->PRN - 1];
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].imag();
-                            d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5aI + E5aQ)
-                        }
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '5', true); });
+                    d_data_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '5', false); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].real();
-                        }
+                    d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '5', false); });
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "7X")
         {
-            volk_gnsssdr::vector<gr_complex> aux_code(d_code_length_chips);
-            const std::array<char, 3> signal_type_ = {{'7', 'X', '\0'}};
-            galileo_e5_b_code_gen_complex_primary(aux_code, d_acquisition_gnss_synchro->PRN, signal_type_);
             if (d_trk_parameters.track_pilot)
                 {
                     d_secondary_code_string = GALILEO_E5B_Q_SECONDARY_CODE[d_acquisition_gnss_synchro->PRN - 1];
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].imag();
-                            d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5bI + E5bsQ)
-                        }
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '7', true); });
+                    d_data_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '7', false); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].real();
-                        }
+                    d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '7', false); });
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "E6")
@@ -754,19 +748,19 @@ void dll_pll_veml_tracking::start_tracking()
             if (d_trk_parameters.track_pilot)
                 {
                     d_secondary_code_string = galileo_e6_c_secondary_code(d_acquisition_gnss_synchro->PRN);
-                    galileo_e6_b_code_gen_float_primary(d_data_code, d_acquisition_gnss_synchro->PRN);
-                    galileo_e6_c_code_gen_float_primary(d_tracking_code, d_acquisition_gnss_synchro->PRN);
+                    d_data_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e6_b_code_gen_float_primary(code, d_acquisition_gnss_synchro->PRN); });
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) { galileo_e6_c_code_gen_float_primary(code, d_acquisition_gnss_synchro->PRN); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    galileo_e6_b_code_gen_float_primary(d_tracking_code, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e6_b_code_gen_float_primary(code, d_acquisition_gnss_synchro->PRN); });
                 }
         }
     else if (d_systemName == "Beidou" and d_signal_type == "B1")
         {
-            beidou_b1i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { beidou_b1i_code_gen_float(code, d_acquisition_gnss_synchro->PRN, 0); });
             // GEO Satellites use different secondary code
             if ((d_acquisition_gnss_synchro->PRN > 0 and d_acquisition_gnss_synchro->PRN < 6) or (d_acquisition_gnss_synchro->PRN > 58))
                 {
@@ -803,7 +797,7 @@ void dll_pll_veml_tracking::start_tracking()
 
     else if (d_systemName == "Beidou" and d_signal_type == "B3")
         {
-            beidou_b3i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { beidou_b3i_code_gen_float(code, d_acquisition_gnss_synchro->PRN, 0); });
             // Update secondary code settings for geo satellites
             if ((d_acquisition_gnss_synchro->PRN > 0 and d_acquisition_gnss_synchro->PRN < 6) or (d_acquisition_gnss_synchro->PRN > 58))
                 {
@@ -838,7 +832,12 @@ void dll_pll_veml_tracking::start_tracking()
                 }
         }
 
-    d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+    if (!d_tracking_code)
+        {
+            // Unsupported signal: keep the all-zero replica of previous versions
+            d_tracking_code = local_code(false, [](Tracking_Code_Cache::Code & /*code*/) {});
+        }
+    d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code->data(), d_local_code_shift_chips.data());
     std::fill_n(d_correlator_outs.begin(), d_n_correlator_taps, gr_complex(0.0, 0.0));
 
     d_carrier_lock_fail_counter = 0;
@@ -1429,7 +1428,7 @@ void dll_pll_veml_tracking::log_data()
                     d_dump_file.write(reinterpret_cast<char *>(&prompt_I), sizeof(float));
                     d_dump_file.write(reinterpret_cast<char *>(&prompt_Q), sizeof(float));
                     // PRN start sample stamp
-                    tmp_long_int = this->nitems_read(0) + static_cast<uint64_t>(d_current_prn_length_samples);
+                    tmp_long_int = d_sample_counter + static_cast<uint64_t>(d_current_prn_length_samples);
                     d_dump_file.write(reinterpret_cast<char *>(&tmp_long_int), sizeof(uint64_t));
                     // accumulated carrier phase
                     tmp_float = static_cast<float>(d_acc_carrier_phase_rad);
@@ -1463,7 +1462,7 @@ void dll_pll_veml_tracking::log_data()
                     // AUX vars (for debug purposes)
                     tmp_float = static_cast<float>(d_rem_code_phase_samples);
                     d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_double = static_cast<double>(this->nitems_read(0) + d_current_prn_length_samples);
+                    tmp_double = static_cast<double>(d_sample_counter + d_current_prn_length_samples);
                     d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
                     // PRN
                     uint32_t prn_ = d_acquisition_gnss_synchro->PRN;
@@ -1730,20 +1729,15 @@ int64_t dll_pll_veml_tracking::uint64diff(uint64_t first, uint64_t second)
 }
 
 
-int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items,
-    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+bool dll_pll_veml_tracking::track_step(const gr_complex *in, int32_t ninput_items, int32_t &consumed_samples,
+    Gnss_Synchro &current_synchro_data, bool &loss_of_lock)
 {
-    gr::thread::scoped_lock l(d_setlock);
-    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
-    auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
-    Gnss_Synchro current_synchro_data = Gnss_Synchro();
     current_synchro_data.Flag_valid_symbol_output = false;
-    bool loss_of_lock = false;
+    loss_of_lock = false;
 
     if (d_pull_in_transitory == true)
         {
-            // if (d_trk_parameters.pull_in_time_s < (d_sample_counter - d_acq_sample_stamp) / static_cast<int>(d_trk_parameters.fs_in))
-            if (d_trk_parameters.pull_in_time_s < (this->nitems_read(0) - d_acq_sample_stamp) / static_cast<int>(d_trk_parameters.fs_in))
+            if (d_trk_parameters.pull_in_time_s < (d_sample_counter - d_acq_sample_stamp) / static_cast<int>(d_trk_parameters.fs_in))
                 {
                     d_pull_in_transitory = false;
                     d_carrier_lock_fail_counter = 0;
@@ -1754,16 +1748,13 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
         {
         case 0:  // Standby - Consume samples at full throttle, do nothing
             {
-                // d_sample_counter += static_cast<uint64_t>(ninput_items[0]);
-                consume_each(ninput_items[0]);
-                return 0;
-                break;
+                consumed_samples = ninput_items;
+                return false;
             }
         case 1:  // Pull-in
             {
                 // Signal alignment (skip samples until the incoming signal is aligned with local replica)
-                // const int64_t acq_trk_diff_samples = static_cast<int64_t>(d_sample_counter) - static_cast<int64_t>(d_acq_sample_stamp);
-                const int64_t acq_trk_diff_samples = static_cast<int64_t>(this->nitems_read(0)) - static_cast<int64_t>(d_acq_sample_stamp);
+                const int64_t acq_trk_diff_samples = static_cast<int64_t>(d_sample_counter) - static_cast<int64_t>(d_acq_sample_stamp);
                 const double acq_trk_diff_seconds = static_cast<double>(acq_trk_diff_samples) / d_trk_parameters.fs_in;
                 const double delta_trk_to_acq_prn_start_samples = static_cast<double>(acq_trk_diff_samples) - d_acq_code_phase_samples;
 
@@ -1780,7 +1771,6 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                 const int32_t samples_offset = round(d_acq_code_phase_samples);
                 d_acc_carrier_phase_rad -= d_carrier_phase_step_rad * static_cast<double>(samples_offset);
                 d_state = 2;
-                // d_sample_counter += samples_offset;  // count for the processed samples
                 d_cn0_smoother.reset();
                 d_carrier_lock_test_smoother.reset();
 
@@ -1788,8 +1778,8 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                 DLOG(INFO) << "PULL-IN Doppler [Hz] = " << d_carrier_doppler_hz
                            << ". PULL-IN Code Phase [samples] = " << d_acq_code_phase_samples;
 
-                consume_each(samples_offset);  // shift input to perform alignment with local replica
-                return 0;
+                consumed_samples = samples_offset;  // shift input to perform alignment with local replica
+                return false;
             }
         case 2:  // Wide tracking and symbol synchronization
             {
@@ -1811,8 +1801,7 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                 //    }
 
                 // fail-safe: check if the secondary code or bit synchronization has not succeeded in a limited time period
-                // if (d_trk_parameters.bit_synchronization_time_limit_s < (d_sample_counter - d_acq_sample_stamp) / static_cast<int>(d_trk_parameters.fs_in))
-                if (d_trk_parameters.bit_synchronization_time_limit_s < (this->nitems_read(0) - d_acq_sample_stamp) / static_cast<int>(d_trk_parameters.fs_in))
+                if (d_trk_parameters.bit_synchronization_time_limit_s < (d_sample_counter - d_acq_sample_stamp) / static_cast<int>(d_trk_parameters.fs_in))
                     {
                         d_carrier_lock_fail_counter = 300000;  // force loss-of-lock condition
                         LOG(INFO) << d_systemName << " " << d_signal_pretty_name << " tracking synchronization time limit reached in channel " << d_channel
@@ -2032,9 +2021,13 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
             }
         }
 
-    // time tags
-    std::vector<gr::tag_t> tags_vec;
-    this->get_tags_in_range(tags_vec, 0, this->nitems_read(0), this->nitems_read(0) + d_current_prn_length_samples);
+    consumed_samples = d_current_prn_length_samples;
+    return true;
+}
+
+
+void dll_pll_veml_tracking::process_time_tags(const std::vector<gr::tag_t> &tags_vec)
+{
     for (const auto &it : tags_vec)
         {
             try
@@ -2062,13 +2055,15 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                     LOG(WARNING) << "Bad any_cast: " << ex.what();
                 }
         }
+}
+
 
-    consume_each(d_current_prn_length_samples);
-    // d_sample_counter += static_cast<uint64_t>(d_current_prn_length_samples);
+bool dll_pll_veml_tracking::set_synchro_output(Gnss_Synchro &current_synchro_data, bool loss_of_lock, std::shared_ptr<GnssTime> &timetag)
+{
     if (current_synchro_data.Flag_valid_symbol_output || loss_of_lock)
         {
             current_synchro_data.fs = static_cast<int64_t>(d_trk_parameters.fs_in);
-            current_synchro_data.Tracking_sample_counter = this->nitems_read(0);
+            current_synchro_data.Tracking_sample_counter = d_sample_counter;
             current_synchro_data.Flag_valid_symbol_output = !loss_of_lock;
             current_synchro_data.Flag_PLL_180_deg_phase_locked = d_Flag_PLL_180_deg_phase_locked;
 
@@ -2081,17 +2076,48 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
                     double intpart;
                     d_last_timetag.tow_ms_fraction = d_last_timetag.tow_ms_fraction + modf(1000.0 * static_cast<double>(diff_samplecount) / d_trk_parameters.fs_in, &intpart);
 
-                    const std::shared_ptr<GnssTime> tmp_obj = std::make_shared<GnssTime>(GnssTime());
-                    tmp_obj->week = d_last_timetag.week;
-                    tmp_obj->tow_ms = d_last_timetag.tow_ms + static_cast<int>(intpart);
-                    tmp_obj->tow_ms_fraction = d_last_timetag.tow_ms_fraction;
-                    tmp_obj->rx_time = static_cast<double>(current_synchro_data.Tracking_sample_counter) / d_trk_parameters.fs_in;
-                    add_item_tag(0, this->nitems_written(0) + 1, pmt::mp("timetag"), pmt::make_any(tmp_obj));
+                    timetag = std::make_shared<GnssTime>(GnssTime());
+                    timetag->week = d_last_timetag.week;
+                    timetag->tow_ms = d_last_timetag.tow_ms + static_cast<int>(intpart);
+                    timetag->tow_ms_fraction = d_last_timetag.tow_ms_fraction;
+                    timetag->rx_time = static_cast<double>(current_synchro_data.Tracking_sample_counter) / d_trk_parameters.fs_in;
 
                     // std::cout << "[" << this->nitems_written(0) + 1 << "][diff_time: " << 1000.0 * static_cast<double>(diff_samplecount) / d_trk_parameters.fs_in << "] Sent TimeTag Week: " << d_last_timetag.week << ", TOW: " << d_last_timetag.tow_ms << " [ms], TOW fraction: " << d_last_timetag.tow_ms_fraction << " [ms] \n";
                     d_timetag_waiting = false;
                 }
+            return true;
+        }
+    return false;
+}
+
 
+int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items,
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    gr::thread::scoped_lock l(d_setlock);
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
+    Gnss_Synchro current_synchro_data = Gnss_Synchro();
+    bool loss_of_lock = false;
+    int32_t consumed_samples = 0;
+
+    d_sample_counter = this->nitems_read(0);
+    if (track_step(in, ninput_items[0], consumed_samples, current_synchro_data, loss_of_lock))
+        {
+            // time tags
+            std::vector<gr::tag_t> tags_vec;
+            this->get_tags_in_range(tags_vec, 0, d_sample_counter, d_sample_counter + d_current_prn_length_samples);
+            process_time_tags(tags_vec);
+        }
+    consume_each(consumed_samples);
+
+    std::shared_ptr<GnssTime> timetag;
+    if (set_synchro_output(current_synchro_data, loss_of_lock, timetag))
+        {
+            if (timetag)
+                {
+                    add_item_tag(0, this->nitems_written(0) + 1, pmt::mp("timetag"), pmt::make_any(timetag));
+                }
             *out[0] = std::move(current_synchro_data);
             return 1;
         }
@@ -24,19 +24,24 @@
 #include "gnss_block_interface.h"
 #include "gnss_time.h"                // for timetags produced by File_Timestamp_Signal_Source
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
+#include "tracking_code_cache.h"
 #include "tracking_loop_filter.h"     // for DLL filter
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>                   // for block
 #include <gnuradio/gr_complex.h>              // for gr_complex
+#include <gnuradio/tags.h>                    // for tag_t
 #include <gnuradio/types.h>                   // for gr_vector_int, gr_vector...
 #include <pmt/pmt.h>                          // for pmt_t
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstddef>                            // for size_t
 #include <cstdint>                            // for int32_t
 #include <fstream>                            // for ofstream
+#include <functional>                         // for function
+#include <memory>                             // for shared_ptr
 #include <string>                             // for string
 #include <typeinfo>                           // for typeid
 #include <utility>                            // for pair
+#include <vector>                             // for vector
 
 /** \addtogroup Tracking
  * \{ */
@@ -72,8 +77,13 @@ public:
 
 private:
     friend dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_);
+    friend class dll_pll_veml_tracking_bank;  // runs the tracking steps of banked channels
     explicit dll_pll_veml_tracking(const Dll_Pll_Conf &conf_);
 
+    bool track_step(const gr_complex *in, int32_t ninput_items, int32_t &consumed_samples,
+        Gnss_Synchro &current_synchro_data, bool &loss_of_lock);
+    void process_time_tags(const std::vector<gr::tag_t> &tags_vec);
+    bool set_synchro_output(Gnss_Synchro &current_synchro_data, bool loss_of_lock, std::shared_ptr<GnssTime> &timetag);
     void msg_handler_telemetry_to_trk(const pmt::pmt_t &msg);
     void do_correlation_step(const gr_complex *input_samples);
     void run_dll_pll();
@@ -86,6 +96,7 @@ private:
     bool acquire_secondary();
     int64_t uint64diff(uint64_t first, uint64_t second);
     int32_t save_matfile() const;
+    std::shared_ptr<const Tracking_Code_Cache::Code> local_code(bool pilot, const std::function<void(Tracking_Code_Cache::Code &)> &generate) const;
 
     Cpu_Multicorrelator_Real_Codes d_multicorrelator_cpu;
     Cpu_Multicorrelator_Real_Codes d_correlator_data_cpu;  // for data channel
@@ -100,8 +111,8 @@ private:
 
     Gnss_Synchro *d_acquisition_gnss_synchro;
 
-    volk_gnsssdr::vector<float> d_tracking_code;
-    volk_gnsssdr::vector<float> d_data_code;
+    std::shared_ptr<const Tracking_Code_Cache::Code> d_tracking_code;
+    std::shared_ptr<const Tracking_Code_Cache::Code> d_data_code;
     volk_gnsssdr::vector<float> d_local_code_shift_chips;
     volk_gnsssdr::vector<gr_complex> d_correlator_outs;
     volk_gnsssdr::vector<gr_complex> d_Prompt_Data;
@@ -165,7 +176,7 @@ private:
 
     std::ofstream d_dump_file;
 
-    // uint64_t d_sample_counter;
+    uint64_t d_sample_counter;
     uint64_t d_acq_sample_stamp;
     GnssTime d_last_timetag{};
     uint64_t d_last_timetag_samplecounter;
@@ -0,0 +1,173 @@
+/*!
+ * \file dll_pll_veml_tracking_bank.cc
+ * \brief GNU Radio block that runs the code DLL + carrier PLL tracking of
+ * several channels of the same signal over a shared input buffer.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "dll_pll_veml_tracking_bank.h"
+#include "gnss_synchro.h"
+#include <gnuradio/io_signature.h>   // for io_signature
+#include <gnuradio/thread/thread.h>  // for scoped_lock
+#include <pmt/pmt_sugar.h>           // for mp
+#include <algorithm>                 // for std::min, std::max, std::fill
+#include <memory>                    // for std::shared_ptr
+#include <utility>                   // for std::move
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+dll_pll_veml_tracking_bank_sptr dll_pll_veml_make_tracking_bank(uint32_t block_samples)
+{
+    return dll_pll_veml_tracking_bank_sptr(new dll_pll_veml_tracking_bank(block_samples));
+}
+
+
+dll_pll_veml_tracking_bank::dll_pll_veml_tracking_bank(uint32_t block_samples)
+    : gr::block("dll_pll_veml_tracking_bank", gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          gr::io_signature::make(1, -1, sizeof(Gnss_Synchro))),
+      d_block_samples(static_cast<int32_t>(block_samples)),
+      d_max_required_samples(1)
+{
+    // prevent telemetry symbols accumulation in output buffers
+    this->set_max_noutput_items(1);
+    set_tag_propagation_policy(TPP_DONT);  // time tags are adjusted and regenerated for each channel
+}
+
+
+std::string dll_pll_veml_tracking_bank::port_name(const std::string &name, int32_t port)
+{
+    return name + "_" + std::to_string(port);
+}
+
+
+int32_t dll_pll_veml_tracking_bank::add_channel(const dll_pll_veml_tracking_sptr &channel_tracking)
+{
+    const auto port = static_cast<int32_t>(d_channels.size());
+    d_channels.push_back(channel_tracking);
+    d_sample_counters.push_back(0ULL);
+    d_produced.push_back(0);
+
+    // the same input margin as the standalone block
+    const auto required_samples = static_cast<int32_t>(channel_tracking->d_trk_parameters.vector_length) * 2;
+    d_required_samples.push_back(required_samples);
+    d_max_required_samples = std::max(d_max_required_samples, required_samples);
+    if (d_block_samples <= 0)
+        {
+            d_block_samples = static_cast<int32_t>(channel_tracking->d_trk_parameters.vector_length);
+        }
+
+    d_events_ports.push_back(pmt::mp(port_name("events", port)));
+    this->message_port_register_out(d_events_ports.back());
+
+    const pmt::pmt_t telemetry_port = pmt::mp(port_name("telemetry_to_trk", port));
+    this->message_port_register_in(telemetry_port);
+    this->set_msg_handler(telemetry_port,
+        [channel_tracking](const pmt::pmt_t &msg) { channel_tracking->msg_handler_telemetry_to_trk(msg); });
+
+    LOG(INFO) << "Tracking of channel " << channel_tracking->d_channel << " assigned to port " << port << " of the tracking bank";
+    return port;
+}
+
+
+void dll_pll_veml_tracking_bank::forecast(int noutput_items,
+    gr_vector_int &ninput_items_required)
+{
+    if (noutput_items != 0)
+        {
+            // enough for a tracking step of the channel that lags behind
+            ninput_items_required[0] = d_max_required_samples;
+        }
+}
+
+
+int dll_pll_veml_tracking_bank::general_work(int noutput_items, gr_vector_int &ninput_items,
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
+    const uint64_t first_sample = this->nitems_read(0);
+    const int32_t available_samples = ninput_items[0];
+    const size_t nchannels = std::min(d_channels.size(), output_items.size());
+
+    const int32_t block_samples = std::max(d_block_samples, 1);
+    std::fill(d_produced.begin(), d_produced.end(), 0);
+    int32_t window_end = 0;
+    bool output_full = false;
+    while (window_end < available_samples && !output_full)
+        {
+            // Run all the tracking steps that fit in the current window
+            window_end = std::min(window_end + block_samples, available_samples);
+            for (size_t ch = 0; ch < nchannels; ch++)
+                {
+                    auto &trk = d_channels[ch];
+                    gr::thread::scoped_lock l(trk->d_setlock);
+                    while (d_produced[ch] < noutput_items)
+                        {
+                            const auto offset = static_cast<int32_t>(d_sample_counters[ch] - first_sample);
+                            if (available_samples - offset < d_required_samples[ch] || offset + trk->d_current_prn_length_samples > window_end)
+                                {
+                                    break;
+                                }
+                            Gnss_Synchro current_synchro_data = Gnss_Synchro();
+                            bool loss_of_lock = false;
+                            int32_t consumed_samples = 0;
+
+                            trk->d_sample_counter = d_sample_counters[ch];
+                            if (trk->track_step(in + offset, available_samples - offset, consumed_samples, current_synchro_data, loss_of_lock))
+                                {
+                                    // time tags
+                                    std::vector<gr::tag_t> tags_vec;
+                                    this->get_tags_in_range(tags_vec, 0, d_sample_counters[ch], d_sample_counters[ch] + trk->d_current_prn_length_samples);
+                                    trk->process_time_tags(tags_vec);
+                                }
+                            d_sample_counters[ch] += static_cast<uint64_t>(consumed_samples);
+
+                            std::shared_ptr<GnssTime> timetag;
+                            if (trk->set_synchro_output(current_synchro_data, loss_of_lock, timetag))
+                                {
+                                    if (loss_of_lock)
+                                        {
+                                            this->message_port_pub(d_events_ports[ch], pmt::from_long(3));  // 3 -> loss of lock
+                                        }
+                                    if (timetag)
+                                        {
+                                            add_item_tag(ch, this->nitems_written(ch) + d_produced[ch] + 1, pmt::mp("timetag"), pmt::make_any(timetag));
+                                        }
+                                    out[ch][d_produced[ch]] = std::move(current_synchro_data);
+                                    d_produced[ch]++;
+                                }
+                        }
+                    if (d_produced[ch] == noutput_items)
+                        {
+                            output_full = true;
+                        }
+                }
+        }
+
+    // Release the samples already processed by all the channels
+    int64_t consumed = available_samples;
+    for (size_t ch = 0; ch < nchannels; ch++)
+        {
+            consumed = std::min(consumed, static_cast<int64_t>(d_sample_counters[ch] - first_sample));
+        }
+    consume_each(static_cast<int>(consumed));
+    for (size_t ch = 0; ch < nchannels; ch++)
+        {
+            produce(static_cast<int>(ch), d_produced[ch]);
+        }
+    return this->WORK_CALLED_PRODUCE;
+}
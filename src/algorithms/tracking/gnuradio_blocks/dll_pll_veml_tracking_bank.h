@@ -0,0 +1,92 @@
+/*!
+ * \file dll_pll_veml_tracking_bank.h
+ * \brief GNU Radio block that runs the code DLL + carrier PLL tracking of
+ * several channels of the same signal over a shared input buffer.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_DLL_PLL_VEML_TRACKING_BANK_H
+#define GNSS_SDR_DLL_PLL_VEML_TRACKING_BANK_H
+
+#include "dll_pll_veml_tracking.h"
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>       // for block
+#include <gnuradio/gr_complex.h>  // for gr_complex
+#include <gnuradio/types.h>       // for gr_vector_int, gr_vector...
+#include <pmt/pmt.h>              // for pmt_t
+#include <cstdint>                // for int32_t, uint64_t
+#include <string>                 // for string
+#include <vector>                 // for vector
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_gnuradio_blocks
+ * \{ */
+
+
+class dll_pll_veml_tracking_bank;
+
+using dll_pll_veml_tracking_bank_sptr = gnss_shared_ptr<dll_pll_veml_tracking_bank>;
+
+dll_pll_veml_tracking_bank_sptr dll_pll_veml_make_tracking_bank(uint32_t block_samples);
+
+/*!
+ * \brief Runs the tracking state machine of several dll_pll_veml_tracking
+ * instances inside a single block.
+ *
+ * The input samples are walked in windows of block_samples samples, and all
+ * the correlation steps of every channel that fall inside a window are run
+ * before moving to the next one, so the window stays in cache while it is
+ * processed. Output port i delivers the Gnss_Synchro objects of the i-th
+ * added channel, and the message ports "telemetry_to_trk_<i>" and
+ * "events_<i>" replace the "telemetry_to_trk" and "events" ports of its
+ * tracking block. The banked tracking blocks must not be connected to the
+ * flow graph.
+ */
+class dll_pll_veml_tracking_bank : public gr::block
+{
+public:
+    ~dll_pll_veml_tracking_bank() override = default;
+
+    /*!
+     * \brief Adds a channel to the bank and returns its output port index.
+     * Must be called before the flow graph is started.
+     */
+    int32_t add_channel(const dll_pll_veml_tracking_sptr &channel_tracking);
+
+    /*!
+     * \brief Name of the message port of a banked channel.
+     */
+    static std::string port_name(const std::string &name, int32_t port);
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items, gr_vector_void_star &output_items) override;
+
+    void forecast(int noutput_items, gr_vector_int &ninput_items_required) override;
+
+private:
+    friend dll_pll_veml_tracking_bank_sptr dll_pll_veml_make_tracking_bank(uint32_t block_samples);
+    explicit dll_pll_veml_tracking_bank(uint32_t block_samples);
+
+    std::vector<dll_pll_veml_tracking_sptr> d_channels;
+    std::vector<pmt::pmt_t> d_events_ports;
+    std::vector<uint64_t> d_sample_counters;  // next sample to be processed by each channel
+    std::vector<int32_t> d_required_samples;  // minimum number of input samples for a tracking step
+    std::vector<int32_t> d_produced;
+    int32_t d_block_samples;
+    int32_t d_max_required_samples;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_DLL_PLL_VEML_TRACKING_BANK_H
@@ -55,6 +55,7 @@
 #include <iostream>   // for cout, cerr
 #include <map>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #if USE_GLOG_AND_GFLAGS
@@ -76,6 +77,7 @@ namespace wht = boost;
 namespace wht = std;
 #endif
 
+
 kf_tracking_sptr kf_make_tracking(const Kf_Conf &conf_)
 {
     return kf_tracking_sptr(new kf_tracking(conf_));
@@ -457,8 +459,7 @@ kf_tracking::kf_tracking(const Kf_Conf &conf_)
     d_beta = d_code_chip_rate / d_signal_carrier_freq;
 
     // Initialization of local code replica
-    // Get space for a vector with the sinboc(1,1) replica sampled 2x/chip
-    d_tracking_code.resize(2 * d_code_length_chips, 0.0);
+    // The replicas are shared with other channels through Tracking_Code_Cache, see start_tracking()
     // correlator outputs (scalar)
     if (d_veml)
         {
@@ -519,12 +520,13 @@ kf_tracking::kf_tracking(const Kf_Conf &conf_)
             // Extra correlator for the data component
             d_correlator_data_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
             d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
-            d_data_code.resize(2 * d_code_length_chips, 0.0);
+            d_correlator_data_cpu.set_fused_resampler(d_trk_parameters.fused_resampler);
         }
 
     // --- Initializations ---
     d_Prompt_circular_buffer.set_capacity(d_secondary_code_length);
     d_multicorrelator_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    d_multicorrelator_cpu.set_fused_resampler(d_trk_parameters.fused_resampler);
 
     // Initial code frequency basis of NCO
     d_code_freq_kf_chips_s = d_code_chip_rate;
@@ -650,6 +652,13 @@ void kf_tracking::msg_handler_pvt_to_trk(const pmt::pmt_t &msg)
 }
 
 
+std::shared_ptr<const Tracking_Code_Cache::Code> kf_tracking::local_code(bool pilot, const std::function<void(Tracking_Code_Cache::Code &)> &generate) const
+{
+    return Tracking_Code_Cache::instance().get_or_generate(Tracking_Code_Cache::make_key(*d_acquisition_gnss_synchro, pilot, static_cast<uint32_t>(d_code_samples_per_chip)),
+        static_cast<size_t>(d_code_samples_per_chip * d_code_length_chips), generate);
+}
+
+
 void kf_tracking::start_tracking()
 {
     gr::thread::scoped_lock l(d_setlock);
@@ -670,92 +679,76 @@ void kf_tracking::start_tracking()
 
     if (d_systemName == "GPS" and d_signal_type == "1C")
         {
-            gps_l1_ca_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l1_ca_code_gen_float(code, d_acquisition_gnss_synchro->PRN, 0); });
         }
     else if (d_systemName == "GPS" and d_signal_type == "2S")
         {
-            gps_l2c_m_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l2c_m_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
         }
     else if (d_systemName == "GPS" and d_signal_type == "L5")
         {
             if (d_trk_parameters.track_pilot)
                 {
-                    gps_l5q_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
-                    gps_l5i_code_gen_float(d_data_code, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) { gps_l5q_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
+                    d_data_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l5i_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    gps_l5i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { gps_l5i_code_gen_float(code, d_acquisition_gnss_synchro->PRN); });
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "1B")
         {
             if (d_trk_parameters.track_pilot)
                 {
-                    const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
-                    galileo_e1_code_gen_sinboc11_float(d_tracking_code, pilot_signal, d_acquisition_gnss_synchro->PRN);
-                    galileo_e1_code_gen_sinboc11_float(d_data_code, Signal_, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) {
+                        const std::array<char, 3> pilot_signal = {{'1', 'C', '\0'}};
+                        galileo_e1_code_gen_sinboc11_float(code, pilot_signal, d_acquisition_gnss_synchro->PRN);
+                    });
+                    d_data_code = local_code(false, [this, &Signal_](Tracking_Code_Cache::Code &code) { galileo_e1_code_gen_sinboc11_float(code, Signal_, d_acquisition_gnss_synchro->PRN); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    galileo_e1_code_gen_sinboc11_float(d_tracking_code, Signal_, d_acquisition_gnss_synchro->PRN);
+                    d_tracking_code = local_code(false, [this, &Signal_](Tracking_Code_Cache::Code &code) { galileo_e1_code_gen_sinboc11_float(code, Signal_, d_acquisition_gnss_synchro->PRN); });
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "5X")
         {
-            volk_gnsssdr::vector<gr_complex> aux_code(d_code_length_chips);
-            const std::array<char, 3> signal_type_ = {{'5', 'X', '\0'}};
-            galileo_e5_a_code_gen_complex_primary(aux_code, d_acquisition_gnss_synchro->PRN, signal_type_);
             if (d_trk_parameters.track_pilot)
                 {
                     d_secondary_code_string = GALILEO_E5A_Q_SECONDARY_CODE[d_acquisition_gnss_synchro->PRN - 1];
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].imag();
-                            d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5aI + E5aQ)
-                        }
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '5', true); });
+                    d_data_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '5', false); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].real();
-                        }
+                    d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '5', false); });
                 }
         }
     else if (d_systemName == "Galileo" and d_signal_type == "7X")
         {
-            volk_gnsssdr::vector<gr_complex> aux_code(d_code_length_chips);
-            const std::array<char, 3> signal_type_ = {{'7', 'X', '\0'}};
-            galileo_e5_b_code_gen_complex_primary(aux_code, d_acquisition_gnss_synchro->PRN, signal_type_);
             if (d_trk_parameters.track_pilot)
                 {
                     d_secondary_code_string = GALILEO_E5B_Q_SECONDARY_CODE[d_acquisition_gnss_synchro->PRN - 1];
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].imag();
-                            d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5bI + E5bsQ)
-                        }
+                    d_tracking_code = local_code(true, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '7', true); });
+                    d_data_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '7', false); });
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
+                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code->data(), d_prompt_data_shift);
                 }
             else
                 {
-                    for (int32_t i = 0; i < d_code_length_chips; i++)
-                        {
-                            d_tracking_code[i] = aux_code[i].real();
-                        }
+                    d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { galileo_e5_component_code_gen_float(code, d_acquisition_gnss_synchro->PRN, '7', false); });
                 }
         }
     else if (d_systemName == "Beidou" and d_signal_type == "B1")
         {
-            beidou_b1i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { beidou_b1i_code_gen_float(code, d_acquisition_gnss_synchro->PRN, 0); });
             // GEO Satellites use different secondary code
             if (d_acquisition_gnss_synchro->PRN > 0 and d_acquisition_gnss_synchro->PRN < 6)
                 {
@@ -788,7 +781,7 @@ void kf_tracking::start_tracking()
 
     else if (d_systemName == "Beidou" and d_signal_type == "B3")
         {
-            beidou_b3i_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN, 0);
+            d_tracking_code = local_code(false, [this](Tracking_Code_Cache::Code &code) { beidou_b3i_code_gen_float(code, d_acquisition_gnss_synchro->PRN, 0); });
             // Update secondary code settings for geo satellites
             if (d_acquisition_gnss_synchro->PRN > 0 and d_acquisition_gnss_synchro->PRN < 6)
                 {
@@ -819,7 +812,12 @@ void kf_tracking::start_tracking()
                 }
         }
 
-    d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+    if (!d_tracking_code)
+        {
+            // Unsupported signal: keep the all-zero replica of previous versions
+            d_tracking_code = local_code(false, [](Tracking_Code_Cache::Code & /*code*/) {});
+        }
+    d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code->data(), d_local_code_shift_chips.data());
     std::fill_n(d_correlator_outs.begin(), d_n_correlator_taps, gr_complex(0.0, 0.0));
 
     d_carrier_lock_fail_counter = 0;
@@ -869,38 +867,31 @@ void kf_tracking::init_kf(double acq_code_phase_chips, double acq_doppler_hz)
     const double Ti = d_current_correlation_time_s;
     const double TiTi = Ti * Ti;
 
-    d_F = {{1.0, 0.0, d_beta * Ti, d_beta * TiTi / 2.0},
-        {0.0, 1.0, 2.0 * GNSS_PI * Ti, GNSS_PI * TiTi},
-        {0.0, 0.0, 1.0, Ti},
-        {0.0, 0.0, 0.0, 1.0}};
+    d_kf.F = {{{{1.0, 0.0, d_beta * Ti, d_beta * TiTi / 2.0}},
+        {{0.0, 1.0, 2.0 * GNSS_PI * Ti, GNSS_PI * TiTi}},
+        {{0.0, 0.0, 1.0, Ti}},
+        {{0.0, 0.0, 0.0, 1.0}}}};
 
-    d_H = {{1.0, 0.0, -d_beta * Ti / 2.0, d_beta * TiTi / 6.0},
-        {0.0, 1.0, -GNSS_PI * Ti, GNSS_PI * TiTi / 3.0}};
+    d_kf.H = {{{{1.0, 0.0, -d_beta * Ti / 2.0, d_beta * TiTi / 6.0}},
+        {{0.0, 1.0, -GNSS_PI * Ti, GNSS_PI * TiTi / 3.0}}}};
 
-    d_R = {{pow(d_trk_parameters.code_disc_sd_chips, 2.0), 0.0},
-        {0.0, pow(d_trk_parameters.carrier_disc_sd_rads, 2.0)}};
+    d_kf.R = {{{{pow(d_trk_parameters.code_disc_sd_chips, 2.0), 0.0}},
+        {{0.0, pow(d_trk_parameters.carrier_disc_sd_rads, 2.0)}}}};
 
     // system covariance matrix (static)
-    d_Q = {{pow(d_trk_parameters.code_phase_sd_chips, 2.0), 0.0, 0.0, 0.0},
-        {0.0, pow(d_trk_parameters.carrier_phase_sd_rad, 2.0), 0.0, 0.0},
-        {0.0, 0.0, pow(d_trk_parameters.carrier_freq_sd_hz, 2.0), 0.0},
-        {0.0, 0.0, 0.0, pow(d_trk_parameters.carrier_freq_rate_sd_hz_s, 2.0)}};
+    d_kf.Q = {{{{pow(d_trk_parameters.code_phase_sd_chips, 2.0), 0.0, 0.0, 0.0}},
+        {{0.0, pow(d_trk_parameters.carrier_phase_sd_rad, 2.0), 0.0, 0.0}},
+        {{0.0, 0.0, pow(d_trk_parameters.carrier_freq_sd_hz, 2.0), 0.0}},
+        {{0.0, 0.0, 0.0, pow(d_trk_parameters.carrier_freq_rate_sd_hz_s, 2.0)}}}};
 
     // initial Kalman covariance matrix
-    d_P_old_old = {{pow(d_trk_parameters.init_code_phase_sd_chips, 2.0), 0.0, 0.0, 0.0},
-        {0.0, pow(d_trk_parameters.init_carrier_phase_sd_rad, 2.0), 0.0, 0.0},
-        {0.0, 0.0, pow(d_trk_parameters.init_carrier_freq_sd_hz, 2.0), 0.0},
-        {0.0, 0.0, 0.0, pow(d_trk_parameters.init_carrier_freq_rate_sd_hz_s, 2.0)}};
+    d_kf.P = {{{{pow(d_trk_parameters.init_code_phase_sd_chips, 2.0), 0.0, 0.0, 0.0}},
+        {{0.0, pow(d_trk_parameters.init_carrier_phase_sd_rad, 2.0), 0.0, 0.0}},
+        {{0.0, 0.0, pow(d_trk_parameters.init_carrier_freq_sd_hz, 2.0), 0.0}},
+        {{0.0, 0.0, 0.0, pow(d_trk_parameters.init_carrier_freq_rate_sd_hz_s, 2.0)}}}};
 
     // states: code_phase_chips, carrier_phase_rads, carrier_freq_hz, carrier_freq_rate_hz_s
-    d_x_old_old = {acq_code_phase_chips, 0.0, acq_doppler_hz, 0.0};
-
-    DLOG(INFO) << "F: " << d_F;
-    DLOG(INFO) << "H: " << d_H;
-    DLOG(INFO) << "R: " << d_R;
-    DLOG(INFO) << "Q: " << d_Q;
-    DLOG(INFO) << "P: " << d_P_old_old;
-    DLOG(INFO) << "x: " << d_x_old_old;
+    d_kf.x = {{acq_code_phase_chips, 0.0, acq_doppler_hz, 0.0}};
 }
 
 
@@ -910,37 +901,36 @@ void kf_tracking::update_kf_narrow_integration_time()
     const double Ti = d_current_correlation_time_s;
     const double TiTi = Ti * Ti;
 
-    arma::mat Qnew = arma::zeros(4, 4);
+    Fixed_Kalman_Filter<4, 2>::Matrix_XX Qnew{};
     for (int i = 0; i < d_trk_parameters.extend_correlation_symbols; i++)
         {
-            Qnew += d_F * d_Q * d_F.t();
-            d_Q = d_F * d_Q * d_F.t();
+            d_kf.Q = d_kf.propagate(d_kf.Q);
+            for (int r = 0; r < 4; r++)
+                {
+                    for (int c = 0; c < 4; c++)
+                        {
+                            Qnew[r][c] += d_kf.Q[r][c];
+                        }
+                }
         }
-    d_Q = std::move(Qnew);
+    d_kf.Q = Qnew;
 
     // state vector: code_phase_chips, carrier_phase_rads, carrier_freq_hz, carrier_freq_rate_hz
-    d_F = {{1.0, 0.0, d_beta * Ti, d_beta * TiTi / 2.0},
-        {0.0, 1.0, 2.0 * GNSS_PI * Ti, GNSS_PI * TiTi},
-        {0.0, 0.0, 1.0, Ti},
-        {0.0, 0.0, 0.0, 1.0}};
+    d_kf.F = {{{{1.0, 0.0, d_beta * Ti, d_beta * TiTi / 2.0}},
+        {{0.0, 1.0, 2.0 * GNSS_PI * Ti, GNSS_PI * TiTi}},
+        {{0.0, 0.0, 1.0, Ti}},
+        {{0.0, 0.0, 0.0, 1.0}}}};
 
-    d_H = {{1.0, 0.0, -d_beta * Ti / 2.0, d_beta * TiTi / 6.0},
-        {0.0, 1.0, -GNSS_PI * Ti, GNSS_PI * TiTi / 3.0}};
+    d_kf.H = {{{{1.0, 0.0, -d_beta * Ti / 2.0, d_beta * TiTi / 6.0}},
+        {{0.0, 1.0, -GNSS_PI * Ti, GNSS_PI * TiTi / 3.0}}}};
 
     const double CN0_lin = pow(10.0, d_CN0_SNV_dB_Hz / 10.0);  // CN0 in Hz
     const double CN0_lin_Ti = CN0_lin * Ti;
     const double Sigma2_Phase = (1.0 / (2.0 * CN0_lin_Ti)) * (1.0 + 1.0 / (2.0 * CN0_lin_Ti));
     const double Sigma2_Tau = (1.0 / CN0_lin_Ti) * (d_trk_parameters.spc + (d_trk_parameters.spc / (1.0 - d_trk_parameters.spc)) * (1.0 / (2.0 * CN0_lin_Ti)));
 
-    d_R = {{Sigma2_Tau, 0.0},
-        {0.0, Sigma2_Phase}};
-
-    DLOG(INFO) << "Fu: " << d_F;
-    DLOG(INFO) << "Hu: " << d_H;
-    DLOG(INFO) << "Ru: " << d_R;
-    DLOG(INFO) << "Qu: " << d_Q;
-    DLOG(INFO) << "Pu: " << d_P_old_old;
-    DLOG(INFO) << "xu: " << d_x_old_old;
+    d_kf.R = {{{{Sigma2_Tau, 0.0}},
+        {{0.0, Sigma2_Phase}}}};
 }
 
 
@@ -950,8 +940,8 @@ void kf_tracking::update_kf_cn0(double current_cn0_dbhz)
     const double Ti = d_current_correlation_time_s;  // d_correlation_length_ms * 0.001;
     const double TiTi = Ti * Ti;
 
-    d_H = {{1.0, 0.0, -d_beta * Ti / 2.0, d_beta * TiTi / 6.0},
-        {0.0, 1.0, -GNSS_PI * Ti, GNSS_PI * TiTi / 3.0}};
+    d_kf.H = {{{{1.0, 0.0, -d_beta * Ti / 2.0, d_beta * TiTi / 6.0}},
+        {{0.0, 1.0, -GNSS_PI * Ti, GNSS_PI * TiTi / 3.0}}}};
 
     // Phase noise variance
     const double CN0_lin = pow(10.0, current_cn0_dbhz / 10.0);  // CN0 in Hz
@@ -959,8 +949,8 @@ void kf_tracking::update_kf_cn0(double current_cn0_dbhz)
     const double Sigma2_Phase = (1.0 / (2.0 * CN0_lin_Ti)) * (1.0 + 1.0 / (2.0 * CN0_lin_Ti));
     const double Sigma2_Tau = (1.0 / CN0_lin_Ti) * (d_trk_parameters.spc + (d_trk_parameters.spc / (1.0 - d_trk_parameters.spc)) * (1.0 / (2.0 * CN0_lin_Ti)));
 
-    d_R = {{Sigma2_Tau, 0.0},
-        {0.0, Sigma2_Phase}};
+    d_kf.R = {{{{Sigma2_Tau, 0.0}},
+        {{0.0, Sigma2_Phase}}}};
 }
 
 
@@ -1162,33 +1152,29 @@ void kf_tracking::run_Kf()
     //  Kalman loop
 
     // Prediction
-    d_x_new_old = d_F * d_x_old_old;
+    d_kf.predict();
 
-    d_P_new_old = d_F * d_P_old_old * d_F.t() + d_Q;
-
-    // Measurement update
-    arma::vec z = {d_code_error_disc_chips, d_carr_phase_error_disc_hz * TWO_PI};
-    arma::mat K = d_P_new_old * d_H.t() * arma::inv(d_H * d_P_new_old * d_H.t() + d_R);  // Kalman gain
-
-    d_x_new_new = d_x_new_old + K * z;
-
-    d_P_new_new = (arma::eye(4, 4) - K * d_H) * d_P_new_old;
+    // Measurement update. The discriminator outputs are already the innovation.
+    if (!d_kf.update_innovation({{d_code_error_disc_chips, d_carr_phase_error_disc_hz * TWO_PI}}))
+        {
+            DLOG(INFO) << "Singular innovation covariance in channel " << d_channel << ", skipping the measurement update";
+        }
 
     // new code phase estimation
-    d_code_error_kf_chips = d_x_new_new(0);
-    d_x_new_new(0) = 0;  // reset error estimation because the NCO corrects the code phase
+    d_code_error_kf_chips = d_kf.x[0];
+    d_kf.x[0] = 0;  // reset error estimation because the NCO corrects the code phase
 
     // new carrier phase estimation
-    d_carrier_phase_kf_rad = d_x_new_new(1);
+    d_carrier_phase_kf_rad = d_kf.x[1];
 
     // New carrier Doppler frequency estimation
-    d_carrier_doppler_kf_hz = d_x_new_new(2);
+    d_carrier_doppler_kf_hz = d_kf.x[2];
 
     // d_carr_freq_error_hz = fll_four_quadrant_atan(d_P_accu_old, d_P_accu, 0, d_current_correlation_time_s) / TWO_PI;
     // d_x_new_new(2) = d_x_new_new(2) + fll_four_quadrant_atan(d_P_accu_old, d_P_accu, 0, d_current_correlation_time_s) / TWO_PI;
     d_P_accu_old = d_P_accu;
 
-    d_carrier_doppler_rate_kf_hz_s = d_x_new_new(3);
+    d_carrier_doppler_rate_kf_hz_s = d_kf.x[3];
 
     // New code Doppler frequency estimation
     d_code_freq_kf_chips_s = d_code_chip_rate + d_carrier_doppler_kf_hz * d_code_chip_rate / d_signal_carrier_freq;
@@ -1206,10 +1192,6 @@ void kf_tracking::run_Kf()
     // correct code and carrier phase
     d_rem_code_phase_samples += d_trk_parameters.fs_in * d_code_error_kf_chips / d_code_freq_kf_chips_s;
     d_rem_carr_phase_rad = d_carrier_phase_kf_rad;
-
-    // prepare data for next KF epoch
-    d_x_old_old = d_x_new_new;
-    d_P_old_old = d_P_new_new;
 }
 
 
@@ -1281,7 +1263,7 @@ void kf_tracking::update_tracking_vars()
                     tmp_cp1 /= static_cast<double>(d_trk_parameters.smoother_length);
                     tmp_cp2 /= static_cast<double>(d_trk_parameters.smoother_length);
                     d_carrier_phase_rate_step_rad = (tmp_cp2 - tmp_cp1) / tmp_samples;
-                    d_x_old_old(3) = d_carrier_phase_rate_step_rad * d_trk_parameters.fs_in / TWO_PI;
+                    d_kf.x[3] = d_carrier_phase_rate_step_rad * d_trk_parameters.fs_in / TWO_PI;
                 }
         }
     // remnant carrier phase to prevent overflow in the code NCO
@@ -1505,7 +1487,7 @@ void kf_tracking::log_data()
                     // Carrier estimation
                     tmp_float = static_cast<float>(d_carr_phase_error_disc_hz);
                     d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_x_new_new(2));
+                    tmp_float = static_cast<float>(d_kf.x[2]);
                     d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
                     // code estimation
                     tmp_float = static_cast<float>(d_code_error_disc_chips);
@@ -21,18 +21,15 @@
 #ifndef GNSS_SDR_KF_TRACKING_H
 #define GNSS_SDR_KF_TRACKING_H
 
-#if ARMA_NO_BOUND_CHECKING
-#define ARMA_NO_DEBUG 1
-#endif
-
 #include "cpu_multicorrelator_real_codes.h"
 #include "exponential_smoother.h"
+#include "fixed_kalman_filter.h"
 #include "gnss_block_interface.h"
 #include "gnss_time.h"  // for timetags produced by File_Timestamp_Signal_Source
 #include "kf_conf.h"
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
+#include "tracking_code_cache.h"
 #include "tracking_loop_filter.h"     // for DLL filter
-#include <armadillo>
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>                   // for block
 #include <gnuradio/gr_complex.h>              // for gr_complex
@@ -42,6 +39,7 @@
 #include <cstddef>                            // for size_t
 #include <cstdint>                            // for int32_t
 #include <fstream>                            // for ofstream
+#include <functional>                         // for function
 #include <memory>
 #include <string>    // for string
 #include <typeinfo>  // for typeid
@@ -93,6 +91,7 @@ private:
     bool cn0_and_tracking_lock_status(double coh_integration_time_s);
     bool acquire_secondary();
     int32_t save_matfile() const;
+    std::shared_ptr<const Tracking_Code_Cache::Code> local_code(bool pilot, const std::function<void(Tracking_Code_Cache::Code &)> &generate) const;
 
     Cpu_Multicorrelator_Real_Codes d_multicorrelator_cpu;
     Cpu_Multicorrelator_Real_Codes d_correlator_data_cpu;  // for data channel
@@ -104,8 +103,8 @@ private:
 
     Gnss_Synchro *d_acquisition_gnss_synchro;
 
-    volk_gnsssdr::vector<float> d_tracking_code;
-    volk_gnsssdr::vector<float> d_data_code;
+    std::shared_ptr<const Tracking_Code_Cache::Code> d_tracking_code;
+    std::shared_ptr<const Tracking_Code_Cache::Code> d_data_code;
     volk_gnsssdr::vector<float> d_local_code_shift_chips;
     volk_gnsssdr::vector<gr_complex> d_correlator_outs;
     volk_gnsssdr::vector<gr_complex> d_Prompt_Data;
@@ -117,17 +116,10 @@ private:
 
     const size_t d_int_type_hash_code = typeid(int).hash_code();
 
-    // Kalman Filter class variables
-    arma::mat d_F;
-    arma::mat d_H;
-    arma::mat d_R;
-    arma::mat d_Q;
-    arma::mat d_P_old_old;
-    arma::mat d_P_new_old;
-    arma::mat d_P_new_new;
-    arma::vec d_x_old_old;
-    arma::vec d_x_new_old;
-    arma::vec d_x_new_new;
+    // Kalman Filter: state {code phase error [chips], carrier phase error [rad],
+    // carrier Doppler [Hz], carrier Doppler rate [Hz/s]}, measurements
+    // {code discriminator [chips], carrier phase discriminator [rad]}
+    Fixed_Kalman_Filter<4, 2> d_kf;
 
     std::string d_secondary_code_string;
     std::string d_data_secondary_code_string;
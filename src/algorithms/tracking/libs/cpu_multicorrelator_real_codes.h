@@ -39,6 +39,14 @@ class Cpu_Multicorrelator_Real_Codes
 public:
     Cpu_Multicorrelator_Real_Codes() = default;
     void set_high_dynamics_resampler(bool use_high_dynamics_resampler);
+
+    /*!
+     * \brief Computes the code chip indexes inside the correlation loop
+     * instead of storing a resampled code replica per tap, which saves memory
+     * bandwidth at high sampling rates. The high dynamics resampler takes
+     * precedence over this mode.
+     */
+    void set_fused_resampler(bool use_fused_resampler);
     ~Cpu_Multicorrelator_Real_Codes();
     bool init(int max_signal_length_samples, int n_correlators);
     bool set_local_code_and_taps(int code_length_chips, const float *local_code_in, float *shifts_chips);
@@ -58,6 +66,7 @@ private:
     int d_code_length_chips{0};
     int d_n_correlators{0};
     bool d_use_high_dynamics_resampler{true};
+    bool d_use_fused_resampler{false};
 };
 
 
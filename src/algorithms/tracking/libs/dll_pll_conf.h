@@ -78,6 +78,7 @@ public:
     bool enable_doppler_correction{false};
     bool carrier_aiding{true};
     bool high_dyn{false};
+    bool fused_resampler{false};
     bool dump{false};
     bool dump_mat{true};
 };
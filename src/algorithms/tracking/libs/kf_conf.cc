@@ -80,6 +80,7 @@ Kf_Conf::Kf_Conf() : item_type("gr_complex"),
                      track_pilot(true),
                      enable_doppler_correction(false),
                      high_dyn(false),
+                     fused_resampler(false),
                      dump(false),
                      dump_mat(true)
 {
@@ -102,6 +103,7 @@ void Kf_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
     double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", fs_in);
     fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
     high_dyn = configuration->property(role + ".high_dyn", high_dyn);
+    fused_resampler = configuration->property(role + ".fused_resampler", fused_resampler);
     dump = configuration->property(role + ".dump", dump);
     dump_filename = configuration->property(role + ".dump_filename", dump_filename);
     dump_mat = configuration->property(role + ".dump_mat", dump_mat);
@@ -79,6 +79,7 @@ public:
     bool track_pilot;
     bool enable_doppler_correction;
     bool high_dyn;
+    bool fused_resampler;
     bool dump;
     bool dump_mat;
 };
@@ -0,0 +1,122 @@
+/*!
+ * \file tracking_code_cache.cc
+ * \brief Process-wide, thread-safe cache of the local code replicas used by
+ * the tracking blocks.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tracking_code_cache.h"
+#include "gnss_synchro.h"
+#include <utility>
+
+
+Tracking_Code_Cache& Tracking_Code_Cache::instance()
+{
+    static Tracking_Code_Cache cache;
+    return cache;
+}
+
+
+Tracking_Code_Cache::Key Tracking_Code_Cache::make_key(const Gnss_Synchro& gnss_synchro, bool pilot, uint32_t samples_per_chip)
+{
+    Key key;
+    key.system = gnss_synchro.System;
+    key.signal[0] = gnss_synchro.Signal[0];
+    key.signal[1] = gnss_synchro.Signal[1];
+    key.prn = gnss_synchro.PRN;
+    key.pilot = pilot;
+    key.samples_per_chip = samples_per_chip;
+    return key;
+}
+
+
+std::shared_ptr<const Tracking_Code_Cache::Code> Tracking_Code_Cache::get_or_generate(const Key& key, size_t length, const std::function<void(Code&)>& generate)
+{
+    auto code = find(key);
+    if (!code)
+        {
+            // generated without holding the lock, so that channels starting
+            // on other satellites do not wait for it
+            auto new_code = std::make_shared<Code>(length, 0.0F);
+            generate(*new_code);
+            code = insert(key, std::move(new_code));
+        }
+    return code;
+}
+
+
+std::shared_ptr<const Tracking_Code_Cache::Code> Tracking_Code_Cache::find(const Key& key)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const auto it = d_entries.find(key);
+    if (it == d_entries.end())
+        {
+            d_misses++;
+            return nullptr;
+        }
+    d_hits++;
+    return it->second;
+}
+
+
+std::shared_ptr<const Tracking_Code_Cache::Code> Tracking_Code_Cache::insert(const Key& key, std::shared_ptr<const Code> code)
+{
+    if (!code)
+        {
+            return nullptr;
+        }
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const auto inserted = d_entries.emplace(key, std::move(code));
+    if (inserted.second)
+        {
+            d_bytes += inserted.first->second->size() * sizeof(float);
+        }
+    return inserted.first->second;
+}
+
+
+void Tracking_Code_Cache::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_entries.clear();
+    d_bytes = 0;
+    d_hits = 0;
+    d_misses = 0;
+}
+
+
+size_t Tracking_Code_Cache::size_bytes() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_bytes;
+}
+
+
+size_t Tracking_Code_Cache::entries() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_entries.size();
+}
+
+
+uint64_t Tracking_Code_Cache::hits() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_hits;
+}
+
+
+uint64_t Tracking_Code_Cache::misses() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_misses;
+}
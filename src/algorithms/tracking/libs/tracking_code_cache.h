@@ -0,0 +1,122 @@
+/*!
+ * \file tracking_code_cache.h
+ * \brief Process-wide, thread-safe cache of the local code replicas used by
+ * the tracking blocks.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TRACKING_CODE_CACHE_H
+#define GNSS_SDR_TRACKING_CODE_CACHE_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+class Gnss_Synchro;
+
+/** \addtogroup Tracking
+ * \{ */
+/** \addtogroup Tracking_libs
+ * \{ */
+
+
+/*!
+ * \brief Code replicas (one period of the primary code, sampled at an integer
+ * number of samples per chip), shared by all the tracking channels of the
+ * receiver.
+ *
+ * Entries are immutable and reference-counted, so channels tracking the same
+ * satellite use the same buffer, and a channel that restarts tracking a
+ * satellite already tracked by another one does not generate its code again.
+ * There is at most one entry per satellite and code component of the
+ * configured signals, so the cache is never evicted.
+ */
+class Tracking_Code_Cache
+{
+public:
+    using Code = volk_gnsssdr::vector<float>;
+
+    /*!
+     * \brief Identifies a code replica
+     */
+    struct Key
+    {
+        char system{'\0'};
+        char signal[2]{'\0', '\0'};
+        uint32_t prn{0};
+        bool pilot{false};  // pilot or data component
+        uint32_t samples_per_chip{1};
+
+        bool operator<(const Key& other) const
+        {
+            return std::tie(system, signal[0], signal[1], prn, pilot, samples_per_chip) <
+                   std::tie(other.system, other.signal[0], other.signal[1], other.prn, other.pilot, other.samples_per_chip);
+        }
+    };
+
+    /*!
+     * \brief Returns the receiver-wide instance.
+     */
+    static Tracking_Code_Cache& instance();
+
+    /*!
+     * \brief Key of the code of the satellite and signal in gnss_synchro
+     */
+    static Key make_key(const Gnss_Synchro& gnss_synchro, bool pilot, uint32_t samples_per_chip);
+
+    /*!
+     * \brief Returns the cached code for key. On a miss, a zero-filled code
+     * of length samples is passed to generate and then stored.
+     */
+    std::shared_ptr<const Code> get_or_generate(const Key& key, size_t length, const std::function<void(Code&)>& generate);
+
+    /*!
+     * \brief Returns the cached code for key, or nullptr if not present.
+     */
+    std::shared_ptr<const Code> find(const Key& key);
+
+    /*!
+     * \brief Stores a code and returns the cached one. If another channel
+     * stored a code for the same key in the meantime, that one is kept and
+     * returned instead.
+     */
+    std::shared_ptr<const Code> insert(const Key& key, std::shared_ptr<const Code> code);
+
+    /*!
+     * \brief Removes all the entries.
+     */
+    void clear();
+
+    size_t size_bytes() const;
+    size_t entries() const;
+    uint64_t hits() const;
+    uint64_t misses() const;
+
+private:
+    Tracking_Code_Cache() = default;
+
+    std::map<Key, std::shared_ptr<const Code>> d_entries;
+    mutable std::mutex d_mutex;
+    size_t d_bytes{0};
+    uint64_t d_hits{0};
+    uint64_t d_misses{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_TRACKING_CODE_CACHE_H
@@ -22,6 +22,7 @@
 #include "nav_message_udp_sink.h"
 #include <gnuradio/block.h>
 #include <pmt/pmt.h>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -36,7 +37,7 @@ class nav_message_monitor;
 
 using nav_message_monitor_sptr = gnss_shared_ptr<nav_message_monitor>;
 
-nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port);
+nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port, size_t queue_size = 0);
 
 /*!
  * \brief GNU Radio block that receives asynchronous Nav_Message_Packet obkects
@@ -48,8 +49,8 @@ public:
     ~nav_message_monitor() = default;  //!< Default destructor
 
 private:
-    friend nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port);
-    nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port);
+    friend nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port, size_t queue_size);
+    nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port, size_t queue_size);
     void msg_handler_nav_message(const pmt::pmt_t& msg);
     std::unique_ptr<Nav_Message_Udp_Sink> nav_message_udp_sink_;
 };
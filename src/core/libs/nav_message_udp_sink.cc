@@ -16,55 +16,18 @@
  */
 
 #include "nav_message_udp_sink.h"
-#include <iostream>
-#include <sstream>
-#if USE_GLOG_AND_GFLAGS
-#include <glog/logging.h>
-#else
-#include <absl/log/log.h>
-#endif
+#include <utility>
 
 
-Nav_Message_Udp_Sink::Nav_Message_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port)
-    : socket{io_context}
+Nav_Message_Udp_Sink::Nav_Message_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, size_t queue_size)
+    : sender(addresses, port, queue_size)
 {
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
-    serdes_nav = Serdes_Nav_Message();
 }
 
 
 bool Nav_Message_Udp_Sink::write_nav_message(const std::shared_ptr<Nav_Message_Packet>& nav_meg_packet)
 {
-    std::string outbound_data = serdes_nav.createProtobuffer(nav_meg_packet);
-
-    try
-        {
-            for (const auto& endpoint : endpoints)
-                {
-                    socket.open(endpoint.protocol(), error);  // NOLINT(bugprone-unused-return-value)
-                    socket.connect(endpoint, error);          // NOLINT(bugprone-unused-return-value)
-                    if (error)
-                        {
-                            LOG(WARNING) << "Error connecting to IP address " << endpoint.address()
-                                         << ", port " << static_cast<int>(endpoint.port()) << ": " << error.message();
-                            return false;
-                        }
-
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)  // this can throw
-                        {
-                            return false;
-                        }
-                }
-        }
-    catch (const boost::system::system_error& e)
-        {
-            std::cerr << "Error sending navigation data: " << e.what() << '\n';
-            return false;
-        }
-
-    return true;
+    std::string outbound_data = sender.get_buffer();
+    serdes_nav.appendProtobuffer(nav_meg_packet, outbound_data);
+    return sender.send(std::move(outbound_data));
 }
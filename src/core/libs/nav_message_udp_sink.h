@@ -20,7 +20,9 @@
 
 #include "nav_message_packet.h"
 #include "serdes_nav_message.h"
-#include <boost/asio.hpp>
+#include "udp_datagram_sender.h"
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,24 +32,15 @@
 /** \addtogroup Core_Receiver_Library
  * \{ */
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 class Nav_Message_Udp_Sink
 {
 public:
-    Nav_Message_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port);
+    Nav_Message_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, size_t queue_size = 0);
     bool write_nav_message(const std::shared_ptr<Nav_Message_Packet>& nav_meg_packet);
 
 private:
     Serdes_Nav_Message serdes_nav;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
-    boost::system::error_code error;
+    Udp_Datagram_Sender sender;
 };
 
 
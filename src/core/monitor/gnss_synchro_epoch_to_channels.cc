@@ -0,0 +1,51 @@
+/*!
+ * \file gnss_synchro_epoch_to_channels.cc
+ * \brief Implementation of a block that splits the Gnss_Synchro_Epoch records
+ * delivered by the Observables block into one Gnss_Synchro stream per channel.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_epoch_to_channels.h"
+#include "gnss_synchro.h"
+#include "gnss_synchro_epoch.h"
+#include <gnuradio/io_signature.h>
+
+
+gnss_synchro_epoch_to_channels_sptr gnss_synchro_epoch_make_to_channels(uint32_t n_channels)
+{
+    return gnss_synchro_epoch_to_channels_sptr(new gnss_synchro_epoch_to_channels(n_channels));
+}
+
+
+gnss_synchro_epoch_to_channels::gnss_synchro_epoch_to_channels(uint32_t n_channels)
+    : gr::sync_block("gnss_synchro_epoch_to_channels",
+          gr::io_signature::make(1, 1, sizeof(Gnss_Synchro_Epoch)),
+          gr::io_signature::make(static_cast<int>(n_channels), static_cast<int>(n_channels), sizeof(Gnss_Synchro))),
+      d_nchannels(n_channels)
+{
+}
+
+
+int gnss_synchro_epoch_to_channels::work(int noutput_items, gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items)
+{
+    const auto* in = reinterpret_cast<const Gnss_Synchro_Epoch*>(input_items[0]);
+    auto** out = reinterpret_cast<Gnss_Synchro**>(&output_items[0]);
+    for (int i = 0; i < noutput_items; i++)
+        {
+            for (uint32_t ch = 0; ch < d_nchannels; ch++)
+                {
+                    in[i].get(ch, out[ch][i]);
+                }
+        }
+    return noutput_items;
+}
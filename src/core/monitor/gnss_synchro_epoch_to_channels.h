@@ -0,0 +1,63 @@
+/*!
+ * \file gnss_synchro_epoch_to_channels.h
+ * \brief Interface of a block that splits the Gnss_Synchro_Epoch records
+ * delivered by the Observables block into one Gnss_Synchro stream per channel.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_EPOCH_TO_CHANNELS_H
+#define GNSS_SDR_GNSS_SYNCHRO_EPOCH_TO_CHANNELS_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/runtime_types.h>  // for gr_vector_void_star
+#include <gnuradio/sync_block.h>
+#include <cstdint>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+class gnss_synchro_epoch_to_channels;
+
+using gnss_synchro_epoch_to_channels_sptr = gnss_shared_ptr<gnss_synchro_epoch_to_channels>;
+
+gnss_synchro_epoch_to_channels_sptr gnss_synchro_epoch_make_to_channels(uint32_t n_channels);
+
+/*!
+ * \brief This class implements a block that converts each Gnss_Synchro_Epoch
+ * record into one Gnss_Synchro object per channel, as the Observables block
+ * used to deliver them, so that the blocks working with per-channel streams
+ * (e.g., the Gnss_Synchro monitor) can be fed from the Observables output.
+ * Channels without observation get an empty Gnss_Synchro object with their
+ * Channel_ID.
+ */
+class gnss_synchro_epoch_to_channels : public gr::sync_block
+{
+public:
+    ~gnss_synchro_epoch_to_channels() = default;  //!< Default destructor
+    int work(int noutput_items, gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+private:
+    friend gnss_synchro_epoch_to_channels_sptr gnss_synchro_epoch_make_to_channels(uint32_t n_channels);
+
+    explicit gnss_synchro_epoch_to_channels(uint32_t n_channels);
+
+    uint32_t d_nchannels;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_EPOCH_TO_CHANNELS_H
@@ -24,6 +24,7 @@
 #include "gnss_synchro_udp_sink.h"
 #include <gnuradio/block.h>
 #include <gnuradio/runtime_types.h>  // for gr_vector_void_star
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,7 +44,8 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf);
+    bool enable_protobuf,
+    size_t udp_queue_size = 0);
 
 /*!
  * \brief This class implements a monitoring block which allows sending
@@ -63,14 +65,17 @@ private:
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        size_t udp_queue_size);
 
     gnss_synchro_monitor(int n_channels,
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        size_t udp_queue_size);
 
+    std::vector<Gnss_Synchro> d_stocks;
     int d_nchannels;
     int d_decimation_factor;
     std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
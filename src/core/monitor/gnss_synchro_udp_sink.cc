@@ -18,59 +18,33 @@
 #include "gnss_synchro_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/vector.hpp>
-#include <iostream>
-#include <sstream>
+#include <ostream>
+#include <utility>
 
 Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses,
     const uint16_t& port,
-    bool enable_protobuf)
-    : socket{io_context},
+    bool enable_protobuf,
+    size_t queue_size)
+    : sender(addresses, port, queue_size),
       use_protobuf(enable_protobuf)
 {
-    if (enable_protobuf)
-        {
-            serdes = Serdes_Gnss_Synchro();
-        }
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
 }
 
 
 bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
 {
-    std::string outbound_data;
+    std::string outbound_data = sender.get_buffer();
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
+            String_Append_Streambuf archive_buffer(outbound_data);
+            std::ostream archive_stream(&archive_buffer);
             boost::archive::binary_oarchive oa{archive_stream};
             oa << stocks;
-            outbound_data = archive_stream.str();
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(stocks);
-        }
-
-    try
-        {
-            for (const auto& endpoint : endpoints)
-                {
-                    socket.open(endpoint.protocol(), error);  // NOLINT(bugprone-unused-return-value)
-
-                    if (socket.send_to(boost::asio::buffer(outbound_data), endpoint) == 0)  // this can throw
-                        {
-                            return false;
-                        }
-                }
-        }
-    catch (const boost::system::system_error& e)
-        {
-            std::cerr << "Error sending data: " << e.what() << '\n';
-            return false;
+            serdes.appendProtobuffer(stocks, outbound_data);
         }
 
-    return true;
+    return sender.send(std::move(outbound_data));
 }
@@ -20,8 +20,8 @@
 
 #include "gnss_synchro.h"
 #include "serdes_gnss_synchro.h"
-#include <boost/asio.hpp>
-#include <boost/system/error_code.hpp>
+#include "udp_datagram_sender.h"
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -31,28 +31,21 @@
 /** \addtogroup Gnss_Synchro_Monitor
  * \{ */
 
-
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 /*!
  * \brief This class sends serialized Gnss_Synchro objects
  * over UDP to one or multiple endpoints.
+ *
+ * If queue_size is greater than zero, the datagrams are sent from a
+ * background thread through a queue of up to queue_size datagrams.
  */
 class Gnss_Synchro_Udp_Sink
 {
 public:
-    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf);
+    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf, size_t queue_size = 0);
     bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
 
 private:
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    boost::system::error_code error;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    Udp_Datagram_Sender sender;
     Serdes_Gnss_Synchro serdes;
     bool use_protobuf;
 };
@@ -0,0 +1,299 @@
+/*!
+ * \file udp_datagram_sender.cc
+ * \brief Sends datagrams over UDP to one or multiple endpoints through
+ * persistent sockets, optionally from a dedicated sender thread.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_datagram_sender.h"
+#include <boost/system/error_code.hpp>
+#include <algorithm>  // for std::min, std::max
+#include <utility>    // for std::move
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>  // for std::strerror
+#endif
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/log/log.h>
+#endif
+
+
+namespace
+{
+#if defined(__linux__)
+constexpr size_t MAX_MESSAGES_PER_CALL = 64;  // well below UIO_MAXIOV
+#endif
+}  // namespace
+
+
+Udp_Datagram_Sender::Udp_Datagram_Sender(const std::vector<std::string>& addresses,
+    uint16_t port,
+    size_t queue_size)
+    : d_socket_v4{d_io_context},
+      d_socket_v6{d_io_context},
+      d_capacity(queue_size)
+{
+    std::vector<boost::asio::ip::udp::endpoint> endpoints_v4;
+    std::vector<boost::asio::ip::udp::endpoint> endpoints_v6;
+    for (const auto& address : addresses)
+        {
+            boost::system::error_code error;
+            const auto ip_address = boost::asio::ip::address::from_string(address, error);
+            if (error)
+                {
+                    LOG(WARNING) << "Invalid UDP monitor address " << address << ": " << error.message();
+                    continue;
+                }
+            if (ip_address.is_v4())
+                {
+                    endpoints_v4.emplace_back(ip_address, port);
+                }
+            else
+                {
+                    endpoints_v6.emplace_back(ip_address, port);
+                }
+        }
+
+    const auto add_destination = [this](boost::asio::ip::udp::socket& socket,
+                                     const boost::asio::ip::udp& protocol,
+                                     std::vector<boost::asio::ip::udp::endpoint>& endpoints) {
+        if (endpoints.empty())
+            {
+                return;
+            }
+        boost::system::error_code error;
+        socket.open(protocol, error);  // NOLINT(bugprone-unused-return-value)
+        if (error)
+            {
+                LOG(WARNING) << "Error opening UDP socket: " << error.message();
+                return;
+            }
+        d_n_endpoints += endpoints.size();
+        d_destinations.push_back(Destination{&socket, std::move(endpoints)});
+    };
+    add_destination(d_socket_v4, boost::asio::ip::udp::v4(), endpoints_v4);
+    add_destination(d_socket_v6, boost::asio::ip::udp::v6(), endpoints_v6);
+
+    if (d_capacity > 0)
+        {
+            d_pending.reserve(d_capacity);
+            d_sender = std::thread(&Udp_Datagram_Sender::sender_loop, this);
+        }
+}
+
+
+Udp_Datagram_Sender::~Udp_Datagram_Sender()
+{
+    if (d_sender.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                d_stopping = true;
+            }
+            d_not_empty.notify_all();
+            d_sender.join();
+        }
+
+    const Statistics stats = statistics();
+    if (stats.send_errors > 0 || stats.datagrams_dropped > 0)
+        {
+            LOG(INFO) << "UDP monitor sender: " << stats.messages_sent << " messages sent in "
+                      << stats.batches << " batches, " << stats.send_errors << " send errors, "
+                      << stats.datagrams_dropped << " datagrams dropped, max. queue depth "
+                      << stats.max_depth << " of " << d_capacity;
+        }
+}
+
+
+std::string Udp_Datagram_Sender::get_buffer()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (d_free_buffers.empty())
+        {
+            return {};
+        }
+    std::string buffer = std::move(d_free_buffers.back());
+    d_free_buffers.pop_back();
+    buffer.clear();
+    return buffer;
+}
+
+
+bool Udp_Datagram_Sender::send(std::string&& datagram)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (!threaded())
+        {
+            d_pending.push_back(std::move(datagram));
+            const uint64_t failed = transmit(d_pending);
+            d_stats.batches++;
+            d_stats.messages_sent += d_n_endpoints - failed;
+            d_stats.send_errors += failed;
+            recycle(d_pending);
+            return failed == 0 && d_n_endpoints > 0;
+        }
+
+    if (d_pending.size() >= d_capacity)
+        {
+            if (d_stats.datagrams_dropped == 0)
+                {
+                    LOG(WARNING) << "UDP monitor send queue is full (" << d_capacity << " datagrams), discarding data";
+                }
+            d_stats.datagrams_dropped++;
+            d_free_buffers.push_back(std::move(datagram));
+            return false;
+        }
+    d_pending.push_back(std::move(datagram));
+    d_stats.max_depth = std::max(d_stats.max_depth, d_pending.size());
+    lock.unlock();
+    d_not_empty.notify_one();
+    return true;
+}
+
+
+bool Udp_Datagram_Sender::threaded() const
+{
+    return d_capacity > 0;
+}
+
+
+Udp_Datagram_Sender::Statistics Udp_Datagram_Sender::statistics() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_stats;
+}
+
+
+void Udp_Datagram_Sender::sender_loop()
+{
+    std::vector<std::string> batch;
+    batch.reserve(d_capacity);
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (true)
+        {
+            d_not_empty.wait(lock, [this] { return d_stopping || !d_pending.empty(); });
+            if (d_pending.empty())
+                {
+                    break;  // stopping, and everything has been sent
+                }
+            batch.swap(d_pending);
+            lock.unlock();
+
+            const uint64_t failed = transmit(batch);
+
+            lock.lock();
+            d_stats.batches++;
+            d_stats.messages_sent += batch.size() * d_n_endpoints - failed;
+            d_stats.send_errors += failed;
+            recycle(batch);
+        }
+}
+
+
+uint64_t Udp_Datagram_Sender::transmit(const std::vector<std::string>& datagrams)
+{
+    uint64_t failed = 0;
+    for (auto& destination : d_destinations)
+        {
+            failed += transmit_to(destination, datagrams);
+        }
+    return failed;
+}
+
+
+#if defined(__linux__)
+uint64_t Udp_Datagram_Sender::transmit_to(Destination& destination, const std::vector<std::string>& datagrams)
+{
+    const size_t n_messages = datagrams.size() * destination.endpoints.size();
+    d_headers.resize(n_messages);
+    d_iovecs.resize(n_messages);
+    size_t k = 0;
+    for (const auto& datagram : datagrams)
+        {
+            for (const auto& endpoint : destination.endpoints)
+                {
+                    d_iovecs[k].iov_base = const_cast<char*>(datagram.data());
+                    d_iovecs[k].iov_len = datagram.size();
+                    d_headers[k] = mmsghdr{};
+                    d_headers[k].msg_hdr.msg_name = const_cast<void*>(static_cast<const void*>(endpoint.data()));
+                    d_headers[k].msg_hdr.msg_namelen = static_cast<socklen_t>(endpoint.size());
+                    d_headers[k].msg_hdr.msg_iov = &d_iovecs[k];
+                    d_headers[k].msg_hdr.msg_iovlen = 1;
+                    k++;
+                }
+        }
+
+    uint64_t failed = 0;
+    size_t sent = 0;
+    while (sent < n_messages)
+        {
+            const auto count = static_cast<unsigned int>(std::min(n_messages - sent, MAX_MESSAGES_PER_CALL));
+            const int ret = ::sendmmsg(destination.socket->native_handle(), &d_headers[sent], count, 0);
+            if (ret > 0)
+                {
+                    sent += static_cast<size_t>(ret);
+                    continue;
+                }
+            if (ret < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+            // The first message of the batch failed: skip it and go on with the rest
+            if (failed == 0)
+                {
+                    DLOG(WARNING) << "Error sending monitoring data: " << std::strerror(errno);
+                }
+            failed++;
+            sent++;
+        }
+    return failed;
+}
+#else
+uint64_t Udp_Datagram_Sender::transmit_to(Destination& destination, const std::vector<std::string>& datagrams)
+{
+    uint64_t failed = 0;
+    boost::system::error_code error;
+    for (const auto& datagram : datagrams)
+        {
+            for (const auto& endpoint : destination.endpoints)
+                {
+                    if (destination.socket->send_to(boost::asio::buffer(datagram), endpoint, 0, error) == 0 || error)
+                        {
+                            if (failed == 0)
+                                {
+                                    DLOG(WARNING) << "Error sending monitoring data: " << error.message();
+                                }
+                            failed++;
+                        }
+                }
+        }
+    return failed;
+}
+#endif
+
+
+void Udp_Datagram_Sender::recycle(std::vector<std::string>& datagrams)
+{
+    for (auto& datagram : datagrams)
+        {
+            if (d_free_buffers.size() > d_capacity)
+                {
+                    break;
+                }
+            d_free_buffers.push_back(std::move(datagram));
+        }
+    datagrams.clear();
+}
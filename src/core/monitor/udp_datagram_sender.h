@@ -0,0 +1,178 @@
+/*!
+ * \file udp_datagram_sender.h
+ * \brief Sends datagrams over UDP to one or multiple endpoints through
+ * persistent sockets, optionally from a dedicated sender thread.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_DATAGRAM_SENDER_H
+#define GNSS_SDR_UDP_DATAGRAM_SENDER_H
+
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/socket.h>  // for mmsghdr
+#include <sys/uio.h>     // for iovec
+#endif
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+using b_io_context = boost::asio::io_context;
+#else
+using b_io_context = boost::asio::io_service;
+#endif
+
+/*!
+ * \brief Stream buffer that appends everything written to it to a string,
+ * so that Boost archives can be serialized into a recycled datagram buffer
+ * instead of a new std::ostringstream.
+ */
+class String_Append_Streambuf : public std::streambuf
+{
+public:
+    explicit String_Append_Streambuf(std::string& target) : d_target(target) {}
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+            {
+                d_target.push_back(traits_type::to_char_type(ch));
+            }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        d_target.append(s, static_cast<size_t>(n));
+        return n;
+    }
+
+private:
+    std::string& d_target;
+};
+
+
+/*!
+ * \brief Sends each datagram to all the configured endpoints.
+ *
+ * One socket per address family is opened when the object is created and
+ * kept for its whole lifetime. On Linux, the copies of a set of datagrams
+ * for all the endpoints are handed to the kernel with a single sendmmsg()
+ * call.
+ *
+ * With a queue size greater than zero, send() only queues the datagram and
+ * returns, and a sender thread transmits everything that was queued since
+ * its previous wakeup in one batch. Monitoring data is best effort, so
+ * datagrams submitted while the queue is full are discarded. With a queue
+ * size of zero, the datagram is sent in the caller's thread.
+ *
+ * Sent buffers are kept and handed out again by get_buffer(), so that their
+ * memory is reused by the next datagrams.
+ */
+class Udp_Datagram_Sender
+{
+public:
+    /*!
+     * \brief Sender counters. A message is one datagram sent to one endpoint.
+     */
+    struct Statistics
+    {
+        uint64_t messages_sent{0};
+        uint64_t send_errors{0};
+        uint64_t datagrams_dropped{0};  // discarded because the queue was full
+        uint64_t batches{0};
+        size_t max_depth{0};
+    };
+
+    Udp_Datagram_Sender(const std::vector<std::string>& addresses, uint16_t port, size_t queue_size);
+
+    /*!
+     * \brief Sends the queued datagrams and joins the sender thread.
+     */
+    ~Udp_Datagram_Sender();
+
+    Udp_Datagram_Sender(const Udp_Datagram_Sender&) = delete;
+    Udp_Datagram_Sender& operator=(const Udp_Datagram_Sender&) = delete;
+
+    /*!
+     * \brief Returns an empty string, reusing the memory of an already sent
+     * datagram if there is one available.
+     */
+    std::string get_buffer();
+
+    /*!
+     * \brief Sends (or queues, if threaded) a datagram to all the endpoints.
+     * Returns false if it was dropped or if it could not be sent.
+     */
+    bool send(std::string&& datagram);
+
+    /*!
+     * \brief Returns true if the datagrams are sent by the sender thread.
+     */
+    bool threaded() const;
+
+    /*!
+     * \brief Returns the counters of the sender since it was created.
+     */
+    Statistics statistics() const;
+
+private:
+    struct Destination
+    {
+        boost::asio::ip::udp::socket* socket;
+        std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    };
+
+    void sender_loop();
+    uint64_t transmit(const std::vector<std::string>& datagrams);  // returns the number of failed messages
+    uint64_t transmit_to(Destination& destination, const std::vector<std::string>& datagrams);
+    void recycle(std::vector<std::string>& datagrams);
+
+    b_io_context d_io_context;
+    boost::asio::ip::udp::socket d_socket_v4;
+    boost::asio::ip::udp::socket d_socket_v6;
+    std::vector<Destination> d_destinations;
+    size_t d_n_endpoints{0};
+
+    std::vector<std::string> d_pending;       // queued by send(), or being sent if not threaded
+    std::vector<std::string> d_free_buffers;  // sent datagrams, handed out by get_buffer()
+#if defined(__linux__)
+    std::vector<mmsghdr> d_headers;
+    std::vector<iovec> d_iovecs;
+#endif
+
+    std::thread d_sender;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_not_empty;
+    Statistics d_stats;
+    size_t d_capacity;
+    bool d_stopping{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_DATAGRAM_SENDER_H
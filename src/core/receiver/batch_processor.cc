@@ -0,0 +1,598 @@
+/*!
+ * \file batch_processor.cc
+ * \brief Post-processes a recorded file by running independent receivers on
+ * overlapping time segments and merging their outputs.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "batch_processor.h"
+#include "concurrent_queue.h"
+#include "control_thread.h"
+#include "file_configuration.h"
+#include "file_source_base.h"
+#include "gnss_block_factory.h"
+#include "gnss_sdr_filesystem.h"
+#include "gnss_sdr_flags.h"
+#include "signal_source_interface.h"
+#include <pmt/pmt.h>
+#include <sys/types.h>  // for pid_t
+#include <sys/wait.h>   // for waitpid
+#include <unistd.h>     // for fork, dup2
+#include <algorithm>    // for std::max, std::sort
+#include <array>        // for std::array
+#include <cerrno>       // for errno, EINTR
+#include <cstdint>      // for uint32_t, uint64_t
+#include <cstdio>       // for std::freopen, std::fflush
+#include <cstdlib>      // for std::exit
+#include <cstring>      // for std::memcpy
+#include <fstream>      // for std::ifstream, std::ofstream
+#include <iomanip>      // for std::setw, std::setfill
+#include <iostream>     // for std::cout, std::cerr
+#include <map>          // for std::map
+#include <set>          // for std::set
+#include <sstream>      // for std::istringstream, std::ostringstream
+#include <stdexcept>    // for std::runtime_error
+#include <thread>       // for std::thread::hardware_concurrency
+#include <utility>      // for std::move
+
+#if USE_GLOG_AND_GFLAGS
+#include <glog/logging.h>
+#else
+#include <absl/flags/flag.h>
+#include <absl/log/log.h>
+#endif
+
+using namespace std::string_literals;
+
+namespace
+{
+// Size of the records written by Rtklib_Solver to the PVT dump file
+constexpr size_t PVT_DUMP_RECORD_BYTES = sizeof(double) * 21 + sizeof(uint32_t) * 2 + sizeof(uint8_t) * 3 + sizeof(float) * 2;
+constexpr uint64_t MS_PER_WEEK = 604800000;
+
+std::vector<std::string> signal_source_roles(const ConfigurationInterface* configuration)
+{
+    const int32_t src_count_deprecated = configuration->property("Receiver.sources_count", 1);
+    const int32_t src_count = configuration->property("GNSS-SDR.num_sources", src_count_deprecated);
+    std::vector<std::string> roles{"SignalSource"};
+    for (int32_t i = 0; src_count > 1 && i < src_count; i++)
+        {
+            roles.push_back("SignalSource" + std::to_string(i));
+        }
+    return roles;
+}
+
+
+// The PVT block always writes its dump to <path>/<name without extension>.dat
+std::string pvt_dump_stem(const std::string& dump_filename)
+{
+    std::string stem = fs::path(dump_filename).filename().string();
+    if (stem.empty())
+        {
+            stem = "pvt";
+        }
+    if (stem.substr(1).find_last_of('.') != std::string::npos)
+        {
+            stem = stem.substr(0, stem.find_last_of('.'));
+        }
+    return stem;
+}
+
+
+int64_t days_from_civil(int64_t y, int64_t m, int64_t d)
+{
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+
+// Seconds since 1970 of a RINEX 3 epoch record ("> yyyy mm dd hh mm ss.sssssss  f nn")
+double rinex_epoch_seconds(const std::string& line)
+{
+    std::istringstream fields(line.substr(1));
+    int64_t year = 0;
+    int64_t month = 0;
+    int64_t day = 0;
+    int64_t hour = 0;
+    int64_t minute = 0;
+    double seconds = 0.0;
+    if (!(fields >> year >> month >> day >> hour >> minute >> seconds))
+        {
+            return -1.0;
+        }
+    return static_cast<double>((days_from_civil(year, month, day) * 24 + hour) * 60 + minute) * 60.0 + seconds;
+}
+
+
+bool read_rinex(const std::string& filename, std::vector<std::string>& header, std::vector<std::string>& body)
+{
+    std::ifstream in(filename);
+    if (!in.is_open())
+        {
+            return false;
+        }
+    std::string line;
+    bool in_header = true;
+    while (std::getline(in, line))
+        {
+            if (in_header)
+                {
+                    header.push_back(line);
+                    in_header = line.find("END OF HEADER") == std::string::npos;
+                }
+            else
+                {
+                    body.push_back(line);
+                }
+        }
+    return !in_header;
+}
+
+
+// Observation types of each satellite system, from the SYS / # / OBS TYPES records
+std::map<char, std::vector<std::string>> rinex_observation_types(const std::vector<std::string>& header)
+{
+    std::map<char, std::vector<std::string>> types;
+    char system = ' ';
+    for (const auto& line : header)
+        {
+            if (line.size() < 80 || line.compare(60, 19, "SYS / # / OBS TYPES") != 0)
+                {
+                    continue;
+                }
+            if (line[0] != ' ')
+                {
+                    system = line[0];
+                }
+            for (size_t pos = 7; pos + 3 <= 60; pos += 4)
+                {
+                    const std::string type = line.substr(pos, 3);
+                    if (type != "   ")
+                        {
+                            types[system].push_back(type);
+                        }
+                }
+        }
+    return types;
+}
+
+
+// Sets the loss of lock indicator of the phase observations of a satellite record
+void flag_loss_of_lock(std::string& line, const std::vector<std::string>& types)
+{
+    for (size_t i = 0; i < types.size(); i++)
+        {
+            const size_t field = 3 + 16 * i;
+            if (types[i][0] != 'L' || line.size() < field + 14 || line.find_first_not_of(' ', field) >= field + 14)
+                {
+                    continue;
+                }
+            if (line.size() < field + 15)
+                {
+                    line.resize(field + 15, ' ');
+                }
+            char& lli = line[field + 14];
+            lli = (lli >= '0' && lli <= '9') ? static_cast<char>('0' + ((lli - '0') | 1)) : '1';
+        }
+}
+}  // namespace
+
+
+BatchProcessor::BatchProcessor(std::shared_ptr<FileConfiguration> configuration)
+    : configuration_(std::move(configuration))
+{
+    num_segments_ = configuration_->property("GNSS-SDR.batch_segments", 0);
+    overlap_s_ = std::max(configuration_->property("GNSS-SDR.batch_overlap_s", 60.0), 0.0);
+    jobs_ = std::max(configuration_->property("GNSS-SDR.batch_jobs", static_cast<int32_t>(std::thread::hardware_concurrency())), 1);
+    batch_path_ = configuration_->property("GNSS-SDR.batch_path", configuration_->property("PVT.output_path", "."s) + "/batch");
+}
+
+
+std::vector<BatchProcessor::Segment> BatchProcessor::plan_segments()
+{
+    Concurrent_Queue<pmt::pmt_t> queue;
+    GNSSBlockFactory block_factory;
+    const auto roles = signal_source_roles(configuration_.get());
+    auto source = block_factory.GetSignalSource(configuration_.get(), &queue, roles.size() > 1 ? 0 : -1);
+    auto* file_source = dynamic_cast<FileSourceBase*>(source.get());
+    if (file_source == nullptr)
+        {
+            throw std::runtime_error("GNSS-SDR.batch_segments requires a file-based signal source");
+        }
+    if (file_source->repeat())
+        {
+            throw std::runtime_error("GNSS-SDR.batch_segments cannot be used with " + source->role() + ".repeat=true");
+        }
+    if (file_source->samples() > 0)
+        {
+            std::cout << "Warning: " << source->role() << ".samples is ignored in batch mode, the whole file is processed.\n";
+        }
+
+    const double first_s = configuration_->property(source->role() + ".seconds_to_skip", 0.0);
+    const double end_s = file_source->signal_duration_s();
+    if (end_s <= first_s)
+        {
+            throw std::runtime_error("The file " + file_source->filename() + " has no samples to process");
+        }
+
+    const double segment_s = (end_s - first_s) / num_segments_;
+    std::vector<Segment> segments;
+    for (int i = 0; i < num_segments_; i++)
+        {
+            std::ostringstream path;
+            path << batch_path_ << "/segment_" << std::setw(3) << std::setfill('0') << i;
+            Segment segment{};
+            segment.start_s = std::max(first_s + i * segment_s - overlap_s_, first_s);
+            segment.duration_s = (i == num_segments_ - 1) ? 0.0 : first_s + (i + 1) * segment_s - segment.start_s;
+            segment.path = path.str();
+            segments.push_back(segment);
+        }
+    return segments;
+}
+
+
+int BatchProcessor::run()
+{
+    segments_ = plan_segments();
+    std::cout << "Batch mode: processing " << segments_.size() << " segments with up to "
+              << jobs_ << " receivers at once. Outputs of each segment at " << batch_path_ << '\n';
+
+    std::map<pid_t, size_t> running;
+    std::vector<int> status(segments_.size(), 1);
+    size_t next = 0;
+    while (next < segments_.size() || !running.empty())
+        {
+            while (next < segments_.size() && static_cast<int>(running.size()) < jobs_)
+                {
+                    errorlib::error_code ec;
+                    fs::create_directories(segments_[next].path, ec);
+
+                    // do not let the children flush what the parent has buffered
+                    std::cout.flush();
+                    std::cerr.flush();
+                    std::fflush(nullptr);
+                    const pid_t pid = fork();
+                    if (pid == 0)
+                        {
+                            std::exit(run_segment(segments_[next]));
+                        }
+                    if (pid < 0)
+                        {
+                            std::cerr << "Cannot start the receiver of segment " << next << ": " << std::strerror(errno) << '\n';
+                        }
+                    else
+                        {
+                            running[pid] = next;
+                        }
+                    next++;
+                }
+            if (running.empty())
+                {
+                    break;
+                }
+
+            int wstatus = 0;
+            const pid_t pid = waitpid(-1, &wstatus, 0);
+            if (pid < 0)
+                {
+                    if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                    std::cerr << "Error waiting for the segment receivers: " << std::strerror(errno) << '\n';
+                    break;
+                }
+            const auto it = running.find(pid);
+            if (it == running.cend())
+                {
+                    continue;
+                }
+            status[it->second] = WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : 1;
+            std::cout << "Segment " << it->second << " of " << segments_.size() << (status[it->second] == 0 ? " done\n" : " failed, see ")
+                      << (status[it->second] == 0 ? "" : segments_[it->second].path + "/gnss-sdr.out\n");
+            running.erase(it);
+        }
+
+    merge_outputs();
+    return std::all_of(status.cbegin(), status.cend(), [](int s) { return s == 0; }) ? 0 : 1;
+}
+
+
+int BatchProcessor::run_segment(const Segment& segment)
+{
+    // The receivers print to their own files, otherwise their outputs get mixed up
+    const std::string console_filename = segment.path + "/gnss-sdr.out";
+    if (std::freopen(console_filename.c_str(), "w", stdout) != nullptr)
+        {
+            dup2(fileno(stdout), fileno(stderr));
+        }
+
+    for (const auto& role : signal_source_roles(configuration_.get()))
+        {
+            configuration_->set_property(role + ".seconds_to_skip", std::to_string(segment.start_s));
+            configuration_->set_property(role + ".seconds_to_process", std::to_string(segment.duration_s));
+            configuration_->set_property(role + ".samples", "0");
+        }
+
+    for (const auto& property : {"output_path", "rinex_output_path", "gpx_output_path", "geojson_output_path", "kml_output_path",
+             "xml_output_path", "nmea_output_file_path", "rtcm_output_file_path", "has_output_file_path"})
+        {
+            configuration_->set_property("PVT."s + property, segment.path);
+        }
+    configuration_->set_property("PVT.dump_filename", segment.path + "/" + pvt_dump_stem(configuration_->property("PVT.dump_filename", "./pvt.dat"s)) + ".dat");
+    configuration_->set_property("Observables.dump_filename", segment.path + "/" + fs::path(configuration_->property("Observables.dump_filename", "./observables.dat"s)).filename().string());
+
+    // Receivers running side by side cannot share ports nor devices
+    for (const auto& property : {"GNSS-SDR.telecommand_enabled", "Monitor.enable_monitor", "AcquisitionMonitor.enable_monitor", "TrackingMonitor.enable_monitor",
+             "PVT.enable_monitor", "PVT.flag_rtcm_server", "PVT.flag_rtcm_tty_port", "PVT.flag_nmea_tty_port", "PVT.an_output_enabled"})
+        {
+            configuration_->set_property(property, "false");
+        }
+#if USE_GLOG_AND_GFLAGS
+    FLAGS_keyboard = false;
+#else
+    absl::SetFlag(&FLAGS_keyboard, false);
+#endif
+
+    int return_code = 1;
+    try
+        {
+            auto control_thread = std::make_unique<ControlThread>(configuration_);
+            return_code = control_thread->run();
+        }
+    catch (const std::exception& e)
+        {
+            std::cerr << e.what() << '\n';
+        }
+    std::cout.flush();
+    return return_code;
+}
+
+
+void BatchProcessor::merge_outputs() const
+{
+    // RINEX files, grouped by file type and satellite system
+    std::map<std::string, std::vector<std::string>> rinex_files;
+    bool old_rinex = false;
+    for (const auto& segment : segments_)
+        {
+            errorlib::error_code ec;
+            if (!fs::is_directory(segment.path, ec))
+                {
+                    continue;
+                }
+            std::vector<std::string> filenames;
+            for (fs::directory_iterator it(segment.path, ec), end; !ec && it != end; it.increment(ec))
+                {
+                    if (fs::is_regular_file(it->path(), ec))
+                        {
+                            filenames.push_back(it->path().string());
+                        }
+                }
+            std::sort(filenames.begin(), filenames.end());
+            for (const auto& filename : filenames)
+                {
+                    std::ifstream in(filename, std::ios::binary);
+                    std::string line(80, ' ');
+                    if (!in.read(&line[0], 80) || line.compare(60, 20, "RINEX VERSION / TYPE") != 0)
+                        {
+                            continue;
+                        }
+                    if (std::atof(line.substr(0, 9).c_str()) < 3.0)
+                        {
+                            old_rinex = true;
+                            continue;
+                        }
+                    rinex_files[line.substr(20, 1) + line.substr(40, 1)].push_back(filename);
+                }
+        }
+    if (old_rinex)
+        {
+            std::cout << "Warning: only RINEX 3 files are merged. The RINEX 2 files of each segment are kept in " << batch_path_ << '\n';
+        }
+
+    const std::string rinex_path = configuration_->property("PVT.rinex_output_path", configuration_->property("PVT.output_path", "."s));
+    errorlib::error_code ec;
+    fs::create_directories(rinex_path, ec);
+    for (const auto& group : rinex_files)
+        {
+            const std::string output = rinex_path + "/" + fs::path(group.second.front()).filename().string();
+            const bool merged = group.first[0] == 'O' ? merge_rinex_observations(group.second, output) : merge_rinex_navigation(group.second, output);
+            if (merged)
+                {
+                    std::cout << "Merged " << group.second.size() << " RINEX files into " << output << '\n';
+                }
+        }
+
+    if (configuration_->property("PVT.dump", false))
+        {
+            const std::string dump_filename = configuration_->property("PVT.dump_filename", "./pvt.dat"s);
+            const std::string stem = pvt_dump_stem(dump_filename);
+            std::vector<std::string> inputs;
+            for (const auto& segment : segments_)
+                {
+                    inputs.push_back(segment.path + "/" + stem + ".dat");
+                }
+            const std::string dump_path = fs::path(dump_filename).parent_path().string();
+            const std::string output = (dump_path.empty() ? "."s : dump_path) + "/" + stem + ".dat";
+            if (merge_pvt_dumps(inputs, output))
+                {
+                    std::cout << "Merged the PVT dump files into " << output << '\n';
+                }
+        }
+}
+
+
+bool BatchProcessor::merge_rinex_observations(const std::vector<std::string>& inputs, const std::string& output)
+{
+    std::ofstream out(output, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+        {
+            LOG(WARNING) << "Cannot write the merged RINEX file " << output;
+            return false;
+        }
+
+    std::map<char, std::vector<std::string>> types;
+    bool header_written = false;
+    double last_epoch_s = -1.0;
+    double interval_s = 0.0;
+    for (const auto& input : inputs)
+        {
+            std::vector<std::string> header;
+            std::vector<std::string> body;
+            if (!read_rinex(input, header, body))
+                {
+                    continue;
+                }
+            if (!header_written)
+                {
+                    for (const auto& line : header)
+                        {
+                            out << line << '\n';
+                        }
+                    types = rinex_observation_types(header);
+                    header_written = true;
+                }
+
+            // The epochs already written by the previous segment are skipped, and the
+            // phase of the first epoch of this one cannot be assumed to be continuous
+            bool first_epoch = last_epoch_s >= 0.0;
+            bool keep = false;
+            bool flag_phase = false;
+            for (auto& line : body)
+                {
+                    if (!line.empty() && line[0] == '>')
+                        {
+                            const double epoch_s = rinex_epoch_seconds(line);
+                            keep = epoch_s > last_epoch_s + (interval_s > 0.0 ? interval_s / 2.0 : 1e-3);
+                            flag_phase = false;
+                            if (keep)
+                                {
+                                    if (first_epoch)
+                                        {
+                                            if (interval_s > 0.0 && epoch_s - last_epoch_s > 1.5 * interval_s)
+                                                {
+                                                    std::cout << "Warning: " << epoch_s - last_epoch_s << " s without observations before the first epoch of "
+                                                              << input << ". Please increase GNSS-SDR.batch_overlap_s\n";
+                                                }
+                                            flag_phase = line.size() > 31 && line[31] <= '1';
+                                            first_epoch = false;
+                                        }
+                                    else if (last_epoch_s >= 0.0)
+                                        {
+                                            interval_s = epoch_s - last_epoch_s;
+                                        }
+                                    last_epoch_s = epoch_s;
+                                }
+                        }
+                    else if (flag_phase && line.size() >= 3)
+                        {
+                            flag_loss_of_lock(line, types[line[0]]);
+                        }
+                    if (keep)
+                        {
+                            out << line << '\n';
+                        }
+                }
+        }
+    return header_written;
+}
+
+
+bool BatchProcessor::merge_rinex_navigation(const std::vector<std::string>& inputs, const std::string& output)
+{
+    std::ofstream out(output, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+        {
+            LOG(WARNING) << "Cannot write the merged RINEX file " << output;
+            return false;
+        }
+
+    std::set<std::string> written_records;
+    bool header_written = false;
+    for (const auto& input : inputs)
+        {
+            std::vector<std::string> header;
+            std::vector<std::string> body;
+            if (!read_rinex(input, header, body))
+                {
+                    continue;
+                }
+            if (!header_written)
+                {
+                    for (const auto& line : header)
+                        {
+                            out << line << '\n';
+                        }
+                    header_written = true;
+                }
+
+            // Each record starts with the satellite number, and the
+            // following lines of the record start with blanks
+            std::string record;
+            for (size_t i = 0; i <= body.size(); i++)
+                {
+                    if (i == body.size() || (!body[i].empty() && body[i][0] != ' '))
+                        {
+                            if (!record.empty() && written_records.insert(record).second)
+                                {
+                                    out << record;
+                                }
+                            record.clear();
+                        }
+                    if (i < body.size())
+                        {
+                            record += body[i] + '\n';
+                        }
+                }
+        }
+    return header_written;
+}
+
+
+bool BatchProcessor::merge_pvt_dumps(const std::vector<std::string>& inputs, const std::string& output)
+{
+    std::ofstream out(output, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+        {
+            LOG(WARNING) << "Cannot write the merged PVT dump file " << output;
+            return false;
+        }
+
+    std::array<char, PVT_DUMP_RECORD_BYTES> record{};
+    bool any_record = false;
+    uint64_t last_time_ms = 0;
+    for (const auto& input : inputs)
+        {
+            std::ifstream in(input, std::ios::in | std::ios::binary);
+            while (in.read(record.data(), record.size()))
+                {
+                    // each record starts with the TOW [ms] and the week number
+                    uint32_t tow_ms;
+                    uint32_t week;
+                    std::memcpy(&tow_ms, record.data(), sizeof(uint32_t));
+                    std::memcpy(&week, record.data() + sizeof(uint32_t), sizeof(uint32_t));
+                    const uint64_t time_ms = week * MS_PER_WEEK + tow_ms;
+                    if (!any_record || time_ms > last_time_ms)
+                        {
+                            out.write(record.data(), record.size());
+                            last_time_ms = time_ms;
+                            any_record = true;
+                        }
+                }
+        }
+    return any_record && out.good();
+}
@@ -0,0 +1,104 @@
+/*!
+ * \file batch_processor.h
+ * \brief Post-processes a recorded file by running independent receivers on
+ * overlapping time segments and merging their outputs.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_BATCH_PROCESSOR_H
+#define GNSS_SDR_BATCH_PROCESSOR_H
+
+#include <memory>  // for shared_ptr
+#include <string>  // for string
+#include <vector>  // for vector
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+class FileConfiguration;
+
+
+/*!
+ * \brief Batch mode for recorded files.
+ *
+ * If GNSS-SDR.batch_segments is larger than 1, the file is split into that
+ * number of time segments. Each segment is processed by a receiver running in
+ * its own process, which starts GNSS-SDR.batch_overlap_s seconds before the
+ * segment so that it has acquired, tracked and decoded the satellites by the
+ * time its segment begins. Up to GNSS-SDR.batch_jobs receivers run at once,
+ * and each one writes its outputs to a folder under GNSS-SDR.batch_path. All
+ * of them share the assistance data configured with GNSS-SDR.AGNSS_XML_enabled,
+ * which shortens the warm-up.
+ *
+ * Once all the segments are processed, the RINEX 3 observation and navigation
+ * files and the PVT dump files are merged into single files in the paths
+ * configured for the PVT block. The epochs in the overlap are taken from the
+ * segment that was already running, and the phase observations of the first
+ * epoch taken from a new segment are flagged with a loss of lock.
+ */
+class BatchProcessor
+{
+public:
+    /*!
+     * \brief Uses the given configuration, which must set
+     * GNSS-SDR.batch_segments to a value larger than 1
+     */
+    explicit BatchProcessor(std::shared_ptr<FileConfiguration> configuration);
+
+    /*!
+     * \brief Processes all the segments and merges their outputs.
+     * Returns 0 if all the receivers ended without errors.
+     */
+    int run();
+
+    /*!
+     * \brief Merges RINEX 3 observation files of consecutive segments
+     */
+    static bool merge_rinex_observations(const std::vector<std::string>& inputs, const std::string& output);
+
+    /*!
+     * \brief Merges RINEX 3 navigation files, removing repeated records
+     */
+    static bool merge_rinex_navigation(const std::vector<std::string>& inputs, const std::string& output);
+
+    /*!
+     * \brief Merges binary PVT dump files of consecutive segments
+     */
+    static bool merge_pvt_dumps(const std::vector<std::string>& inputs, const std::string& output);
+
+private:
+    struct Segment
+    {
+        double start_s;     // first second processed, overlap included
+        double duration_s;  // 0 means until the end of the file
+        std::string path;
+    };
+
+    std::vector<Segment> plan_segments();
+    int run_segment(const Segment& segment);
+    void merge_outputs() const;
+
+    std::shared_ptr<FileConfiguration> configuration_;
+    std::vector<Segment> segments_;
+    std::string batch_path_;
+    double overlap_s_;
+    int num_segments_;
+    int jobs_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_BATCH_PROCESSOR_H
@@ -1,6 +1,6 @@
 /*!
  * \file concurrent_queue.h
- * \brief Interface of a thread-safe std::queue
+ * \brief Interface of a thread-safe, lock-free queue
  * \author Javier Arribas, 2011. jarribas(at)cttc.es
  *
  * -----------------------------------------------------------------------------
@@ -8,7 +8,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -17,11 +17,18 @@
 #ifndef GNSS_SDR_CONCURRENT_QUEUE_H
 #define GNSS_SDR_CONCURRENT_QUEUE_H
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
+#include <utility>
+#include <vector>
 
 /** \addtogroup Core
  * \{ */
@@ -32,84 +39,335 @@
 template <typename Data>
 
 /*!
- * \brief This class implements a thread-safe std::queue
+ * \brief This class implements a thread-safe multi-producer, multi-consumer
+ * FIFO queue
  *
- * Thread-safe object queue which uses the library
- * boost_thread to perform MUTEX based on the code available at
- * https://www.justsoftwaresolutions.co.uk/threading/implementing-a-thread-safe-queue-using-condition-variables.html
+ * Items are moved through a bounded lock-free ring buffer (D. Vyukov's
+ * bounded MPMC queue). If the ring is full, push() does not block: the items
+ * are kept in an overflow list protected by a mutex until the consumers catch
+ * up, preserving the order of the items of each producer. A consumer waiting
+ * for data spins for a configurable number of attempts and then sleeps on a
+ * condition variable, which producers only signal if there are sleeping
+ * consumers.
+ *
+ * The queue keeps counters of the number of items, the maximum depth and the
+ * time elapsed between push and pop, see stats().
  */
 class Concurrent_Queue
 {
 public:
+    /*!
+     * \brief Queue counters. Latencies are in seconds.
+     */
+    struct Stats
+    {
+        uint64_t pushed{0};
+        uint64_t popped{0};
+        uint64_t overflowed{0};  // items that did not fit in the ring buffer
+        uint64_t max_depth{0};
+        double mean_latency_s{0.0};
+        double max_latency_s{0.0};
+    };
+
+    /*!
+     * \brief Builds a queue with a ring buffer of at least capacity items.
+     * wait_spins is the number of pop attempts of a waiting consumer before
+     * it goes to sleep.
+     */
+    explicit Concurrent_Queue(size_t capacity = 1024, uint32_t wait_spins = 0)
+        : d_wait_spins(wait_spins)
+    {
+        size_t ring_size = 2;
+        while (ring_size < capacity)
+            {
+                ring_size *= 2;
+            }
+        d_ring = std::unique_ptr<Cell[]>(new Cell[ring_size]);
+        d_mask = ring_size - 1;
+        for (size_t i = 0; i < ring_size; i++)
+            {
+                d_ring[i].sequence.store(i, std::memory_order_relaxed);
+            }
+    }
+
+    Concurrent_Queue(const Concurrent_Queue&) = delete;
+    Concurrent_Queue& operator=(const Concurrent_Queue&) = delete;
+
     void push(Data const& data)
     {
-        std::unique_lock<std::mutex> lock(the_mutex);
-        the_queue.push(data);
-        lock.unlock();
-        the_condition_variable.notify_one();
+        Data copy(data);
+        push(std::move(copy));
+    }
+
+    void push(Data&& data)
+    {
+        const auto now = Clock::now();
+        // counted before the item is visible to the consumers, so that popped <= pushed
+        const uint64_t pushed = d_pushed.fetch_add(1, std::memory_order_relaxed) + 1;
+        const uint64_t popped = d_popped.load(std::memory_order_relaxed);
+        update_max(d_max_depth, pushed > popped ? pushed - popped : 0);
+        if (d_overflowing.load(std::memory_order_acquire) || !ring_push(data, now))
+            {
+                std::lock_guard<std::mutex> lock(d_overflow_mutex);
+                d_overflow.emplace_back(std::move(data), now);
+                d_overflowing.store(true, std::memory_order_release);
+                d_overflowed.fetch_add(1, std::memory_order_relaxed);
+            }
+        // wake up a sleeping consumer, if any
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (d_waiters.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard<std::mutex> lock(d_wait_mutex);
+                d_condition.notify_one();
+            }
     }
 
     bool empty() const
     {
-        std::unique_lock<std::mutex> lock(the_mutex);
-        return the_queue.empty();
+        return size() == 0;
     }
 
     size_t size() const
     {
-        std::unique_lock<std::mutex> lock(the_mutex);
-        return the_queue.size();
+        const size_t dequeue_pos = d_dequeue_pos.load(std::memory_order_acquire);
+        const size_t enqueue_pos = d_enqueue_pos.load(std::memory_order_acquire);
+        size_t items = enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+        if (d_overflowing.load(std::memory_order_acquire))
+            {
+                std::lock_guard<std::mutex> lock(d_overflow_mutex);
+                items += d_overflow.size();
+            }
+        return items;
     }
 
     void clear()
     {
-        std::unique_lock<std::mutex> lock(the_mutex);
-        the_queue = std::queue<Data>();
+        Data discarded;
+        while (try_pop(discarded))
+            {
+            }
     }
 
     bool try_pop(Data& popped_value)
     {
-        std::unique_lock<std::mutex> lock(the_mutex);
-        if (the_queue.empty())
+        Time pushed_at;
+        if (!ring_pop(popped_value, pushed_at) && !overflow_pop(popped_value, pushed_at))
             {
                 return false;
             }
-        popped_value = the_queue.front();
-        the_queue.pop();
+        d_popped.fetch_add(1, std::memory_order_relaxed);
+        const auto latency_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - pushed_at).count());
+        d_latency_sum_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+        update_max(d_max_latency_ns, latency_ns);
         return true;
     }
 
+    /*!
+     * \brief Moves up to max_items queued items to the end of popped_values
+     * without waiting, and returns the number of items moved.
+     */
+    size_t drain(std::vector<Data>& popped_values, size_t max_items = std::numeric_limits<size_t>::max())
+    {
+        size_t items = 0;
+        Data popped_value;
+        while (items < max_items && try_pop(popped_value))
+            {
+                popped_values.push_back(std::move(popped_value));
+                items++;
+            }
+        return items;
+    }
+
     void wait_and_pop(Data& popped_value)
     {
-        std::unique_lock<std::mutex> lock(the_mutex);
-        while (the_queue.empty())
+        if (spin_pop(popped_value))
             {
-                the_condition_variable.wait(lock);
+                return;
             }
-        popped_value = the_queue.front();
-        the_queue.pop();
+        std::unique_lock<std::mutex> lock(d_wait_mutex);
+        d_waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        d_condition.wait(lock, [&] { return try_pop(popped_value); });
+        d_waiters.fetch_sub(1, std::memory_order_relaxed);
     }
 
     bool timed_wait_and_pop(Data& popped_value, int wait_ms)
     {
-        std::unique_lock<std::mutex> lock(the_mutex);
-        if (the_queue.empty())
+        if (spin_pop(popped_value))
+            {
+                return true;
+            }
+        std::unique_lock<std::mutex> lock(d_wait_mutex);
+        d_waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const bool valid = d_condition.wait_for(lock, std::chrono::milliseconds(wait_ms), [&] { return try_pop(popped_value); });
+        d_waiters.fetch_sub(1, std::memory_order_relaxed);
+        return valid;
+    }
+
+    Stats stats() const
+    {
+        Stats s;
+        s.pushed = d_pushed.load(std::memory_order_relaxed);
+        s.popped = d_popped.load(std::memory_order_relaxed);
+        s.overflowed = d_overflowed.load(std::memory_order_relaxed);
+        s.max_depth = d_max_depth.load(std::memory_order_relaxed);
+        if (s.popped > 0)
+            {
+                s.mean_latency_s = static_cast<double>(d_latency_sum_ns.load(std::memory_order_relaxed)) * 1e-9 / static_cast<double>(s.popped);
+            }
+        s.max_latency_s = static_cast<double>(d_max_latency_ns.load(std::memory_order_relaxed)) * 1e-9;
+        return s;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using Time = Clock::time_point;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence{0};
+        Data data;
+        Time pushed_at;
+    };
+
+    static void update_max(std::atomic<uint64_t>& max_value, uint64_t value)
+    {
+        uint64_t current = max_value.load(std::memory_order_relaxed);
+        while (value > current && !max_value.compare_exchange_weak(current, value, std::memory_order_relaxed))
             {
-                the_condition_variable.wait_for(lock, std::chrono::milliseconds(wait_ms));
-                if (the_queue.empty())
+            }
+    }
+
+    // Moves data into the ring buffer, unless it is full
+    bool ring_push(Data& data, Time now)
+    {
+        Cell* cell;
+        size_t pos = d_enqueue_pos.load(std::memory_order_relaxed);
+        for (;;)
+            {
+                cell = &d_ring[pos & d_mask];
+                const size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const auto dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (dif == 0)
+                    {
+                        if (d_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                    }
+                else if (dif < 0)
                     {
                         return false;
                     }
+                else
+                    {
+                        pos = d_enqueue_pos.load(std::memory_order_relaxed);
+                    }
             }
-        popped_value = the_queue.front();
-        the_queue.pop();
+        cell->data = std::move(data);
+        cell->pushed_at = now;
+        cell->sequence.store(pos + 1, std::memory_order_release);
         return true;
     }
 
-private:
-    std::queue<Data> the_queue;
-    mutable std::mutex the_mutex;
-    std::condition_variable the_condition_variable;
+    bool ring_pop(Data& data, Time& pushed_at)
+    {
+        Cell* cell;
+        size_t pos = d_dequeue_pos.load(std::memory_order_relaxed);
+        for (;;)
+            {
+                cell = &d_ring[pos & d_mask];
+                const size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const auto dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+                if (dif == 0)
+                    {
+                        if (d_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                    }
+                else if (dif < 0)
+                    {
+                        return false;
+                    }
+                else
+                    {
+                        pos = d_dequeue_pos.load(std::memory_order_relaxed);
+                    }
+            }
+        data = std::move(cell->data);
+        pushed_at = cell->pushed_at;
+        cell->sequence.store(pos + d_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // The overflow list is only read when the ring buffer is empty, with no
+    // push in progress, so that items of the same producer are not reordered
+    bool overflow_pop(Data& data, Time& pushed_at)
+    {
+        if (!d_overflowing.load(std::memory_order_acquire) ||
+            d_enqueue_pos.load(std::memory_order_acquire) != d_dequeue_pos.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+        std::lock_guard<std::mutex> lock(d_overflow_mutex);
+        if (d_overflow.empty())
+            {
+                return false;
+            }
+        data = std::move(d_overflow.front().first);
+        pushed_at = d_overflow.front().second;
+        d_overflow.pop_front();
+        if (d_overflow.empty())
+            {
+                d_overflowing.store(false, std::memory_order_release);
+            }
+        return true;
+    }
+
+    bool spin_pop(Data& popped_value)
+    {
+        if (try_pop(popped_value))
+            {
+                return true;
+            }
+        for (uint32_t i = 0; i < d_wait_spins; i++)
+            {
+                std::this_thread::yield();
+                if (try_pop(popped_value))
+                    {
+                        return true;
+                    }
+            }
+        return false;
+    }
+
+    std::unique_ptr<Cell[]> d_ring;
+    size_t d_mask{0};
+    uint32_t d_wait_spins;
+
+    // producer and consumer positions on separate cache lines
+    char d_pad0[64]{};
+    std::atomic<size_t> d_enqueue_pos{0};
+    char d_pad1[64]{};
+    std::atomic<size_t> d_dequeue_pos{0};
+    char d_pad2[64]{};
+
+    std::deque<std::pair<Data, Time>> d_overflow;
+    mutable std::mutex d_overflow_mutex;
+    std::atomic<bool> d_overflowing{false};
+
+    std::mutex d_wait_mutex;
+    std::condition_variable d_condition;
+    std::atomic<int> d_waiters{0};
+
+    std::atomic<uint64_t> d_pushed{0};
+    std::atomic<uint64_t> d_popped{0};
+    std::atomic<uint64_t> d_overflowed{0};
+    std::atomic<uint64_t> d_max_depth{0};
+    std::atomic<uint64_t> d_latency_sum_ns{0};
+    std::atomic<uint64_t> d_max_latency_ns{0};
 };
 
 
@@ -52,6 +52,7 @@
 #include <boost/lexical_cast.hpp>  // for bad_lexical_cast
 #include <pmt/pmt.h>               // for make_any
 #include <algorithm>               // for find, min
+#include <cerrno>                  // for errno, EIDRM
 #include <chrono>                  // for milliseconds
 #include <cmath>                   // for floor, fmod, log
 #include <csignal>                 // for signal, SIGINT
@@ -88,12 +89,6 @@ ControlThread *ControlThread::me = nullptr;
 
 ControlThread::ControlThread()
 {
-    ControlThread::me = this;
-
-    /* the class will handle signals */
-    signal(SIGINT, ControlThread::handle_signal);
-    signal(SIGTERM, ControlThread::handle_signal);
-    signal(SIGHUP, ControlThread::handle_signal);
 #if USE_GLOG_AND_GFLAGS
     if (FLAGS_c == "-")
         {
@@ -113,6 +108,26 @@ ControlThread::ControlThread()
             configuration_ = std::make_shared<FileConfiguration>(absl::GetFlag(FLAGS_c));
         }
 #endif
+    init_from_file();
+}
+
+
+ControlThread::ControlThread(const std::shared_ptr<FileConfiguration> &configuration)
+    : configuration_(configuration)
+{
+    init_from_file();
+}
+
+
+void ControlThread::init_from_file()
+{
+    ControlThread::me = this;
+
+    /* the class will handle signals */
+    signal(SIGINT, ControlThread::handle_signal);
+    signal(SIGTERM, ControlThread::handle_signal);
+    signal(SIGHUP, ControlThread::handle_signal);
+
     // Basic configuration checks
     auto aux = std::dynamic_pointer_cast<FileConfiguration>(configuration_);
     conf_file_has_section_ = aux->has_section();
@@ -442,13 +457,31 @@ int ControlThread::run()
 #endif
     // Main loop to read and process the control messages
     pmt::pmt_t msg;
+    std::vector<pmt::pmt_t> pending_msgs;
     while (flowgraph_->running() && !stop_)
         {
             // read event messages, triggered by event signaling with a 100 ms timeout to perform low priority receiver management tasks
             bool valid_event = control_queue_->timed_wait_and_pop(msg, 100);
             // call the new sat dispatcher and receiver controller
             event_dispatcher(valid_event, msg);
+            if (valid_event)
+                {
+                    // process the messages queued in the meantime (e.g., bursts of channel events) in a single batch
+                    control_queue_->drain(pending_msgs);
+                    for (auto &pending_msg : pending_msgs)
+                        {
+                            if (stop_)
+                                {
+                                    break;
+                                }
+                            event_dispatcher(valid_event, pending_msg);
+                        }
+                    pending_msgs.clear();
+                }
         }
+    const auto queue_stats = control_queue_->stats();
+    LOG(INFO) << "Control queue: " << queue_stats.popped << " messages, maximum depth " << queue_stats.max_depth
+              << ", mean latency " << queue_stats.mean_latency_s * 1e3 << " ms, maximum latency " << queue_stats.max_latency_s * 1e3 << " ms";
     std::cout << "Stopping GNSS-SDR, please wait!\n";
     flowgraph_->stop();
     stop_ = true;
@@ -1247,6 +1280,12 @@ void ControlThread::sysv_queue_listener()
                             read_queue = false;
                         }
                 }
+            else if (errno == EIDRM || errno == EINVAL)
+                {
+                    // The queue is shared by all the receivers in the host, and
+                    // it is removed by the first one that ends
+                    read_queue = false;
+                }
         }
 }
 
@@ -51,6 +51,7 @@
 
 
 class ConfigurationInterface;
+class FileConfiguration;
 class GNSSFlowgraph;
 class Gnss_Satellite;
 
@@ -77,6 +78,14 @@ public:
      */
     explicit ControlThread(std::shared_ptr<ConfigurationInterface> configuration);
 
+    /*!
+     * \brief Constructor that uses a configuration file already read,
+     * with the same checks as the default constructor
+     *
+     * \param[in] configuration Pointer to a FileConfiguration
+     */
+    explicit ControlThread(const std::shared_ptr<FileConfiguration> &configuration);
+
     /*!
      * \brief Destructor
      */
@@ -132,6 +141,8 @@ private:
 
     void init();
 
+    void init_from_file();
+
     void apply_action(unsigned int what);
 
     /*
@@ -27,14 +27,19 @@
 #include "Galileo_E5a.h"
 #include "Galileo_E5b.h"
 #include "Galileo_E6.h"
+#include "acquisition_code_cache.h"
+#include "acquisition_thread_pool.h"
 #include "channel.h"
 #include "channel_fsm.h"
 #include "channel_interface.h"
 #include "configuration_interface.h"
+#include "dll_pll_veml_tracking_bank.h"
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
 #include "gnss_sdr_make_unique.h"
+#include "gnss_synchro_epoch.h"
+#include "gnss_synchro_epoch_to_channels.h"
 #include "gnss_synchro_monitor.h"
 #include "nav_message_monitor.h"
 #include "signal_source_interface.h"
@@ -95,6 +100,7 @@ GNSSFlowgraph::~GNSSFlowgraph()
         {
             GNSSFlowgraph::disconnect();
         }
+    Acquisition_Thread_Pool::instance().stop();
 }
 
 
@@ -119,6 +125,30 @@ void GNSSFlowgraph::init()
             galileo_tow_map_ = nullptr;
         }
 
+    // 0. start the receiver-wide acquisition thread pool, if requested
+    const auto acq_pool_threads = configuration_->property("GNSS-SDR.acquisition_threads", 0U);
+    if (acq_pool_threads > 0)
+        {
+            const auto acq_pool_queue_size = configuration_->property("GNSS-SDR.acquisition_queue_size", 2U * static_cast<uint32_t>(configuration_->property("Channels.in_acquisition", 1)) + acq_pool_threads);
+            std::vector<int> acq_pool_affinity;
+            for (const auto& cpu : split_string(configuration_->property("GNSS-SDR.acquisition_threads_affinity", std::string("")), ','))
+                {
+                    try
+                        {
+                            acq_pool_affinity.push_back(std::stoi(cpu));
+                        }
+                    catch (const std::exception& e)
+                        {
+                            LOG(WARNING) << "Ignoring invalid core in GNSS-SDR.acquisition_threads_affinity: " << cpu;
+                        }
+                }
+            Acquisition_Thread_Pool::instance().start(acq_pool_threads, acq_pool_queue_size, acq_pool_affinity);
+        }
+
+    // Memory bound of the receiver-wide cache of acquisition code spectra (0 disables it)
+    const auto acq_code_cache_mb = configuration_->property("GNSS-SDR.acquisition_code_cache_mb", 0U);
+    Acquisition_Code_Cache::instance().set_capacity(static_cast<size_t>(acq_code_cache_mb) * 1024 * 1024);
+
     // 1. read the number of RF front-ends available (one file_source per RF front-end)
     int sources_count_deprecated = configuration_->property("Receiver.sources_count", 1);
     sources_count_ = configuration_->property("GNSS-SDR.num_sources", sources_count_deprecated);
@@ -174,6 +204,11 @@ void GNSSFlowgraph::init()
             channels_.push_back(std::dynamic_pointer_cast<ChannelInterface>(chan_));
         }
 
+    if (!enable_fpga_offloading_)
+        {
+            create_tracking_banks();
+        }
+
     top_block_ = gr::make_top_block("GNSSFlowgraph");
 
     mapStringValues_["1C"] = evGPS_1C;
@@ -211,10 +246,12 @@ void GNSSFlowgraph::init()
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
             // Instantiate monitor object
+            GnssSynchroEpochToChannels_ = gnss_synchro_epoch_make_to_channels(channels_count_);
             GnssSynchroMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("Monitor.decimation_factor", 1),
                 configuration_->property("Monitor.udp_port", 1234),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("Monitor.udp_queue_size", 0U));
         }
 
     /*
@@ -237,7 +274,8 @@ void GNSSFlowgraph::init()
             GnssSynchroAcquisitionMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("AcquisitionMonitor.decimation_factor", 1),
                 configuration_->property("AcquisitionMonitor.udp_port", 1235),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("AcquisitionMonitor.udp_queue_size", 0U));
         }
 
     /*
@@ -260,7 +298,8 @@ void GNSSFlowgraph::init()
             GnssSynchroTrackingMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("TrackingMonitor.decimation_factor", 1),
                 configuration_->property("TrackingMonitor.udp_port", 1236),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("TrackingMonitor.udp_queue_size", 0U));
         }
 
     /*
@@ -274,7 +313,8 @@ void GNSSFlowgraph::init()
             std::vector<std::string> udp_addr_vec = split_string(address_string, '_');
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
-            NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237));
+            NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237),
+                configuration_->property("NavDataMonitor.udp_queue_size", 0U));
         }
 }
 
@@ -324,6 +364,7 @@ void GNSSFlowgraph::stop()
             top_block_->wait();
         }
 
+    Acquisition_Thread_Pool::instance().stop();
     running_ = false;
 }
 
@@ -468,6 +509,11 @@ int GNSSFlowgraph::connect_desktop_flowgraph()
 
     check_signal_conditioners();
 
+    if (configuration_->property("GNSS-SDR.acquisition_code_cache_prewarm", false))
+        {
+            prewarm_acquisition_code_cache();
+        }
+
     if (assign_channels() != 0)
         {
             return 1;
@@ -506,8 +552,7 @@ int GNSSFlowgraph::connect_desktop_flowgraph()
                     if (enable_fpga_offloading_)
                         {
                             // create a task for the FPGA such that it doesn't stop the flow
-                            std::thread tmp_thread(&ChannelInterface::start_acquisition, channels_[i]);
-                            tmp_thread.detach();
+                            start_acquisition_task(channels_[i]);
                         }
                     else
                         {
@@ -1012,6 +1057,7 @@ int GNSSFlowgraph::connect_signal_sources_to_signal_conditioners()
 
 int GNSSFlowgraph::connect_signal_conditioners_to_channels()
 {
+    std::vector<gr::basic_block_sptr> connected_trk_blocks;
     for (int i = 0; i < channels_count_; i++)
         {
             int selected_signal_conditioner_ID = 0;
@@ -1137,8 +1183,14 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                             top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
                                 channels_.at(i)->get_left_block_acq(), 0);
                         }
-                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
-                        channels_.at(i)->get_left_block_trk(), 0);
+                    // Channels in a tracking bank share its input
+                    const auto trk_left_block = channels_.at(i)->get_left_block_trk();
+                    if (std::find(connected_trk_blocks.cbegin(), connected_trk_blocks.cend(), trk_left_block) == connected_trk_blocks.cend())
+                        {
+                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                trk_left_block, 0);
+                            connected_trk_blocks.push_back(trk_left_block);
+                        }
                 }
             catch (const std::exception& e)
                 {
@@ -1177,12 +1229,19 @@ int GNSSFlowgraph::connect_channels_to_observables()
 
 int GNSSFlowgraph::connect_observables_to_pvt()
 {
-    // Connect the observables output of each channel to the PVT block
+    if (channels_count_ > static_cast<int>(Gnss_Synchro_Epoch::MAX_CHANNELS))
+        {
+            help_hint_ += " * The total number of channels is set to " + std::to_string(channels_count_) + ",\n";
+            help_hint_ += " but the Observables block supports up to " + std::to_string(Gnss_Synchro_Epoch::MAX_CHANNELS) + " channels.\n";
+            help_hint_ += " Please reduce the number of channels in your configuration file.\n";
+            return 1;
+        }
+    // Connect the observables of all the channels, delivered in a single stream, to the PVT block
     try
         {
+            top_block_->connect(observables_->get_right_block(), 0, pvt_->get_left_block(), 0);
             for (int i = 0; i < channels_count_; i++)
                 {
-                    top_block_->connect(observables_->get_right_block(), i, pvt_->get_left_block(), i);
                     top_block_->msg_connect(channels_.at(i)->get_right_block(), pmt::mp("telemetry"), pvt_->get_left_block(), pmt::mp("telemetry"));
                     // experimental Vector Tracking Loop (VTL) messages from PVT to Tracking blocks
                     // not supported by all tracking algorithms
@@ -1218,9 +1277,11 @@ int GNSSFlowgraph::connect_gnss_synchro_monitor()
 {
     try
         {
+            // the monitor works with one Gnss_Synchro stream per channel
+            top_block_->connect(observables_->get_right_block(), 0, GnssSynchroEpochToChannels_, 0);
             for (int i = 0; i < channels_count_; i++)
                 {
-                    top_block_->connect(observables_->get_right_block(), i, GnssSynchroMonitor_, i);
+                    top_block_->connect(GnssSynchroEpochToChannels_, i, GnssSynchroMonitor_, i);
                 }
         }
     catch (const std::exception& e)
@@ -1260,7 +1321,9 @@ int GNSSFlowgraph::connect_tracking_monitor()
         {
             for (int i = 0; i < channels_count_; i++)
                 {
-                    top_block_->connect(channels_.at(i)->get_right_block_trk(), 0, GnssSynchroTrackingMonitor_, i);
+                    const auto channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
+                    const int32_t trk_port = channel_ptr ? channel_ptr->get_right_block_trk_port() : 0;
+                    top_block_->connect(channels_.at(i)->get_right_block_trk(), trk_port, GnssSynchroTrackingMonitor_, i);
                 }
         }
     catch (const std::exception& e)
@@ -1393,6 +1456,124 @@ void GNSSFlowgraph::check_signal_conditioners()
 }
 
 
+void GNSSFlowgraph::create_tracking_banks()
+{
+    // Channels of the same signal and RF channel with Tracking_XX.bank=true
+    // are tracked inside a single block
+    for (int i = 0; i < channels_count_; i++)
+        {
+            const std::string gnss_signal = channels_.at(i)->get_signal().get_signal_str();
+            if (!configuration_->property("Tracking_" + gnss_signal + ".bank", false))
+                {
+                    continue;
+                }
+            const auto channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
+#if GNURADIO_USES_STD_POINTERS
+            const auto trk = std::dynamic_pointer_cast<dll_pll_veml_tracking>(channels_.at(i)->get_right_block_trk());
+#else
+            const auto trk = boost::dynamic_pointer_cast<dll_pll_veml_tracking>(channels_.at(i)->get_right_block_trk());
+#endif
+            if (channel_ptr == nullptr || trk == nullptr)
+                {
+                    LOG(WARNING) << "Tracking_" << gnss_signal << ".bank requires a DLL/PLL tracking implementation. Channel " << i << " is not banked.";
+                    continue;
+                }
+            int rf_channel_id = configuration_->property("Channels_" + gnss_signal + ".RF_channel_ID", 0);
+            rf_channel_id = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", rf_channel_id);
+            const std::string bank_key = gnss_signal + std::to_string(rf_channel_id);
+            if (tracking_banks_.count(bank_key) == 0)
+                {
+                    tracking_banks_[bank_key] = dll_pll_veml_make_tracking_bank(configuration_->property("Tracking_" + gnss_signal + ".bank_block_samples", 0U));
+                }
+#if GNURADIO_USES_STD_POINTERS
+            const auto bank = std::dynamic_pointer_cast<dll_pll_veml_tracking_bank>(tracking_banks_.at(bank_key));
+#else
+            const auto bank = boost::dynamic_pointer_cast<dll_pll_veml_tracking_bank>(tracking_banks_.at(bank_key));
+#endif
+            channel_ptr->set_tracking_bank(bank, bank->add_channel(trk));
+        }
+    for (const auto& bank : tracking_banks_)
+        {
+            LOG(INFO) << "Tracking bank for signal " << bank.first.substr(0, 2) << " in RF channel " << bank.first.substr(2) << " created";
+        }
+}
+
+
+void GNSSFlowgraph::prewarm_acquisition_code_cache()
+{
+    // Compute the code spectra of all the satellites, once per signal, so that
+    // later satellite assignments only need to look them up
+    if (!Acquisition_Code_Cache::instance().enabled())
+        {
+            LOG(WARNING) << "GNSS-SDR.acquisition_code_cache_prewarm requires GNSS-SDR.acquisition_code_cache_mb > 0";
+            return;
+        }
+    std::set<std::string> prewarmed_signals;
+    for (int i = 0; i < channels_count_; i++)
+        {
+            const Gnss_Signal initial_signal = channels_.at(i)->get_signal();
+            const std::string gnss_signal = initial_signal.get_signal_str();
+            if (!prewarmed_signals.insert(gnss_signal).second)
+                {
+                    continue;
+                }
+            const std::list<Gnss_Signal>* available_signals = nullptr;
+            switch (mapStringValues_[gnss_signal])
+                {
+                case evGPS_1C:
+                    available_signals = &available_GPS_1C_signals_;
+                    break;
+                case evGPS_2S:
+                    available_signals = &available_GPS_2S_signals_;
+                    break;
+                case evGPS_L5:
+                    available_signals = &available_GPS_L5_signals_;
+                    break;
+                case evSBAS_1C:
+                    available_signals = &available_SBAS_1C_signals_;
+                    break;
+                case evGAL_1B:
+                    available_signals = &available_GAL_1B_signals_;
+                    break;
+                case evGAL_5X:
+                    available_signals = &available_GAL_5X_signals_;
+                    break;
+                case evGAL_7X:
+                    available_signals = &available_GAL_7X_signals_;
+                    break;
+                case evGAL_E6:
+                    available_signals = &available_GAL_E6_signals_;
+                    break;
+                case evGLO_1G:
+                    available_signals = &available_GLO_1G_signals_;
+                    break;
+                case evGLO_2G:
+                    available_signals = &available_GLO_2G_signals_;
+                    break;
+                case evBDS_B1:
+                    available_signals = &available_BDS_B1_signals_;
+                    break;
+                case evBDS_B3:
+                    available_signals = &available_BDS_B3_signals_;
+                    break;
+                default:
+                    break;
+                }
+            if (available_signals == nullptr)
+                {
+                    continue;
+                }
+            for (const auto& sig : *available_signals)
+                {
+                    channels_.at(i)->set_signal(sig);
+                }
+            channels_.at(i)->set_signal(initial_signal);
+        }
+    LOG(INFO) << "Acquisition code cache pre-warmed with " << Acquisition_Code_Cache::instance().entries()
+              << " code spectra (" << Acquisition_Code_Cache::instance().size_bytes() << " bytes)";
+}
+
+
 int GNSSFlowgraph::assign_channels()
 {
     // Put channels fixed to a given satellite at the beginning of the vector, then the rest
@@ -1859,8 +2040,7 @@ void GNSSFlowgraph::acquisition_manager(unsigned int who)
                             if (enable_fpga_offloading_)
                                 {
                                     // create a task for the FPGA such that it doesn't stop the flow
-                                    std::thread tmp_thread(&ChannelInterface::start_acquisition, channels_[current_channel]);
-                                    tmp_thread.detach();
+                                    start_acquisition_task(channels_[current_channel]);
                                 }
                             else
                                 {
@@ -1972,8 +2152,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                     if (enable_fpga_offloading_)
                         {
                             // create a task for the FPGA such that it doesn't stop the flow
-                            std::thread tmp_thread(&ChannelInterface::start_acquisition, channels_[who]);
-                            tmp_thread.detach();
+                            start_acquisition_task(channels_[who]);
                         }
                     else
                         {
@@ -2111,8 +2290,7 @@ void GNSSFlowgraph::start_acquisition_helper()
                     if (enable_fpga_offloading_)
                         {
                             // create a task for the FPGA such that it doesn't stop the flow
-                            std::thread tmp_thread(&ChannelInterface::start_acquisition, channels_[i]);
-                            tmp_thread.detach();
+                            start_acquisition_task(channels_[i]);
                         }
                     else
                         {
@@ -2126,6 +2304,16 @@ void GNSSFlowgraph::start_acquisition_helper()
 }
 
 
+void GNSSFlowgraph::start_acquisition_task(const std::shared_ptr<ChannelInterface>& channel)
+{
+    if (!Acquisition_Thread_Pool::instance().try_submit([channel]() { channel->start_acquisition(); }))
+        {
+            std::thread tmp_thread(&ChannelInterface::start_acquisition, channel);
+            tmp_thread.detach();
+        }
+}
+
+
 void GNSSFlowgraph::perform_hw_reset()
 {
     // a stop acquisition command causes the SW to reset the HW
@@ -188,10 +188,13 @@ private:
 #if ENABLE_FPGA
     int connect_fpga_flowgraph();
     int connect_fpga_sample_counter();
+    void start_acquisition_task(const std::shared_ptr<ChannelInterface>& channel);
 #endif
 
     int assign_channels();
     void check_signal_conditioners();
+    void prewarm_acquisition_code_cache();
+    void create_tracking_banks();
 
     void set_signals_list();
     void set_channels_state();  // Initializes the channels state (start acquisition or keep standby)
@@ -225,8 +228,10 @@ private:
     std::shared_ptr<GNSSBlockInterface> pvt_;
 
     std::map<std::string, gr::basic_block_sptr> acq_resamplers_;
+    std::map<std::string, gr::basic_block_sptr> tracking_banks_;
     std::vector<gr::blocks::null_sink::sptr> null_sinks_;
 
+    gr::basic_block_sptr GnssSynchroEpochToChannels_;  // splits the Observables output for the monitor
     gr::basic_block_sptr GnssSynchroMonitor_;
     gr::basic_block_sptr GnssSynchroAcquisitionMonitor_;
     gr::basic_block_sptr GnssSynchroTrackingMonitor_;
@@ -76,6 +76,7 @@ constexpr int32_t GALILEO_CNAV_OCTETS_IN_SUBPAGE = 53;                  // HAS S
 constexpr int32_t GALILEO_CNAV_INFORMATION_VECTOR_LENGTH = 32;          // HAS SIS ICD 1.0 Section 6.2 Reed-Solomon Code
 
 constexpr int32_t GALILEO_CNAV_BITS_FOR_CRC = GALILEO_CNAV_HAS_PAGE_DATA_BITS + GALILEO_CNAV_PAGE_RESERVED_BITS;  // 462
+constexpr int32_t GALILEO_CNAV_PAGE_BITS = (GALILEO_CNAV_SYMBOLS_PER_PAGE - GALILEO_CNAV_PREAMBLE_LENGTH_BITS) / 2;  // 492, decoded bits including the tail
 
 constexpr int32_t HAS_MSG_NUMBER_MASK_IDS = 32;       // HAS SIS ICD 1.0 Table 13
 constexpr int32_t HAS_MSG_NUMBER_GNSS_IDS = 16;       // HAS SIS ICD 1.0 Table 18
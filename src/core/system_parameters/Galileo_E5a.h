@@ -64,6 +64,7 @@ constexpr int32_t GALILEO_FNAV_PAGE_TYPE_BITS = 6;
 
 constexpr int32_t GALILEO_FNAV_DATA_FRAME_BITS = 214;
 constexpr int32_t GALILEO_FNAV_DATA_FRAME_BYTES = 27;
+constexpr int32_t GALILEO_FNAV_PAGE_BITS = 244;  // decoded bits of a page: data (214), CRC (24) and tail (6)
 
 constexpr char GALILEO_FNAV_PREAMBLE[13] = "101101110000";
 
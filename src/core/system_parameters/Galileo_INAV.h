@@ -46,6 +46,9 @@ constexpr int32_t GALILEO_PAGE_TYPE_BITS = 6;
 constexpr int32_t GALILEO_DATA_JK_BITS = 128;
 constexpr int32_t GALILEO_DATA_FRAME_BITS = 196;
 constexpr int32_t GALILEO_DATA_FRAME_BYTES = 25;
+constexpr int32_t GALILEO_INAV_PAGE_PART_BITS = 120;       // decoded bits of a page part, including the tail
+constexpr int32_t GALILEO_INAV_EVEN_PAGE_PART_BITS = 114;  // bits of the even page part joined to the odd one
+constexpr int32_t GALILEO_INAV_PAGE_BITS = 234;            // even (without tail) + odd page parts
 constexpr char GALILEO_INAV_PREAMBLE[11] = "0101100000";
 
 const std::vector<std::pair<int32_t, int32_t>> TYPE({{1, 6}});
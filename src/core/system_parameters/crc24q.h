@@ -0,0 +1,364 @@
+/*!
+ * \file crc24q.h
+ * \brief Table-driven and carry-less multiplication computation of the
+ * Qualcomm CRC-24Q used by Galileo, GPS CNAV, SBAS and RTCM 3
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CRC24Q_H
+#define GNSS_SDR_CRC24Q_H
+
+#include "nav_page_bits.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GNSS_SDR_CRC24Q_PCLMUL 1
+#include <cpuid.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define GNSS_SDR_CRC24Q_PMULL 1
+#include <arm_neon.h>
+#endif
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Computes the CRC-24Q (generator polynomial 0x1864CFB, zero initial
+ * value, no reflection and no final XOR).
+ *
+ * Short messages, as navigation pages, are processed eight bytes at a time
+ * with eight lookup tables (slicing-by-8). Messages of at least
+ * CLMUL_MIN_BYTES bytes, as RTCM frames, are folded 64 bytes at a time with
+ * carry-less multiplications when the processor provides them (PCLMULQDQ on
+ * x86, PMULL on ARMv8 with the Crypto extension).
+ */
+class Crc24q
+{
+public:
+    static constexpr std::size_t CLMUL_MIN_BYTES = 64;
+
+    /*!
+     * \brief CRC-24Q of len bytes
+     */
+    static uint32_t checksum(const uint8_t* data, std::size_t len)
+    {
+#if GNSS_SDR_CRC24Q_PCLMUL
+        if (len >= CLMUL_MIN_BYTES && has_clmul())
+            {
+                return checksum_clmul(data, len);
+            }
+#elif GNSS_SDR_CRC24Q_PMULL
+        if (len >= CLMUL_MIN_BYTES)
+            {
+                return checksum_clmul(data, len);
+            }
+#endif
+        return checksum_table(data, len);
+    }
+
+    /*!
+     * \brief CRC-24Q of the len bits of a page starting at pos, padded with
+     * zeros at the start to complete a byte, as the Galileo and GPS CNAV
+     * messages define it
+     */
+    template <std::size_t N>
+    static uint32_t checksum(const Nav_Page_Bits<N>& bits, std::size_t pos, std::size_t len)
+    {
+        const Tables& t = tables();
+        uint32_t crc = 0;
+        const std::size_t head = len % 8;  // zero padding does not change the CRC
+        if (head != 0)
+            {
+                crc = update_byte(crc, static_cast<uint8_t>(bits.read(pos, head)), t);
+                pos += head;
+                len -= head;
+            }
+        while (len >= 64)
+            {
+                crc = update_word(crc, bits.read(pos, 64), t);
+                pos += 64;
+                len -= 64;
+            }
+        while (len > 0)
+            {
+                crc = update_byte(crc, static_cast<uint8_t>(bits.read(pos, 8)), t);
+                pos += 8;
+                len -= 8;
+            }
+        return crc;
+    }
+
+    /*!
+     * \brief CRC-24Q of len bytes with the slicing-by-8 tables, continuing
+     * from a previous crc
+     */
+    static uint32_t checksum_table(const uint8_t* data, std::size_t len, uint32_t crc = 0)
+    {
+        const Tables& t = tables();
+        while (len >= 8)
+            {
+                uint64_t word = 0ULL;
+                for (int i = 0; i < 8; i++)
+                    {
+                        word = (word << 8) | data[i];
+                    }
+                crc = update_word(crc, word, t);
+                data += 8;
+                len -= 8;
+            }
+        while (len > 0)
+            {
+                crc = update_byte(crc, *data, t);
+                data++;
+                len--;
+            }
+        return crc;
+    }
+
+#if GNSS_SDR_CRC24Q_PCLMUL
+    /*!
+     * \brief True if the processor provides PCLMULQDQ and SSSE3
+     */
+    static bool has_clmul()
+    {
+        static const bool available = []() {
+            unsigned int eax = 0;
+            unsigned int ebx = 0;
+            unsigned int ecx = 0;
+            unsigned int edx = 0;
+            return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_PCLMUL) != 0 && (ecx & bit_SSSE3) != 0;
+        }();
+        return available;
+    }
+
+    /*!
+     * \brief CRC-24Q of at least 16 bytes with PCLMULQDQ. Check has_clmul()
+     * before calling it.
+     */
+    __attribute__((target("pclmul,ssse3"))) static uint32_t checksum_clmul(const uint8_t* data, std::size_t len)
+    {
+        const Tables& t = tables();
+        const __m128i byte_swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const __m128i fold_1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.fold_1.data()));
+        const __m128i fold_4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.fold_4.data()));
+        const __m128i reduce = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.reduce.data()));
+
+        // the first block is padded with zeros at the start
+        const std::size_t head = len % 16 == 0 ? 16 : len % 16;
+        std::array<uint8_t, 16> first{};
+        std::memcpy(first.data() + 16 - head, data, head);
+        __m128i x = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first.data())), byte_swap);
+        data += head;
+        len -= head;
+
+        if (len >= 48)
+            {
+                // four independent accumulators, 64 bytes apart
+                __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), byte_swap);
+                __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), byte_swap);
+                __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), byte_swap);
+                data += 48;
+                len -= 48;
+                while (len >= 64)
+                    {
+                        x = _mm_xor_si128(fold_sse(x, fold_4), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), byte_swap));
+                        x1 = _mm_xor_si128(fold_sse(x1, fold_4), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), byte_swap));
+                        x2 = _mm_xor_si128(fold_sse(x2, fold_4), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), byte_swap));
+                        x3 = _mm_xor_si128(fold_sse(x3, fold_4), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), byte_swap));
+                        data += 64;
+                        len -= 64;
+                    }
+                x = _mm_xor_si128(fold_sse(x, fold_1), x1);
+                x = _mm_xor_si128(fold_sse(x, fold_1), x2);
+                x = _mm_xor_si128(fold_sse(x, fold_1), x3);
+            }
+        while (len >= 16)
+            {
+                x = _mm_xor_si128(fold_sse(x, fold_1), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), byte_swap));
+                data += 16;
+                len -= 16;
+            }
+
+        // 128 to 88 bits, and then to 64 bits, keeping the remainder modulo the polynomial
+        x = _mm_xor_si128(_mm_clmulepi64_si128(x, reduce, 0x01), _mm_move_epi64(x));
+        x = _mm_xor_si128(_mm_clmulepi64_si128(x, reduce, 0x01), _mm_move_epi64(x));
+        return update_word(0, static_cast<uint64_t>(_mm_cvtsi128_si64(x)), t);
+    }
+#endif
+
+#if GNSS_SDR_CRC24Q_PMULL
+    /*!
+     * \brief CRC-24Q of at least 16 bytes with PMULL
+     */
+    static uint32_t checksum_clmul(const uint8_t* data, std::size_t len)
+    {
+        const Tables& t = tables();
+        const uint64x2_t fold_1 = vld1q_u64(t.fold_1.data());
+        const uint64x2_t fold_4 = vld1q_u64(t.fold_4.data());
+        const uint64x2_t reduce = vld1q_u64(t.reduce.data());
+
+        // the first block is padded with zeros at the start
+        const std::size_t head = len % 16 == 0 ? 16 : len % 16;
+        std::array<uint8_t, 16> first{};
+        std::memcpy(first.data() + 16 - head, data, head);
+        uint64x2_t x = load_neon(first.data());
+        data += head;
+        len -= head;
+
+        if (len >= 48)
+            {
+                // four independent accumulators, 64 bytes apart
+                uint64x2_t x1 = load_neon(data);
+                uint64x2_t x2 = load_neon(data + 16);
+                uint64x2_t x3 = load_neon(data + 32);
+                data += 48;
+                len -= 48;
+                while (len >= 64)
+                    {
+                        x = veorq_u64(fold_neon(x, fold_4), load_neon(data));
+                        x1 = veorq_u64(fold_neon(x1, fold_4), load_neon(data + 16));
+                        x2 = veorq_u64(fold_neon(x2, fold_4), load_neon(data + 32));
+                        x3 = veorq_u64(fold_neon(x3, fold_4), load_neon(data + 48));
+                        data += 64;
+                        len -= 64;
+                    }
+                x = veorq_u64(fold_neon(x, fold_1), x1);
+                x = veorq_u64(fold_neon(x, fold_1), x2);
+                x = veorq_u64(fold_neon(x, fold_1), x3);
+            }
+        while (len >= 16)
+            {
+                x = veorq_u64(fold_neon(x, fold_1), load_neon(data));
+                data += 16;
+                len -= 16;
+            }
+
+        // 128 to 88 bits, and then to 64 bits, keeping the remainder modulo the polynomial
+        const poly64_t k = vgetq_lane_p64(vreinterpretq_p64_u64(reduce), 0);
+        for (int i = 0; i < 2; i++)
+            {
+                const uint64x2_t high = vreinterpretq_u64_p128(vmull_p64(vgetq_lane_p64(vreinterpretq_p64_u64(x), 1), k));
+                x = veorq_u64(high, vsetq_lane_u64(0, x, 1));
+            }
+        return update_word(0, vgetq_lane_u64(x, 0), t);
+    }
+#endif
+
+private:
+    static constexpr uint32_t POLY = 0x864CFBU;  // x^24 is implicit
+    static constexpr uint32_t MASK = 0xFFFFFFU;
+
+    struct Tables
+    {
+        std::array<std::array<uint32_t, 256>, 8> slice;  // slice[k][b]: CRC of byte b followed by k zero bytes
+        std::array<uint64_t, 2> fold_1;                  // x^128 mod P, x^192 mod P
+        std::array<uint64_t, 2> fold_4;                  // x^512 mod P, x^576 mod P
+        std::array<uint64_t, 2> reduce;                  // x^64 mod P
+    };
+
+    static uint64_t x_pow_mod(int n)
+    {
+        uint32_t r = 1;
+        for (int i = 0; i < n; i++)
+            {
+                r = ((r << 1) ^ (POLY & (0U - (r >> 23)))) & MASK;
+            }
+        return r;
+    }
+
+    static const Tables& tables()
+    {
+        static const Tables t = []() {
+            Tables init{};
+            for (uint32_t b = 0; b < 256; b++)
+                {
+                    uint32_t crc = b << 16;
+                    for (int i = 0; i < 8; i++)
+                        {
+                            crc = (crc << 1) ^ (POLY & (0U - ((crc >> 23) & 1U)));
+                        }
+                    init.slice[0][b] = crc & MASK;
+                }
+            for (std::size_t k = 1; k < init.slice.size(); k++)
+                {
+                    for (uint32_t b = 0; b < 256; b++)
+                        {
+                            const uint32_t prev = init.slice[k - 1][b];
+                            init.slice[k][b] = ((prev << 8) & MASK) ^ init.slice[0][prev >> 16];
+                        }
+                }
+            init.fold_1 = {x_pow_mod(128), x_pow_mod(192)};
+            init.fold_4 = {x_pow_mod(512), x_pow_mod(576)};
+            init.reduce = {x_pow_mod(64), 0};
+            return init;
+        }();
+        return t;
+    }
+
+    static inline uint32_t update_byte(uint32_t crc, uint8_t byte, const Tables& t)
+    {
+        return ((crc << 8) & MASK) ^ t.slice[0][byte ^ (crc >> 16)];
+    }
+
+    // eight bytes, the first one in the most significant byte of word
+    static inline uint32_t update_word(uint32_t crc, uint64_t word, const Tables& t)
+    {
+        word ^= static_cast<uint64_t>(crc) << 40;
+        return t.slice[7][word >> 56] ^
+               t.slice[6][(word >> 48) & 0xFFU] ^
+               t.slice[5][(word >> 40) & 0xFFU] ^
+               t.slice[4][(word >> 32) & 0xFFU] ^
+               t.slice[3][(word >> 24) & 0xFFU] ^
+               t.slice[2][(word >> 16) & 0xFFU] ^
+               t.slice[1][(word >> 8) & 0xFFU] ^
+               t.slice[0][word & 0xFFU];
+    }
+
+#if GNSS_SDR_CRC24Q_PCLMUL
+    // x * x^128 modulo the polynomial, as hi * x^192 + lo * x^128
+    __attribute__((target("pclmul,ssse3"))) static inline __m128i fold_sse(__m128i x, __m128i k)
+    {
+        return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), _mm_clmulepi64_si128(x, k, 0x00));
+    }
+#endif
+
+#if GNSS_SDR_CRC24Q_PMULL
+    static inline uint64x2_t load_neon(const uint8_t* data)
+    {
+        // first byte in the most significant byte of the high lane
+        const uint8x16_t bytes = vrev64q_u8(vld1q_u8(data));
+        return vreinterpretq_u64_u8(vextq_u8(bytes, bytes, 8));
+    }
+
+    static inline uint64x2_t fold_neon(uint64x2_t x, uint64x2_t k)
+    {
+        const poly64x2_t xp = vreinterpretq_p64_u64(x);
+        const poly64x2_t kp = vreinterpretq_p64_u64(k);
+        const poly128_t high = vmull_high_p64(xp, kp);
+        const poly128_t low = vmull_p64(vgetq_lane_p64(xp, 0), vgetq_lane_p64(kp, 0));
+        return veorq_u64(vreinterpretq_u64_p128(high), vreinterpretq_u64_p128(low));
+    }
+#endif
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CRC24Q_H
@@ -17,11 +17,8 @@
  */
 
 #include "galileo_cnav_message.h"
-#include <boost/crc.hpp>             // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>  // for boost::dynamic_bitset
-#include <algorithm>                 // for reverse
+#include "crc24q.h"
 #include <limits>
-#include <vector>
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -29,49 +26,33 @@
 #include <absl/log/log.h>
 #endif
 
-using CRC_Galileo_CNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
 
-
-bool Galileo_Cnav_Message::CRC_test(const std::bitset<GALILEO_CNAV_BITS_FOR_CRC>& bits, uint32_t checksum) const
+bool Galileo_Cnav_Message::CRC_test(const Galileo_Cnav_Page& bits, uint32_t checksum) const
 {
-    CRC_Galileo_CNAV_type crc_galileo_e6b;
-
-    // Galileo CNAV frame for CRC is not an integer multiple of bytes
-    // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    boost::dynamic_bitset<uint8_t> frame_bits(bits.to_string());
-
-    std::vector<uint8_t> bytes;
-    bytes.reserve(GALILEO_CNAV_BYTES_FOR_CRC);
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
+    // Galileo CNAV frame for CRC is not an integer multiple of bytes,
+    // it is taken as filled with zeroes at the start of the frame.
+    const uint32_t crc_computed = Crc24q::checksum(bits, 0, GALILEO_CNAV_BITS_FOR_CRC);
+    return checksum == crc_computed;
+}
 
-    crc_galileo_e6b.process_bytes(bytes.data(), GALILEO_CNAV_BYTES_FOR_CRC);
 
-    const uint32_t crc_computed = crc_galileo_e6b.checksum();
-    if (checksum == crc_computed)
-        {
-            return true;
-        }
-    return false;
+void Galileo_Cnav_Message::read_HAS_page(const std::string& page_string)
+{
+    read_HAS_page(Galileo_Cnav_Page(page_string));
 }
 
 
-void Galileo_Cnav_Message::read_HAS_page(const std::string& page_string)
+void Galileo_Cnav_Message::read_HAS_page(const Galileo_Cnav_Page& page)
 {
-    const std::string has_page_bits = page_string.substr(0, GALILEO_CNAV_BITS_FOR_CRC);
-    const std::string CRC_data = page_string.substr(GALILEO_CNAV_BITS_FOR_CRC, GALILEO_CNAV_CRC_LENGTH);
-    const std::bitset<GALILEO_CNAV_BITS_FOR_CRC> Word_for_CRC_bits(has_page_bits);
-    const std::bitset<GALILEO_CNAV_CRC_LENGTH> checksum(CRC_data);
+    const auto checksum = static_cast<uint32_t>(page.read(GALILEO_CNAV_BITS_FOR_CRC, GALILEO_CNAV_CRC_LENGTH));
     d_new_HAS_page = false;
     has_page = Galileo_HAS_page();
     has_page.tow = std::numeric_limits<uint32_t>::max();  // Unknown
-    d_flag_CRC_test = CRC_test(Word_for_CRC_bits, checksum.to_ulong());
+    d_flag_CRC_test = CRC_test(page, checksum);
     if (d_flag_CRC_test == true)
         {
             // CRC correct: Read 24 bits of HAS page header
-            read_HAS_page_header(page_string.substr(GALILEO_CNAV_PAGE_RESERVED_BITS, GALILEO_CNAV_PAGE_HEADER_BITS));
+            read_HAS_page_header(page);
             bool use_has = false;
             d_test_mode = false;
             // HAS status as defined in HAS SIS ICD v1.0 Table 9 - HASS values and corresponding semantic
@@ -95,7 +76,7 @@ void Galileo_Cnav_Message::read_HAS_page(const std::string& page_string)
             if (use_has or d_page_dummy)
                 {
                     // Store the 424 bits of encoded data (CNAV page) and the page header
-                    has_page.has_message_string = page_string.substr(GALILEO_CNAV_PAGE_RESERVED_BITS + GALILEO_CNAV_PAGE_HEADER_BITS, GALILEO_CNAV_MESSAGE_BITS_PER_PAGE);
+                    has_page.has_message_string = page.to_string(GALILEO_CNAV_PAGE_RESERVED_BITS + GALILEO_CNAV_PAGE_HEADER_BITS, GALILEO_CNAV_MESSAGE_BITS_PER_PAGE);
                     if (!d_page_dummy)
                         {
                             has_page.has_status = d_has_page_status;
@@ -111,10 +92,10 @@ void Galileo_Cnav_Message::read_HAS_page(const std::string& page_string)
 }
 
 
-void Galileo_Cnav_Message::read_HAS_page_header(const std::string& page_string)
+void Galileo_Cnav_Message::read_HAS_page_header(const Galileo_Cnav_Page& page)
 {
     // check if dummy
-    if (page_string == "101011110011101111000011")  // Equivalent to AF3BC3
+    if (page.read(GALILEO_CNAV_PAGE_RESERVED_BITS, GALILEO_CNAV_PAGE_HEADER_BITS) == 0xAF3BC3)
         {
             d_page_dummy = true;
             DLOG(INFO) << "HAS page with dummy header received.";
@@ -126,15 +107,14 @@ void Galileo_Cnav_Message::read_HAS_page_header(const std::string& page_string)
     if (!d_page_dummy)
         {
             // HAS SIS ICD v1.0 Table 7: HAS page header
-            const std::bitset<GALILEO_CNAV_PAGE_HEADER_BITS> has_page_header(page_string);
-            d_has_page_status = read_has_page_header_parameter(has_page_header, GALILEO_HAS_STATUS);
-            d_has_reserved = read_has_page_header_parameter(has_page_header, GALILEO_HAS_RESERVED);
-            d_received_message_type = read_has_page_header_parameter(has_page_header, GALILEO_HAS_MESSAGE_TYPE);
-            d_received_message_id = read_has_page_header_parameter(has_page_header, GALILEO_HAS_MESSAGE_ID);
-            d_received_message_size = read_has_page_header_parameter(has_page_header, GALILEO_HAS_MESSAGE_SIZE) + 1;  // "0" means 1
-            d_received_message_page_id = read_has_page_header_parameter(has_page_header, GALILEO_HAS_MESSAGE_PAGE_ID);
-
-            DLOG(INFO) << "HAS page header received " << page_string << ":\n"
+            d_has_page_status = read_has_page_header_parameter(page, GALILEO_HAS_STATUS);
+            d_has_reserved = read_has_page_header_parameter(page, GALILEO_HAS_RESERVED);
+            d_received_message_type = read_has_page_header_parameter(page, GALILEO_HAS_MESSAGE_TYPE);
+            d_received_message_id = read_has_page_header_parameter(page, GALILEO_HAS_MESSAGE_ID);
+            d_received_message_size = read_has_page_header_parameter(page, GALILEO_HAS_MESSAGE_SIZE) + 1;  // "0" means 1
+            d_received_message_page_id = read_has_page_header_parameter(page, GALILEO_HAS_MESSAGE_PAGE_ID);
+
+            DLOG(INFO) << "HAS page header received " << page.to_string(GALILEO_CNAV_PAGE_RESERVED_BITS, GALILEO_CNAV_PAGE_HEADER_BITS) << ":\n"
                        << "d_has_page_status: " << static_cast<float>(d_has_page_status) << "\n"
                        << "d_has_reserved: " << static_cast<float>(d_has_reserved) << "\n"
                        << "d_received_message_type: " << static_cast<float>(d_received_message_type) << "\n"
@@ -145,16 +125,8 @@ void Galileo_Cnav_Message::read_HAS_page_header(const std::string& page_string)
 }
 
 
-uint8_t Galileo_Cnav_Message::read_has_page_header_parameter(const std::bitset<GALILEO_CNAV_PAGE_HEADER_BITS>& bits, const std::pair<int32_t, int32_t>& parameter) const
+uint8_t Galileo_Cnav_Message::read_has_page_header_parameter(const Galileo_Cnav_Page& page, const std::pair<int32_t, int32_t>& parameter) const
 {
-    uint8_t value = 0U;
-    for (int j = 0; j < parameter.second; j++)
-        {
-            value <<= 1U;  // shift left
-            if (static_cast<int>(bits[GALILEO_CNAV_PAGE_HEADER_BITS - parameter.first - j]) == 1)
-                {
-                    value += 1;  // insert the bit
-                }
-        }
-    return value;
+    // parameter.first is counted from 1 at the start of the page header
+    return static_cast<uint8_t>(page.read(GALILEO_CNAV_PAGE_RESERVED_BITS + parameter.first - 1, parameter.second));
 }
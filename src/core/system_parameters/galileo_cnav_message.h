@@ -21,7 +21,7 @@
 
 #include "Galileo_CNAV.h"
 #include "galileo_has_page.h"
-#include <bitset>
+#include "nav_page_bits.h"
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -32,6 +32,9 @@
  * \{ */
 
 
+using Galileo_Cnav_Page = Nav_Page_Bits<GALILEO_CNAV_PAGE_BITS>;
+
+
 /*!
  * \brief This class handles the Galileo CNAV Data message, as described in the
  * Galileo High Accuracy Service Signal-In-Space Interface Control Document
@@ -42,6 +45,7 @@ class Galileo_Cnav_Message
 public:
     Galileo_Cnav_Message() = default;
 
+    void read_HAS_page(const Galileo_Cnav_Page& page);
     void read_HAS_page(const std::string& page_string);
 
     inline bool is_HAS_in_test_mode() const
@@ -80,9 +84,9 @@ public:
     }
 
 private:
-    uint8_t read_has_page_header_parameter(const std::bitset<GALILEO_CNAV_PAGE_HEADER_BITS>& bits, const std::pair<int32_t, int32_t>& parameter) const;
-    bool CRC_test(const std::bitset<GALILEO_CNAV_BITS_FOR_CRC>& bits, uint32_t checksum) const;
-    void read_HAS_page_header(const std::string& page_string);
+    uint8_t read_has_page_header_parameter(const Galileo_Cnav_Page& page, const std::pair<int32_t, int32_t>& parameter) const;
+    bool CRC_test(const Galileo_Cnav_Page& bits, uint32_t checksum) const;
+    void read_HAS_page_header(const Galileo_Cnav_Page& page);
 
     Galileo_HAS_page has_page{};
 
@@ -21,11 +21,8 @@
  */
 
 #include "galileo_fnav_message.h"
-#include <boost/crc.hpp>  // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>
-#include <algorithm>  // for reverse
-#include <iostream>   // for string, operator<<
-#include <iterator>   // for back_insert_iterator
+#include "crc24q.h"
+#include <iostream>  // for string, operator<<
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -33,20 +30,21 @@
 #include <absl/log/log.h>
 #endif
 
-using CRC_Galileo_FNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
-
 
 void Galileo_Fnav_Message::split_page(const std::string& page_string)
 {
-    const std::string message_word = page_string.substr(0, 214);
-    const std::string CRC_data = page_string.substr(214, 24);
-    const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> Word_for_CRC_bits(message_word);
-    const std::bitset<24> checksum(CRC_data);
-    if (CRC_test(Word_for_CRC_bits, checksum.to_ulong()) == true)
+    split_page(Galileo_Fnav_Page(page_string));
+}
+
+
+void Galileo_Fnav_Message::split_page(const Galileo_Fnav_Page& page)
+{
+    const auto checksum = static_cast<uint32_t>(page.read(GALILEO_FNAV_DATA_FRAME_BITS, 24));
+    if (CRC_test(page, checksum) == true)
         {
             flag_CRC_test = true;
             // CRC correct: Decode word
-            decode_page(message_word);
+            decode_page(page);
         }
     else
         {
@@ -55,37 +53,17 @@ void Galileo_Fnav_Message::split_page(const std::string& page_string)
 }
 
 
-bool Galileo_Fnav_Message::CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, uint32_t checksum) const
+bool Galileo_Fnav_Message::CRC_test(const Galileo_Fnav_Page& bits, uint32_t checksum) const
 {
-    CRC_Galileo_FNAV_type CRC_Galileo;
-
-    // Galileo FNAV frame for CRC is not an integer multiple of bytes
-    // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    // ToDo: Use boost::dynamic_bitset for all the bitset operations in this class
-
-    boost::dynamic_bitset<uint8_t> frame_bits(bits.to_string());
-
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_FNAV_DATA_FRAME_BYTES);
-
-    const uint32_t crc_computed = CRC_Galileo.checksum();
-    if (checksum == crc_computed)
-        {
-            return true;
-        }
-
-    return false;
+    // Galileo FNAV frame for CRC is not an integer multiple of bytes,
+    // it is taken as filled with zeroes at the start of the frame.
+    const uint32_t crc_computed = Crc24q::checksum(bits, 0, GALILEO_FNAV_DATA_FRAME_BITS);
+    return checksum == crc_computed;
 }
 
 
-void Galileo_Fnav_Message::decode_page(const std::string& data)
+void Galileo_Fnav_Message::decode_page(const Galileo_Fnav_Page& data_bits)
 {
-    const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> data_bits(data);
     page_type = read_navigation_unsigned(data_bits, FNAV_PAGE_TYPE_BIT);
     switch (page_type)
         {
@@ -230,9 +208,8 @@ void Galileo_Fnav_Message::decode_page(const std::string& data)
             FNAV_w_2_5 *= FNAV_W_5_LSB;
             FNAV_deltai_2_5 = static_cast<double>(read_navigation_signed(data_bits, FNAV_DELTAI_2_5_BIT));
             FNAV_deltai_2_5 *= FNAV_DELTAI_5_LSB;
-            // TODO check this
             // Omega0_2 must be decoded when the two pieces are joined
-            omega0_1 = data.substr(210, 4);
+            omega0_1 = static_cast<uint32_t>(data_bits.read(210, 4));
             // omega_flag=true;
             //
             // FNAV_Omega012_2_5=static_cast<double>(read_navigation_signed(data_bits, FNAV_Omega012_2_5_bit);
@@ -242,11 +219,8 @@ void Galileo_Fnav_Message::decode_page(const std::string& data)
             FNAV_IODa_6 = static_cast<int32_t>(read_navigation_unsigned(data_bits, FNAV_IO_DA_6_BIT));
             // Don't worry about omega pieces. If page 5 has not been received, all_ephemeris
             // flag will be set to false and the data won't be recorded.*/
-            const std::string omega0_2 = data.substr(10, 12);
-            const std::string Omega0 = omega0_1 + omega0_2;
-            const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS> omega_bits(Omega0);
-            const std::vector<std::pair<int32_t, int32_t>> om_bit({{0, 12}});
-            FNAV_Omega0_2_6 = static_cast<double>(read_navigation_signed(omega_bits, om_bit));
+            // 16-bit two's complement: 4 MSBs from page 5 and 12 LSBs from this page
+            FNAV_Omega0_2_6 = static_cast<double>(static_cast<int16_t>((static_cast<uint64_t>(omega0_1) << 12) | data_bits.read(10, 12)));
             FNAV_Omega0_2_6 *= FNAV_OMEGA0_5_LSB;
             FNAV_Omegadot_2_6 = static_cast<double>(read_navigation_signed(data_bits, FNAV_OMEGADOT_2_6_BIT));
             FNAV_Omegadot_2_6 *= FNAV_OMEGADOT_5_LSB;
@@ -284,32 +258,15 @@ void Galileo_Fnav_Message::decode_page(const std::string& data)
 }
 
 
-uint64_t Galileo_Fnav_Message::read_navigation_unsigned(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+uint64_t Galileo_Fnav_Message::read_navigation_unsigned(const Galileo_Fnav_Page& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
 {
-    uint64_t value = 0ULL;
-    for (const auto& p : parameter)
-        {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1U;  // shift left
-                    value |= static_cast<uint64_t>(bits[GALILEO_FNAV_DATA_FRAME_BITS - p.first - j]);
-                }
-        }
-    return value;
+    return bits.read_unsigned(parameter);
 }
 
 
-int64_t Galileo_Fnav_Message::read_navigation_signed(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+int64_t Galileo_Fnav_Message::read_navigation_signed(const Galileo_Fnav_Page& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
 {
-    int64_t value = (bits[GALILEO_FNAV_DATA_FRAME_BITS - parameter[0].first] == 1) ? -1LL : 0LL;
-    for (const auto& p : parameter)
-        {
-            for (int32_t j = 0; j < p.second; j++)
-                {
-                    value = (value << 1) | static_cast<int64_t>(bits[GALILEO_FNAV_DATA_FRAME_BITS - p.first - j]);
-                }
-        }
-    return value;
+    return bits.read_signed(parameter);
 }
 
 
@@ -30,7 +30,7 @@
 #include "galileo_ephemeris.h"
 #include "galileo_iono.h"
 #include "galileo_utc_model.h"
-#include <bitset>
+#include "nav_page_bits.h"
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -42,6 +42,9 @@
  * \{ */
 
 
+using Galileo_Fnav_Page = Nav_Page_Bits<GALILEO_FNAV_PAGE_BITS>;
+
+
 /*!
  * \brief This class handles the Galileo F/NAV Data message, as described in the
  * Galileo Open Service Signal in Space Interface Control Document (OS SIS ICD), Issue 2.0 (Jan. 2021).
@@ -52,6 +55,7 @@ class Galileo_Fnav_Message
 public:
     Galileo_Fnav_Message() = default;
 
+    void split_page(const Galileo_Fnav_Page& page);
     void split_page(const std::string& page_string);
     bool have_new_ephemeris();
     bool have_new_iono_and_GST();
@@ -138,12 +142,12 @@ public:
     }
 
 private:
-    bool CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, uint32_t checksum) const;
-    void decode_page(const std::string& data);
-    uint64_t read_navigation_unsigned(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
-    int64_t read_navigation_signed(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
+    bool CRC_test(const Galileo_Fnav_Page& bits, uint32_t checksum) const;
+    void decode_page(const Galileo_Fnav_Page& data_bits);
+    uint64_t read_navigation_unsigned(const Galileo_Fnav_Page& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
+    int64_t read_navigation_signed(const Galileo_Fnav_Page& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const;
 
-    std::string omega0_1{};
+    uint32_t omega0_1{};  // 4 MSBs of Omega0 of SVID2, received in page 5
     // std::string omega0_2{};
     // bool omega_flag{};
 
@@ -17,14 +17,13 @@
  */
 
 #include "galileo_inav_message.h"
+#include "crc24q.h"
 #include "galileo_reduced_ced.h"
 #include "reed_solomon.h"
-#include <boost/crc.hpp>             // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>  // for boost::dynamic_bitset
-#include <algorithm>                 // for reverse
-#include <iostream>                  // for operator<<
-#include <limits>                    // for std::numeric_limits
-#include <numeric>                   // for std::accumulate
+#include <array>     // for std::array
+#include <iostream>  // for operator<<
+#include <limits>    // for std::numeric_limits
+#include <numeric>   // for std::accumulate
 
 #if USE_GLOG_AND_GFLAGS
 #include <glog/logging.h>
@@ -32,8 +31,6 @@
 #include <absl/log/log.h>
 #endif
 
-using CRC_Galileo_INAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
-
 
 Galileo_Inav_Message::Galileo_Inav_Message()
 {
@@ -48,144 +45,70 @@ Galileo_Inav_Message::Galileo_Inav_Message()
 Galileo_Inav_Message::~Galileo_Inav_Message() = default;
 
 
-bool Galileo_Inav_Message::CRC_test(const std::bitset<GALILEO_DATA_FRAME_BITS>& bits, uint32_t checksum) const
+bool Galileo_Inav_Message::CRC_test(const Galileo_Inav_Page& bits, uint32_t checksum) const
 {
-    CRC_Galileo_INAV_type CRC_Galileo;
-
-    // Galileo INAV frame for CRC is not an integer multiple of bytes
-    // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    // ToDo: Use boost::dynamic_bitset for all the bitset operations in this class
-
-    boost::dynamic_bitset<unsigned char> frame_bits(bits.to_string());
-
-    std::vector<unsigned char> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_DATA_FRAME_BYTES);
-
-    const uint32_t crc_computed = CRC_Galileo.checksum();
-    if (checksum == crc_computed)
-        {
-            return true;
-        }
-    return false;
+    // Galileo INAV frame for CRC is not an integer multiple of bytes,
+    // it is taken as filled with zeroes at the start of the frame.
+    const uint32_t crc_computed = Crc24q::checksum(bits, 0, GALILEO_DATA_FRAME_BITS);
+    return checksum == crc_computed;
 }
 
 
-uint64_t Galileo_Inav_Message::read_navigation_unsigned(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+uint64_t Galileo_Inav_Message::read_navigation_unsigned(const Galileo_Inav_Data_Jk& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
 {
-    uint64_t value = 0ULL;
-    for (const auto& p : parameter)
-        {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1U;  // shift left
-                    value |= static_cast<uint64_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
-                }
-        }
-    return value;
+    return bits.read_unsigned(parameter);
 }
 
 
-uint8_t Galileo_Inav_Message::read_octet_unsigned(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+uint8_t Galileo_Inav_Message::read_octet_unsigned(const Galileo_Inav_Data_Jk& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
 {
-    uint8_t value = 0;
-    for (const auto& p : parameter)
-        {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1;  // shift left
-                    value |= static_cast<uint8_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
-                }
-        }
-    return value;
+    return static_cast<uint8_t>(bits.read_unsigned(parameter));
 }
 
 
-uint64_t Galileo_Inav_Message::read_page_type_unsigned(const std::bitset<GALILEO_PAGE_TYPE_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+int64_t Galileo_Inav_Message::read_navigation_signed(const Galileo_Inav_Data_Jk& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
 {
-    uint64_t value = 0ULL;
-    for (const auto& p : parameter)
-        {
-            for (int j = 0; j < p.second; j++)
-                {
-                    value <<= 1;  // shift left
-                    value |= static_cast<uint64_t>(bits[GALILEO_PAGE_TYPE_BITS - p.first - j]);
-                }
-        }
-    return value;
+    return bits.read_signed(parameter);
 }
 
 
-int64_t Galileo_Inav_Message::read_navigation_signed(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+bool Galileo_Inav_Message::read_navigation_bool(const Galileo_Inav_Data_Jk& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
 {
-    int64_t value = (bits[GALILEO_DATA_JK_BITS - parameter[0].first] == 1) ? -1LL : 0LL;
-    for (const auto& p : parameter)
-        {
-            for (int32_t j = 0; j < p.second; j++)
-                {
-                    value = (value << 1) | static_cast<int64_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
-                }
-        }
-    return value;
+    return bits[parameter[0].first - 1];
 }
 
 
-bool Galileo_Inav_Message::read_navigation_bool(const std::bitset<GALILEO_DATA_JK_BITS>& bits, const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+void Galileo_Inav_Message::split_page(const std::string& page_string, int32_t flag_even_word)
 {
-    bool value = bits[GALILEO_DATA_JK_BITS - parameter[0].first];
-    return value;
+    split_page(Galileo_Inav_Page_Part(page_string), flag_even_word);
 }
 
 
-void Galileo_Inav_Message::split_page(std::string page_string, int32_t flag_even_word)
+void Galileo_Inav_Message::split_page(const Galileo_Inav_Page_Part& page_part, int32_t flag_even_word)
 {
-    int32_t Page_type = 0;
-
-    if (page_string.at(0) == '1')  // if page is odd
+    if (page_part[0])  // if page is odd
         {
-            const std::string& page_Odd = page_string;
-
             if (flag_even_word == 1)  // An odd page has been received but the previous even page is kept in memory and it is considered to join pages
                 {
-                    const std::string page_INAV_even = page_Even;
-                    const std::string page_INAV = page_INAV_even + page_Odd;  // Join pages: Even + Odd = INAV page
-                    const std::string Even_bit = page_INAV.substr(0, 1);
-                    const std::string Page_type_even = page_INAV.substr(1, 1);
-                    const std::string nominal = "0";
-
-                    const std::string Data_k = page_INAV.substr(2, 112);
-                    const std::string Odd_bit = page_INAV.substr(114, 1);
-                    const std::string Page_type_Odd = page_INAV.substr(115, 1);
-                    const std::string Data_j = page_INAV.substr(116, 16);
-
-                    const std::string Reserved_1 = page_INAV.substr(132, 40);
-                    const std::string SAR = page_INAV.substr(172, 22);
-                    const std::string Spare = page_INAV.substr(194, 2);
-                    const std::string CRC_data = page_INAV.substr(196, 24);
-                    const std::string Reserved_2 = page_INAV.substr(220, 8);
-                    const std::string Tail_odd = page_INAV.substr(228, 6);
+                    // Join pages: Even (without tail bits) + Odd = INAV page
+                    // Even page: Even/odd (1), Page type (1), Data_k (112)
+                    // Odd page: Even/odd (1), Page type (1), Data_j (16), Reserved 1 (40), SAR (22), Spare (2), CRC (24), Reserved 2 (8), Tail (6)
+                    Galileo_Inav_Page page_INAV;
+                    page_INAV.copy(0, page_Even, 0, GALILEO_INAV_EVEN_PAGE_PART_BITS);
+                    page_INAV.copy(GALILEO_INAV_EVEN_PAGE_PART_BITS, page_part, 0, GALILEO_INAV_PAGE_PART_BITS);
 
                     // ************ CRC checksum control *******/
-                    std::stringstream TLM_word_for_CRC_stream;
-                    TLM_word_for_CRC_stream << page_INAV;
-                    const std::string TLM_word_for_CRC = TLM_word_for_CRC_stream.str().substr(0, GALILEO_DATA_FRAME_BITS);
-                    const std::bitset<GALILEO_DATA_FRAME_BITS> TLM_word_for_CRC_bits(TLM_word_for_CRC);
-                    const std::bitset<24> checksum(CRC_data);
+                    const auto checksum = static_cast<uint32_t>(page_INAV.read(GALILEO_DATA_FRAME_BITS, 24));
 
-                    if (CRC_test(TLM_word_for_CRC_bits, checksum.to_ulong()) == true)
+                    if (CRC_test(page_INAV, checksum) == true)
                         {
                             flag_CRC_test = true;
                             // CRC correct: Decode word
-                            const std::string page_number_bits = Data_k.substr(0, 6);
-                            const std::bitset<GALILEO_PAGE_TYPE_BITS> page_type_bits(page_number_bits);  // from string to bitset
-                            Page_type = static_cast<int32_t>(read_page_type_unsigned(page_type_bits, TYPE));
-                            Page_type_time_stamp = Page_type;
-                            const std::string Data_jk_ephemeris = Data_k + Data_j;
-                            page_jk_decoder(Data_jk_ephemeris.c_str());
+                            Page_type_time_stamp = static_cast<int32_t>(page_INAV.read(2, GALILEO_PAGE_TYPE_BITS));
+                            Galileo_Inav_Data_Jk data_jk_bits;
+                            data_jk_bits.copy(0, page_INAV, 2, 112);    // Data_k
+                            data_jk_bits.copy(112, page_INAV, 116, 16);  // Data_j
+                            page_jk_decoder(data_jk_bits);
                         }
                     else
                         {
@@ -193,10 +116,10 @@ void Galileo_Inav_Message::split_page(std::string page_string, int32_t flag_even
                             flag_CRC_test = false;
                         }
                 }  // end of CRC checksum control
-        }          // end if (page_string.at(0)=='1')
+        }          // end if (page_part[0])
     else
         {
-            page_Even = page_string.substr(0, 114);
+            page_Even = page_part;
         }
 }
 
@@ -298,22 +221,22 @@ bool Galileo_Inav_Message::have_new_ephemeris()  // Check if we have a new ephem
                         {
                             if (inav_rs_pages[0] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_1(rs_buffer);
+                                    const Galileo_Inav_Data_Jk missing_bits = regenerate_page_1(rs_buffer);
                                     read_page_1(missing_bits);
                                 }
                             if (inav_rs_pages[1] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_2(rs_buffer);
+                                    const Galileo_Inav_Data_Jk missing_bits = regenerate_page_2(rs_buffer);
                                     read_page_2(missing_bits);
                                 }
                             if (inav_rs_pages[2] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_3(rs_buffer);
+                                    const Galileo_Inav_Data_Jk missing_bits = regenerate_page_3(rs_buffer);
                                     read_page_3(missing_bits);
                                 }
                             if (inav_rs_pages[3] == 0)
                                 {
-                                    std::bitset<GALILEO_DATA_JK_BITS> missing_bits = regenerate_page_4(rs_buffer);
+                                    const Galileo_Inav_Data_Jk missing_bits = regenerate_page_4(rs_buffer);
                                     read_page_4(missing_bits);
                                 }
 
@@ -581,7 +504,7 @@ Galileo_Ephemeris Galileo_Inav_Message::get_reduced_ced() const
 }
 
 
-void Galileo_Inav_Message::read_page_1(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_1(const Galileo_Inav_Data_Jk& data_bits)
 {
     IOD_nav_1 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_1_BIT));
     DLOG(INFO) << "IOD_nav_1= " << IOD_nav_1;
@@ -602,7 +525,7 @@ void Galileo_Inav_Message::read_page_1(const std::bitset<GALILEO_DATA_JK_BITS>&
 }
 
 
-void Galileo_Inav_Message::read_page_2(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_2(const Galileo_Inav_Data_Jk& data_bits)
 {
     IOD_nav_2 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_2_BIT));
     DLOG(INFO) << "IOD_nav_2= " << IOD_nav_2;
@@ -623,7 +546,7 @@ void Galileo_Inav_Message::read_page_2(const std::bitset<GALILEO_DATA_JK_BITS>&
 }
 
 
-void Galileo_Inav_Message::read_page_3(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_3(const Galileo_Inav_Data_Jk& data_bits)
 {
     IOD_nav_3 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_3_BIT));
     DLOG(INFO) << "IOD_nav_3= " << IOD_nav_3;
@@ -652,7 +575,7 @@ void Galileo_Inav_Message::read_page_3(const std::bitset<GALILEO_DATA_JK_BITS>&
 }
 
 
-void Galileo_Inav_Message::read_page_4(const std::bitset<GALILEO_DATA_JK_BITS>& data_bits)
+void Galileo_Inav_Message::read_page_4(const Galileo_Inav_Data_Jk& data_bits)
 {
     IOD_nav_4 = static_cast<int32_t>(read_navigation_unsigned(data_bits, IOD_NAV_4_BIT));
     DLOG(INFO) << "IOD_nav_4= " << IOD_nav_4;
@@ -684,129 +607,71 @@ void Galileo_Inav_Message::read_page_4(const std::bitset<GALILEO_DATA_JK_BITS>&
 }
 
 
-std::bitset<GALILEO_DATA_JK_BITS> Galileo_Inav_Message::regenerate_page_1(const std::vector<uint8_t>& decoded) const
+Galileo_Inav_Data_Jk Galileo_Inav_Message::regenerate_page_1(const std::vector<uint8_t>& decoded) const
 {
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits;
+    Galileo_Inav_Data_Jk data_bits;
     // Set page type to 1
-    data_bits.set(5);
-    std::bitset<8> c0(decoded[0]);
-    std::bitset<8> c1(decoded[1]);
-    for (int i = 0; i < 8; i++)
-        {
-            data_bits[6 + i] = c1[8 - i - 1];
-        }
-    data_bits[14] = c0[1];
-    data_bits[15] = c0[0];
+    data_bits.write(0, 6, 1);
+    data_bits.write(6, 8, decoded[1]);
+    data_bits.write(14, 2, decoded[0]);
     for (int k = 2; k < 16; k++)
         {
-            std::bitset<8> octet(decoded[k]);
-            for (int i = 0; i < 8; i++)
-                {
-                    data_bits[i + k * 8] = octet[8 - i - 1];
-                }
+            data_bits.write(k * 8, 8, decoded[k]);
         }
-
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits_reversed;
-    for (int i = 0; i < GALILEO_DATA_JK_BITS; i++)
-        {
-            data_bits_reversed[GALILEO_DATA_JK_BITS - i - 1] = data_bits[i];
-        }
-    return data_bits_reversed;
+    return data_bits;
 }
 
 
-std::bitset<GALILEO_DATA_JK_BITS> Galileo_Inav_Message::regenerate_page_2(const std::vector<uint8_t>& decoded) const
+Galileo_Inav_Data_Jk Galileo_Inav_Message::regenerate_page_2(const std::vector<uint8_t>& decoded) const
 {
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits;
+    Galileo_Inav_Data_Jk data_bits;
     // Set page type to 2
-    data_bits.set(4);
-
-    std::bitset<10> iodnav(current_IODnav);
-
-    for (int i = 0; i < 10; i++)
-        {
-            data_bits[6 + i] = iodnav[10 - i - 1];
-        }
+    data_bits.write(0, 6, 2);
+    data_bits.write(6, 10, static_cast<uint64_t>(current_IODnav));
     for (int k = 0; k < 14; k++)
         {
-            std::bitset<8> octet(decoded[k + 16]);
-            for (int i = 0; i < 8; i++)
-                {
-                    data_bits[16 + i + k * 8] = octet[8 - i - 1];
-                }
-        }
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits_reversed;
-    for (int i = 0; i < GALILEO_DATA_JK_BITS; i++)
-        {
-            data_bits_reversed[GALILEO_DATA_JK_BITS - i - 1] = data_bits[i];
+            data_bits.write(16 + k * 8, 8, decoded[k + 16]);
         }
-    return data_bits_reversed;
+    return data_bits;
 }
 
 
-std::bitset<GALILEO_DATA_JK_BITS> Galileo_Inav_Message::regenerate_page_3(const std::vector<uint8_t>& decoded) const
+Galileo_Inav_Data_Jk Galileo_Inav_Message::regenerate_page_3(const std::vector<uint8_t>& decoded) const
 {
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits;
+    Galileo_Inav_Data_Jk data_bits;
     // Set page type to 3
-    data_bits.set(4);
-    data_bits.set(5);
-
-    std::bitset<10> iodnav(current_IODnav);
-
-    for (int i = 0; i < 10; i++)
-        {
-            data_bits[6 + i] = iodnav[10 - i - 1];
-        }
+    data_bits.write(0, 6, 3);
+    data_bits.write(6, 10, static_cast<uint64_t>(current_IODnav));
     for (int k = 0; k < 14; k++)
         {
-            std::bitset<8> octet(decoded[k + 30]);
-            for (int i = 0; i < 8; i++)
-                {
-                    data_bits[16 + i + k * 8] = octet[8 - i - 1];
-                }
-        }
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits_reversed;
-    for (int i = 0; i < GALILEO_DATA_JK_BITS; i++)
-        {
-            data_bits_reversed[GALILEO_DATA_JK_BITS - i - 1] = data_bits[i];
+            data_bits.write(16 + k * 8, 8, decoded[k + 30]);
         }
-    return data_bits_reversed;
+    return data_bits;
 }
 
 
-std::bitset<GALILEO_DATA_JK_BITS> Galileo_Inav_Message::regenerate_page_4(const std::vector<uint8_t>& decoded) const
+Galileo_Inav_Data_Jk Galileo_Inav_Message::regenerate_page_4(const std::vector<uint8_t>& decoded) const
 {
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits;
+    Galileo_Inav_Data_Jk data_bits;
     // Set page type to 4
-    data_bits.set(3);
-
-    std::bitset<10> iodnav(current_IODnav);
-
-    for (int i = 0; i < 10; i++)
-        {
-            data_bits[6 + i] = iodnav[10 - i - 1];
-        }
+    data_bits.write(0, 6, 4);
+    data_bits.write(6, 10, static_cast<uint64_t>(current_IODnav));
     for (int k = 0; k < 14; k++)
         {
-            std::bitset<8> octet(decoded[k + 44]);
-            for (int i = 0; i < 8; i++)
-                {
-                    data_bits[16 + i + k * 8] = octet[8 - i - 1];
-                }
-        }
-    std::bitset<GALILEO_DATA_JK_BITS> data_bits_reversed;
-    for (int i = 0; i < GALILEO_DATA_JK_BITS; i++)
-        {
-            data_bits_reversed[GALILEO_DATA_JK_BITS - i - 1] = data_bits[i];
+            data_bits.write(16 + k * 8, 8, decoded[k + 44]);
         }
-    return data_bits_reversed;
+    return data_bits;
 }
 
 
 int32_t Galileo_Inav_Message::page_jk_decoder(const char* data_jk)
 {
-    const std::string data_jk_string = data_jk;
-    const std::bitset<GALILEO_DATA_JK_BITS> data_jk_bits(data_jk_string);
+    return page_jk_decoder(Galileo_Inav_Data_Jk(std::string(data_jk)));
+}
+
+
+int32_t Galileo_Inav_Message::page_jk_decoder(const Galileo_Inav_Data_Jk& data_jk_bits)
+{
 
     const auto page_number = static_cast<int32_t>(read_navigation_unsigned(data_jk_bits, PAGE_TYPE_BIT));
     DLOG(INFO) << "Page number = " << page_number;
@@ -22,6 +22,7 @@
 
 #include <boost/serialization/nvp.hpp>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 
 /** \addtogroup Core
@@ -84,112 +85,13 @@ public:
     Gnss_Synchro(const Gnss_Synchro& other) noexcept = default;
 
     /// Copy assignment operator
-    Gnss_Synchro& operator=(const Gnss_Synchro& rhs) noexcept
-    {
-        // Only do assignment if RHS is a different object from this.
-        if (this != &rhs)
-            {
-                this->System = rhs.System;
-                this->Signal[0] = rhs.Signal[0];
-                this->Signal[1] = rhs.Signal[1];
-                this->Signal[2] = rhs.Signal[2];
-                this->PRN = rhs.PRN;
-                this->Channel_ID = rhs.Channel_ID;
-                this->Acq_delay_samples = rhs.Acq_delay_samples;
-                this->Acq_doppler_hz = rhs.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = rhs.Acq_samplestamp_samples;
-                this->Acq_doppler_step = rhs.Acq_doppler_step;
-                this->fs = rhs.fs;
-                this->Prompt_I = rhs.Prompt_I;
-                this->Prompt_Q = rhs.Prompt_Q;
-                this->CN0_dB_hz = rhs.CN0_dB_hz;
-                this->Carrier_Doppler_hz = rhs.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = rhs.Carrier_phase_rads;
-                this->Code_phase_samples = rhs.Code_phase_samples;
-                this->Tracking_sample_counter = rhs.Tracking_sample_counter;
-                this->correlation_length_ms = rhs.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = rhs.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = rhs.Pseudorange_m;
-                this->RX_time = rhs.RX_time;
-                this->interp_TOW_ms = rhs.interp_TOW_ms;
-                this->Flag_valid_acquisition = rhs.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = rhs.Flag_valid_symbol_output;
-                this->Flag_valid_word = rhs.Flag_valid_word;
-                this->Flag_valid_pseudorange = rhs.Flag_valid_pseudorange;
-                this->Flag_PLL_180_deg_phase_locked = rhs.Flag_PLL_180_deg_phase_locked;
-            }
-        return *this;
-    };
+    Gnss_Synchro& operator=(const Gnss_Synchro& rhs) noexcept = default;
 
     /// Move constructor
     Gnss_Synchro(Gnss_Synchro&& other) noexcept = default;
 
     /// Move assignment operator
-    Gnss_Synchro& operator=(Gnss_Synchro&& other) noexcept
-    {
-        if (this != &other)
-            {
-                this->System = other.System;
-                this->Signal[0] = other.Signal[0];
-                this->Signal[1] = other.Signal[1];
-                this->Signal[2] = other.Signal[2];
-                this->PRN = other.PRN;
-                this->Channel_ID = other.Channel_ID;
-                this->Acq_delay_samples = other.Acq_delay_samples;
-                this->Acq_doppler_hz = other.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = other.Acq_samplestamp_samples;
-                this->Acq_doppler_step = other.Acq_doppler_step;
-                this->fs = other.fs;
-                this->Prompt_I = other.Prompt_I;
-                this->Prompt_Q = other.Prompt_Q;
-                this->CN0_dB_hz = other.CN0_dB_hz;
-                this->Carrier_Doppler_hz = other.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = other.Carrier_phase_rads;
-                this->Code_phase_samples = other.Code_phase_samples;
-                this->Tracking_sample_counter = other.Tracking_sample_counter;
-                this->correlation_length_ms = other.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = other.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = other.Pseudorange_m;
-                this->RX_time = other.RX_time;
-                this->interp_TOW_ms = other.interp_TOW_ms;
-                this->Flag_valid_acquisition = other.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = other.Flag_valid_symbol_output;
-                this->Flag_valid_word = other.Flag_valid_word;
-                this->Flag_valid_pseudorange = other.Flag_valid_pseudorange;
-                this->Flag_PLL_180_deg_phase_locked = other.Flag_PLL_180_deg_phase_locked;
-
-                // Leave the source object in a valid but unspecified state
-                other.Signal[0] = '\0';
-                other.Signal[1] = '\0';
-                other.Signal[2] = '\0';
-                other.System = 0;
-                other.PRN = 0;
-                other.Channel_ID = 0;
-                other.Acq_delay_samples = 0.0;
-                other.Acq_doppler_hz = 0.0;
-                other.Acq_samplestamp_samples = 0;
-                other.Acq_doppler_step = 0;
-                other.fs = 0;
-                other.Prompt_I = 0.0;
-                other.Prompt_Q = 0.0;
-                other.CN0_dB_hz = 0.0;
-                other.Carrier_Doppler_hz = 0.0;
-                other.Carrier_phase_rads = 0.0;
-                other.Code_phase_samples = 0.0;
-                other.Tracking_sample_counter = 0;
-                other.correlation_length_ms = 0;
-                other.TOW_at_current_symbol_ms = 0;
-                other.Pseudorange_m = 0.0;
-                other.RX_time = 0.0;
-                other.interp_TOW_ms = 0.0;
-                other.Flag_valid_acquisition = false;
-                other.Flag_valid_symbol_output = false;
-                other.Flag_valid_word = false;
-                other.Flag_valid_pseudorange = false;
-                other.Flag_PLL_180_deg_phase_locked = false;
-            }
-        return *this;
-    };
+    Gnss_Synchro& operator=(Gnss_Synchro&& other) noexcept = default;
 
     /*!
      * \brief This member function serializes and restores
@@ -238,6 +140,10 @@ public:
 };
 
 
+// Copied member-wise (memcpy) through the GNU Radio buffers
+static_assert(std::is_trivially_copyable<Gnss_Synchro>::value, "Gnss_Synchro must be trivially copyable");
+
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_GNSS_SYNCHRO_H
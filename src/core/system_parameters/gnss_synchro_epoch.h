@@ -0,0 +1,235 @@
+/*!
+ * \file gnss_synchro_epoch.h
+ * \brief Structure-of-arrays record with the observables of all the channels
+ * at a given observation epoch, as delivered by the Observables block to the
+ * PVT block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SYNCHRO_EPOCH_H
+#define GNSS_SDR_GNSS_SYNCHRO_EPOCH_H
+
+#include "gnss_synchro.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Observables of all the channels at one epoch, stored as one
+ * fixed-size array per Gnss_Synchro member plus a bitmask of the channels
+ * holding an observation.
+ *
+ * This is the item of the stream between the Observables and the PVT
+ * blocks. Only the mask and the valid channels are written at each epoch,
+ * and the record has no pointers, so it is copied as raw bytes through the
+ * GNU Radio buffers. Its size is a whole number of memory pages, which
+ * keeps GNU Radio from rounding the length of its buffers up to hundreds of
+ * items.
+ */
+class Gnss_Synchro_Epoch
+{
+public:
+    static constexpr uint32_t MAX_CHANNELS = 128;  //!< Maximum number of channels of the receiver
+
+    // Bits of the flags array
+    static constexpr uint8_t FLAG_VALID_ACQUISITION = 0x01;
+    static constexpr uint8_t FLAG_VALID_SYMBOL_OUTPUT = 0x02;
+    static constexpr uint8_t FLAG_VALID_WORD = 0x04;
+    static constexpr uint8_t FLAG_VALID_PSEUDORANGE = 0x08;
+    static constexpr uint8_t FLAG_PLL_180_DEG_PHASE_LOCKED = 0x10;
+
+    /*!
+     * \brief Sets the number of channels and invalidates all of them. The
+     * stored values are kept.
+     */
+    inline void reset(uint32_t nchannels)
+    {
+        d_nchannels = nchannels;
+        d_valid_mask.fill(0ULL);
+    }
+
+    /*!
+     * \brief Number of channels of the receiver
+     */
+    inline uint32_t size() const
+    {
+        return d_nchannels;
+    }
+
+    /*!
+     * \brief Returns true if channel ch holds an observation at this epoch
+     */
+    inline bool valid(uint32_t ch) const
+    {
+        return ch < d_nchannels && ((d_valid_mask[ch / 64] >> (ch % 64)) & 1ULL) != 0ULL;
+    }
+
+    /*!
+     * \brief Returns true if channel ch holds an observation with a valid
+     * pseudorange
+     */
+    inline bool valid_pseudorange(uint32_t ch) const
+    {
+        return valid(ch) && (flags[ch] & FLAG_VALID_PSEUDORANGE) != 0U;
+    }
+
+    /*!
+     * \brief Number of channels holding an observation
+     */
+    uint32_t count() const
+    {
+        uint32_t n = 0;
+        for (auto word : d_valid_mask)
+            {
+                while (word != 0ULL)
+                    {
+                        word &= word - 1ULL;
+                        n++;
+                    }
+            }
+        return n;
+    }
+
+    /*!
+     * \brief Stores the observation of channel ch and marks it as valid
+     */
+    void set(uint32_t ch, const Gnss_Synchro& gs)
+    {
+        System[ch] = gs.System;
+        Signal[ch] = {gs.Signal[0], gs.Signal[1], gs.Signal[2]};
+        PRN[ch] = gs.PRN;
+        Channel_ID[ch] = gs.Channel_ID;
+        Acq_delay_samples[ch] = gs.Acq_delay_samples;
+        Acq_doppler_hz[ch] = gs.Acq_doppler_hz;
+        Acq_samplestamp_samples[ch] = gs.Acq_samplestamp_samples;
+        Acq_doppler_step[ch] = gs.Acq_doppler_step;
+        fs[ch] = gs.fs;
+        Prompt_I[ch] = gs.Prompt_I;
+        Prompt_Q[ch] = gs.Prompt_Q;
+        CN0_dB_hz[ch] = gs.CN0_dB_hz;
+        Carrier_Doppler_hz[ch] = gs.Carrier_Doppler_hz;
+        Carrier_phase_rads[ch] = gs.Carrier_phase_rads;
+        Code_phase_samples[ch] = gs.Code_phase_samples;
+        Tracking_sample_counter[ch] = gs.Tracking_sample_counter;
+        correlation_length_ms[ch] = gs.correlation_length_ms;
+        TOW_at_current_symbol_ms[ch] = gs.TOW_at_current_symbol_ms;
+        Pseudorange_m[ch] = gs.Pseudorange_m;
+        RX_time[ch] = gs.RX_time;
+        interp_TOW_ms[ch] = gs.interp_TOW_ms;
+        flags[ch] = static_cast<uint8_t>((gs.Flag_valid_acquisition ? FLAG_VALID_ACQUISITION : 0U) |
+                                         (gs.Flag_valid_symbol_output ? FLAG_VALID_SYMBOL_OUTPUT : 0U) |
+                                         (gs.Flag_valid_word ? FLAG_VALID_WORD : 0U) |
+                                         (gs.Flag_valid_pseudorange ? FLAG_VALID_PSEUDORANGE : 0U) |
+                                         (gs.Flag_PLL_180_deg_phase_locked ? FLAG_PLL_180_DEG_PHASE_LOCKED : 0U));
+        d_valid_mask[ch / 64] |= 1ULL << (ch % 64);
+    }
+
+    /*!
+     * \brief Rebuilds the Gnss_Synchro object of channel ch. A channel
+     * without observation gives an empty object with only its Channel_ID set.
+     */
+    void get(uint32_t ch, Gnss_Synchro& gs) const
+    {
+        if (!valid(ch))
+            {
+                gs = Gnss_Synchro();
+                gs.Channel_ID = static_cast<int32_t>(ch);
+                return;
+            }
+        gs.System = System[ch];
+        gs.Signal[0] = Signal[ch][0];
+        gs.Signal[1] = Signal[ch][1];
+        gs.Signal[2] = Signal[ch][2];
+        gs.PRN = PRN[ch];
+        gs.Channel_ID = Channel_ID[ch];
+        gs.Acq_delay_samples = Acq_delay_samples[ch];
+        gs.Acq_doppler_hz = Acq_doppler_hz[ch];
+        gs.Acq_samplestamp_samples = Acq_samplestamp_samples[ch];
+        gs.Acq_doppler_step = Acq_doppler_step[ch];
+        gs.fs = fs[ch];
+        gs.Prompt_I = Prompt_I[ch];
+        gs.Prompt_Q = Prompt_Q[ch];
+        gs.CN0_dB_hz = CN0_dB_hz[ch];
+        gs.Carrier_Doppler_hz = Carrier_Doppler_hz[ch];
+        gs.Carrier_phase_rads = Carrier_phase_rads[ch];
+        gs.Code_phase_samples = Code_phase_samples[ch];
+        gs.Tracking_sample_counter = Tracking_sample_counter[ch];
+        gs.correlation_length_ms = correlation_length_ms[ch];
+        gs.TOW_at_current_symbol_ms = TOW_at_current_symbol_ms[ch];
+        gs.Pseudorange_m = Pseudorange_m[ch];
+        gs.RX_time = RX_time[ch];
+        gs.interp_TOW_ms = interp_TOW_ms[ch];
+        gs.Flag_valid_acquisition = (flags[ch] & FLAG_VALID_ACQUISITION) != 0U;
+        gs.Flag_valid_symbol_output = (flags[ch] & FLAG_VALID_SYMBOL_OUTPUT) != 0U;
+        gs.Flag_valid_word = (flags[ch] & FLAG_VALID_WORD) != 0U;
+        gs.Flag_valid_pseudorange = (flags[ch] & FLAG_VALID_PSEUDORANGE) != 0U;
+        gs.Flag_PLL_180_deg_phase_locked = (flags[ch] & FLAG_PLL_180_DEG_PHASE_LOCKED) != 0U;
+    }
+
+    Gnss_Synchro get(uint32_t ch) const
+    {
+        Gnss_Synchro gs;
+        get(ch, gs);
+        return gs;
+    }
+
+    // One array per Gnss_Synchro member, indexed by channel. Members are
+    // sorted by size so that the record has no internal padding.
+    std::array<double, MAX_CHANNELS> Acq_delay_samples;
+    std::array<double, MAX_CHANNELS> Acq_doppler_hz;
+    std::array<uint64_t, MAX_CHANNELS> Acq_samplestamp_samples;
+    std::array<int64_t, MAX_CHANNELS> fs;
+    std::array<double, MAX_CHANNELS> Prompt_I;
+    std::array<double, MAX_CHANNELS> Prompt_Q;
+    std::array<double, MAX_CHANNELS> CN0_dB_hz;
+    std::array<double, MAX_CHANNELS> Carrier_Doppler_hz;
+    std::array<double, MAX_CHANNELS> Carrier_phase_rads;
+    std::array<double, MAX_CHANNELS> Code_phase_samples;
+    std::array<uint64_t, MAX_CHANNELS> Tracking_sample_counter;
+    std::array<double, MAX_CHANNELS> Pseudorange_m;
+    std::array<double, MAX_CHANNELS> RX_time;
+    std::array<double, MAX_CHANNELS> interp_TOW_ms;
+    std::array<uint32_t, MAX_CHANNELS> PRN;
+    std::array<int32_t, MAX_CHANNELS> Channel_ID;
+    std::array<uint32_t, MAX_CHANNELS> Acq_doppler_step;
+    std::array<int32_t, MAX_CHANNELS> correlation_length_ms;
+    std::array<uint32_t, MAX_CHANNELS> TOW_at_current_symbol_ms;
+    std::array<char, MAX_CHANNELS> System;
+    std::array<std::array<char, 3>, MAX_CHANNELS> Signal;
+    std::array<uint8_t, MAX_CHANNELS> flags;
+
+private:
+    static constexpr size_t PAGE_SIZE = 4096;
+    static constexpr size_t DATA_SIZE = MAX_CHANNELS * (14 * sizeof(double) + 5 * sizeof(uint32_t) + 5 * sizeof(char)) +
+                                        MAX_CHANNELS / 64 * sizeof(uint64_t) + sizeof(uint32_t);
+
+    std::array<uint64_t, MAX_CHANNELS / 64> d_valid_mask;
+    uint32_t d_nchannels;
+    std::array<uint8_t, (DATA_SIZE + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE - DATA_SIZE> d_padding;
+};
+
+
+// Copied as raw bytes through the GNU Radio buffers
+static_assert(std::is_trivially_copyable<Gnss_Synchro_Epoch>::value, "Gnss_Synchro_Epoch must be trivially copyable");
+static_assert(sizeof(Gnss_Synchro_Epoch) % 4096 == 0, "The size of Gnss_Synchro_Epoch must be a whole number of pages");
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SYNCHRO_EPOCH_H
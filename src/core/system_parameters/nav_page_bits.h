@@ -0,0 +1,227 @@
+/*!
+ * \file nav_page_bits.h
+ * \brief Packed storage of the bits of a navigation message page
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_PAGE_BITS_H
+#define GNSS_SDR_NAV_PAGE_BITS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Bits of a navigation message page, packed in 64-bit words.
+ *
+ * Bit 0 is the first transmitted bit, stored in the most significant bit of
+ * the first word, so a field of up to 64 bits is read with at most two shifts
+ * and a mask. The parameter tables of the navigation messages, given as
+ * (first bit, length) pairs with the first bit counted from 1, are read with
+ * read_unsigned() and read_signed().
+ */
+template <std::size_t N>
+class Nav_Page_Bits
+{
+public:
+    Nav_Page_Bits() = default;
+
+    /*!
+     * \brief Builds the page from a string of '0' and '1' characters
+     */
+    explicit Nav_Page_Bits(const std::string& bits)
+    {
+        const std::size_t n = bits.size() < N ? bits.size() : N;
+        for (std::size_t i = 0; i < n; i++)
+            {
+                set(i, bits[i] == '1');
+            }
+    }
+
+    static constexpr std::size_t size()
+    {
+        return N;
+    }
+
+    /*!
+     * \brief Sets the first n bits of the page from hard decisions, where a
+     * positive value means bit 1. The rest of the page is cleared.
+     */
+    template <typename T>
+    void assign(const T* bits, std::size_t n)
+    {
+        d_words.fill(0ULL);
+        if (n > N)
+            {
+                n = N;
+            }
+        for (std::size_t i = 0; i < n; i++)
+            {
+                if (bits[i] > 0)
+                    {
+                        d_words[i / 64] |= 1ULL << (63 - i % 64);
+                    }
+            }
+    }
+
+    inline bool operator[](std::size_t pos) const
+    {
+        return ((d_words[pos / 64] >> (63 - pos % 64)) & 1ULL) != 0ULL;
+    }
+
+    inline void set(std::size_t pos, bool value = true)
+    {
+        const uint64_t mask = 1ULL << (63 - pos % 64);
+        if (value)
+            {
+                d_words[pos / 64] |= mask;
+            }
+        else
+            {
+                d_words[pos / 64] &= ~mask;
+            }
+    }
+
+    /*!
+     * \brief Returns the len (up to 64) bits starting at pos, first bit as the
+     * most significant one.
+     */
+    inline uint64_t read(std::size_t pos, std::size_t len) const
+    {
+        if (len == 0)
+            {
+                return 0ULL;
+            }
+        const std::size_t word = pos / 64;
+        const std::size_t offset = pos % 64;
+        uint64_t value = d_words[word] << offset;
+        if (offset != 0 && offset + len > 64 && word + 1 < d_words.size())
+            {
+                value |= d_words[word + 1] >> (64 - offset);
+            }
+        return value >> (64 - len);
+    }
+
+    /*!
+     * \brief Writes the len (up to 64) least significant bits of value
+     * starting at pos, most significant first.
+     */
+    void write(std::size_t pos, std::size_t len, uint64_t value)
+    {
+        for (std::size_t i = 0; i < len; i++)
+            {
+                set(pos + i, ((value >> (len - 1 - i)) & 1ULL) != 0ULL);
+            }
+    }
+
+    /*!
+     * \brief Copies len bits of other, starting at other_pos, to this page
+     * starting at pos.
+     */
+    template <std::size_t M>
+    void copy(std::size_t pos, const Nav_Page_Bits<M>& other, std::size_t other_pos, std::size_t len)
+    {
+        while (len > 0)
+            {
+                const std::size_t chunk = len < 64 ? len : 64;
+                write(pos, chunk, other.read(other_pos, chunk));
+                pos += chunk;
+                other_pos += chunk;
+                len -= chunk;
+            }
+    }
+
+    /*!
+     * \brief Reads an unsigned parameter given as a list of (first bit,
+     * length) pairs, with the first bit counted from 1.
+     */
+    uint64_t read_unsigned(const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+    {
+        uint64_t value = 0ULL;
+        for (const auto& p : parameter)
+            {
+                const auto len = static_cast<std::size_t>(p.second);
+                value = (len < 64 ? (value << len) : 0ULL) | read(static_cast<std::size_t>(p.first - 1), len);
+            }
+        return value;
+    }
+
+    /*!
+     * \brief Reads a two's complement parameter given as a list of (first
+     * bit, length) pairs, with the first bit counted from 1.
+     */
+    int64_t read_signed(const std::vector<std::pair<int32_t, int32_t>>& parameter) const
+    {
+        std::size_t len = 0;
+        for (const auto& p : parameter)
+            {
+                len += static_cast<std::size_t>(p.second);
+            }
+        uint64_t value = read_unsigned(parameter);
+        if (len > 0 && len < 64 && ((value >> (len - 1)) & 1ULL) != 0ULL)
+            {
+                value |= ~0ULL << len;  // sign extension
+            }
+        return static_cast<int64_t>(value);
+    }
+
+    /*!
+     * \brief Writes len bits starting at pos to (len + 7) / 8 bytes, padded
+     * with zeros at the start so that the last bit is the least significant
+     * bit of the last byte, as needed by the CRC computations.
+     */
+    void to_bytes(std::size_t pos, std::size_t len, uint8_t* bytes) const
+    {
+        const std::size_t nbytes = (len + 7) / 8;
+        std::size_t first = len - (nbytes - 1) * 8;  // bits in the first byte
+        for (std::size_t i = 0; i < nbytes; i++)
+            {
+                bytes[i] = static_cast<uint8_t>(read(pos, first));
+                pos += first;
+                first = 8;
+            }
+    }
+
+    /*!
+     * \brief Returns len bits starting at pos as a string of '0' and '1'
+     * characters.
+     */
+    std::string to_string(std::size_t pos = 0, std::size_t len = N) const
+    {
+        std::string bits(len, '0');
+        for (std::size_t i = 0; i < len; i++)
+            {
+                if ((*this)[pos + i])
+                    {
+                        bits[i] = '1';
+                    }
+            }
+        return bits;
+    }
+
+private:
+    std::array<uint64_t, (N + 63) / 64> d_words{};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NAV_PAGE_BITS_H
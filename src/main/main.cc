@@ -25,9 +25,11 @@
 #define GOOGLE_STRIP_LOG 0
 #endif
 
+#include "batch_processor.h"
 #include "concurrent_map.h"
 #include "concurrent_queue.h"
 #include "control_thread.h"
+#include "file_configuration.h"
 #include "gnss_sdr_filesystem.h"
 #include "gnss_sdr_flags.h"
 #include "gnss_sdr_make_unique.h"
@@ -231,10 +233,24 @@ int main(int argc, char** argv)
     int return_code = 0;
     try
         {
-            auto control_thread = std::make_unique<ControlThread>();
-            // record startup time
-            start = std::chrono::system_clock::now();
-            return_code = control_thread->run();
+#if USE_GLOG_AND_GFLAGS
+            const std::string config_file = (FLAGS_c == "-") ? FLAGS_config_file : FLAGS_c;
+#else
+            const std::string config_file = (absl::GetFlag(FLAGS_c) == "-") ? absl::GetFlag(FLAGS_config_file) : absl::GetFlag(FLAGS_c);
+#endif
+            auto configuration = std::make_shared<FileConfiguration>(config_file);
+            if (configuration->property("GNSS-SDR.batch_segments", 0) > 1)
+                {
+                    auto batch_processor = std::make_unique<BatchProcessor>(configuration);
+                    return_code = batch_processor->run();
+                }
+            else
+                {
+                    auto control_thread = std::make_unique<ControlThread>(configuration);
+                    // record startup time
+                    start = std::chrono::system_clock::now();
+                    return_code = control_thread->run();
+                }
         }
     catch (const boost::thread_resource_error& e)
         {
@@ -0,0 +1,143 @@
+/*!
+ * \file benchmark_crc.cc
+ * \brief Benchmark for the computation of the CRC-24Q of navigation pages
+ * and RTCM frames.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "Galileo_CNAV.h"
+#include "Galileo_INAV.h"
+#include "crc24q.h"
+#include "nav_page_bits.h"
+#include <benchmark/benchmark.h>
+#include <boost/crc.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+std::vector<uint8_t> random_bytes(std::size_t len)
+{
+    std::mt19937 gen(1234);
+    std::vector<uint8_t> bytes(len);
+    for (auto& b : bytes)
+        {
+            b = static_cast<uint8_t>(gen());
+        }
+    return bytes;
+}
+
+
+void bm_crc24q_boost(benchmark::State& state)
+{
+    const auto bytes = random_bytes(state.range(0));
+    for (auto _ : state)
+        {
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            crc.process_bytes(bytes.data(), bytes.size());
+            benchmark::DoNotOptimize(crc.checksum());
+        }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+
+void bm_crc24q_table(benchmark::State& state)
+{
+    const auto bytes = random_bytes(state.range(0));
+    for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Crc24q::checksum_table(bytes.data(), bytes.size()));
+        }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+
+void bm_crc24q(benchmark::State& state)
+{
+    const auto bytes = random_bytes(state.range(0));
+    for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Crc24q::checksum(bytes.data(), bytes.size()));
+        }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+
+// Galileo I/NAV and HAS pages, as done before: bits to bytes, and then boost::crc
+template <std::size_t N>
+void page_crc_boost(benchmark::State& state, std::size_t len)
+{
+    const auto bytes = random_bytes(N / 8 + 1);
+    Nav_Page_Bits<N> page;
+    for (std::size_t i = 0; i < N; i++)
+        {
+            page.set(i, (bytes[i / 8] >> (i % 8)) & 1U);
+        }
+    std::vector<uint8_t> page_bytes((len + 7) / 8);
+    for (auto _ : state)
+        {
+            page.to_bytes(0, len, page_bytes.data());
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            crc.process_bytes(page_bytes.data(), page_bytes.size());
+            benchmark::DoNotOptimize(crc.checksum());
+        }
+}
+
+
+template <std::size_t N>
+void page_crc(benchmark::State& state, std::size_t len)
+{
+    const auto bytes = random_bytes(N / 8 + 1);
+    Nav_Page_Bits<N> page;
+    for (std::size_t i = 0; i < N; i++)
+        {
+            page.set(i, (bytes[i / 8] >> (i % 8)) & 1U);
+        }
+    for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Crc24q::checksum(page, 0, len));
+        }
+}
+
+
+void bm_inav_crc_boost(benchmark::State& state)
+{
+    page_crc_boost<GALILEO_INAV_PAGE_BITS>(state, GALILEO_DATA_FRAME_BITS);
+}
+
+
+void bm_inav_crc(benchmark::State& state)
+{
+    page_crc<GALILEO_INAV_PAGE_BITS>(state, GALILEO_DATA_FRAME_BITS);
+}
+
+
+void bm_has_crc_boost(benchmark::State& state)
+{
+    page_crc_boost<GALILEO_CNAV_PAGE_BITS>(state, GALILEO_CNAV_BITS_FOR_CRC);
+}
+
+
+void bm_has_crc(benchmark::State& state)
+{
+    page_crc<GALILEO_CNAV_PAGE_BITS>(state, GALILEO_CNAV_BITS_FOR_CRC);
+}
+
+
+BENCHMARK(bm_crc24q_boost)->Arg(25)->Arg(64)->Arg(1029);
+BENCHMARK(bm_crc24q_table)->Arg(25)->Arg(64)->Arg(1029);
+BENCHMARK(bm_crc24q)->Arg(25)->Arg(64)->Arg(1029);
+BENCHMARK(bm_inav_crc_boost);
+BENCHMARK(bm_inav_crc);
+BENCHMARK(bm_has_crc_boost);
+BENCHMARK(bm_has_crc);
+BENCHMARK_MAIN();
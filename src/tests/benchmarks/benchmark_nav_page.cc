@@ -0,0 +1,166 @@
+/*!
+ * \file benchmark_nav_page.cc
+ * \brief Benchmark for the decoding of Galileo I/NAV pages from strings of
+ * '0' and '1' characters and from packed bits.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "Galileo_INAV.h"
+#include "galileo_inav_message.h"
+#include "nav_page_bits.h"
+#include <benchmark/benchmark.h>
+#include <boost/crc.hpp>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+const int NPAGES = 30;  // one I/NAV subframe
+
+
+// Hard decisions of the even and odd page parts, as produced by the Viterbi decoder
+std::vector<std::array<int32_t, GALILEO_INAV_PAGE_PART_BITS>> make_page_parts()
+{
+    std::mt19937 gen(1234);
+    std::vector<std::array<int32_t, GALILEO_INAV_PAGE_PART_BITS>> parts;
+    for (int page = 0; page < NPAGES; page++)
+        {
+            Nav_Page_Bits<GALILEO_INAV_PAGE_BITS> frame;
+            for (std::size_t i = 0; i < GALILEO_INAV_PAGE_BITS; i++)
+                {
+                    frame.set(i, (gen() & 1U) != 0U);
+                }
+            frame.write(0, 2, 0);                                 // even, nominal
+            frame.write(2, GALILEO_PAGE_TYPE_BITS, page % 11);    // word type 0 to 10
+            frame.write(GALILEO_INAV_EVEN_PAGE_PART_BITS, 2, 2);  // odd, nominal
+            std::array<uint8_t, GALILEO_DATA_FRAME_BYTES> bytes{};
+            frame.to_bytes(0, GALILEO_DATA_FRAME_BITS, bytes.data());
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            crc.process_bytes(bytes.data(), bytes.size());
+            frame.write(GALILEO_DATA_FRAME_BITS, 24, crc.checksum());
+
+            std::array<int32_t, GALILEO_INAV_PAGE_PART_BITS> even{};
+            std::array<int32_t, GALILEO_INAV_PAGE_PART_BITS> odd{};
+            for (std::size_t i = 0; i < GALILEO_INAV_EVEN_PAGE_PART_BITS; i++)
+                {
+                    even[i] = frame[i] ? 1 : 0;
+                }
+            for (std::size_t i = 0; i < GALILEO_INAV_PAGE_PART_BITS; i++)
+                {
+                    odd[i] = frame[GALILEO_INAV_EVEN_PAGE_PART_BITS + i] ? 1 : 0;
+                }
+            parts.push_back(even);
+            parts.push_back(odd);
+        }
+    return parts;
+}
+
+
+void bm_inav_string_pages(benchmark::State& state)
+{
+    const auto parts = make_page_parts();
+    Galileo_Inav_Message message;
+    for (auto _ : state)
+        {
+            for (std::size_t p = 0; p < parts.size(); p++)
+                {
+                    std::string page_string;
+                    for (const auto bit : parts[p])
+                        {
+                            page_string.push_back(bit > 0 ? '1' : '0');
+                        }
+                    message.split_page(page_string, static_cast<int32_t>(p % 2));
+                }
+            benchmark::DoNotOptimize(message.get_flag_CRC_test());
+        }
+    state.SetItemsProcessed(state.iterations() * NPAGES);
+}
+
+
+void bm_inav_packed_pages(benchmark::State& state)
+{
+    const auto parts = make_page_parts();
+    Galileo_Inav_Message message;
+    for (auto _ : state)
+        {
+            for (std::size_t p = 0; p < parts.size(); p++)
+                {
+                    Galileo_Inav_Page_Part page_part;
+                    page_part.assign(parts[p].data(), parts[p].size());
+                    message.split_page(page_part, static_cast<int32_t>(p % 2));
+                }
+            benchmark::DoNotOptimize(message.get_flag_CRC_test());
+        }
+    state.SetItemsProcessed(state.iterations() * NPAGES);
+}
+
+
+// Field extraction as done before with std::bitset, one bit at a time
+void bm_fields_bitset(benchmark::State& state)
+{
+    std::mt19937 gen(4321);
+    std::bitset<GALILEO_DATA_JK_BITS> bits;
+    for (int i = 0; i < GALILEO_DATA_JK_BITS; i++)
+        {
+            bits[i] = (gen() & 1U) != 0U;
+        }
+    const std::vector<std::vector<std::pair<int32_t, int32_t>>> fields = {IOD_NAV_1_BIT, T0_E_1_BIT, M0_1_BIT, E_1_BIT, A_1_BIT};
+    for (auto _ : state)
+        {
+            uint64_t sum = 0;
+            for (const auto& parameter : fields)
+                {
+                    uint64_t value = 0ULL;
+                    for (const auto& p : parameter)
+                        {
+                            for (int j = 0; j < p.second; j++)
+                                {
+                                    value <<= 1U;
+                                    value |= static_cast<uint64_t>(bits[GALILEO_DATA_JK_BITS - p.first - j]);
+                                }
+                        }
+                    sum += value;
+                }
+            benchmark::DoNotOptimize(sum);
+        }
+}
+
+
+void bm_fields_packed(benchmark::State& state)
+{
+    std::mt19937 gen(4321);
+    Galileo_Inav_Data_Jk bits;
+    for (std::size_t i = 0; i < GALILEO_DATA_JK_BITS; i++)
+        {
+            bits.set(i, (gen() & 1U) != 0U);
+        }
+    const std::vector<std::vector<std::pair<int32_t, int32_t>>> fields = {IOD_NAV_1_BIT, T0_E_1_BIT, M0_1_BIT, E_1_BIT, A_1_BIT};
+    for (auto _ : state)
+        {
+            uint64_t sum = 0;
+            for (const auto& parameter : fields)
+                {
+                    sum += bits.read_unsigned(parameter);
+                }
+            benchmark::DoNotOptimize(sum);
+        }
+}
+
+
+BENCHMARK(bm_inav_string_pages);
+BENCHMARK(bm_inav_packed_pages);
+BENCHMARK(bm_fields_bitset);
+BENCHMARK(bm_fields_packed);
+BENCHMARK_MAIN();
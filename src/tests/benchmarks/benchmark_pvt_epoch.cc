@@ -0,0 +1,132 @@
+/*!
+ * \file benchmark_pvt_epoch.cc
+ * \brief Benchmark for the selection of the observables of an epoch in the
+ * PVT block (Pvt_Observable_Filter::select), counting the heap allocations
+ * per epoch.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "galileo_ephemeris.h"
+#include "gnss_synchro.h"
+#include "gnss_synchro_epoch.h"
+#include "gps_ephemeris.h"
+#include "pvt_observable_filter.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+// the replacements below pair operator new with free()
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+std::atomic<uint64_t> allocations{0};  // calls to operator new
+}
+
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+    return p;
+}
+
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete(void* p, std::size_t /* size */) noexcept
+{
+    std::free(p);
+}
+
+
+const uint32_t NCHANNELS = 24;
+
+
+Gnss_Synchro_Epoch make_epoch()
+{
+    // half GPS L1 C/A, half Galileo E1B
+    Gnss_Synchro_Epoch epoch;
+    epoch.reset(NCHANNELS);
+    for (uint32_t i = 0; i < NCHANNELS; i++)
+        {
+            const bool gps = (i % 2 == 0);
+            Gnss_Synchro gs;
+            gs.System = gps ? 'G' : 'E';
+            std::memcpy(gs.Signal, gps ? "1C" : "1B", 3);
+            gs.PRN = i + 1;
+            gs.Channel_ID = static_cast<int32_t>(i);
+            gs.Pseudorange_m = 2.0e7 + i;
+            gs.Flag_valid_word = true;
+            gs.Flag_valid_pseudorange = true;
+            epoch.set(i, gs);
+        }
+    return epoch;
+}
+
+
+// state.range(0) == 0: the same channels are valid at every epoch
+// state.range(0) == 1: every other epoch, a quarter of the channels lose their pseudorange
+void bm_select_observables(benchmark::State& state)
+{
+    const Gnss_Synchro_Epoch full_epoch = make_epoch();
+    Gnss_Synchro_Epoch partial_epoch = full_epoch;
+    partial_epoch.reset(NCHANNELS);
+    for (uint32_t i = 0; i < NCHANNELS; i++)
+        {
+            if (i % 4 != 3)
+                {
+                    partial_epoch.set(i, full_epoch.get(i));
+                }
+        }
+    const bool changing_channels = state.range(0) != 0;
+
+    Pvt_Observable_Filter filter(false);
+    for (int prn = 1; prn <= 36; prn++)
+        {
+            Gps_Ephemeris gps_eph;
+            gps_eph.PRN = prn;
+            filter.update(gps_eph);
+            Galileo_Ephemeris gal_eph;
+            gal_eph.PRN = prn;
+            filter.update(gal_eph);
+        }
+    std::map<int, Gnss_Synchro> observables_map;
+    filter.select(full_epoch, observables_map);
+
+    uint64_t n = 0;
+    const uint64_t allocations_start = allocations.load();
+    for (auto _ : state)
+        {
+            filter.select((changing_channels && (n++ % 2 == 1)) ? partial_epoch : full_epoch, observables_map);
+            benchmark::DoNotOptimize(observables_map);
+        }
+    state.counters["allocs_per_epoch"] = benchmark::Counter(static_cast<double>(allocations.load() - allocations_start) / static_cast<double>(state.iterations()));
+}
+
+
+BENCHMARK(bm_select_observables)->Arg(0)->Arg(1);
+BENCHMARK_MAIN();
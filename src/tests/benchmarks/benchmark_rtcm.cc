@@ -0,0 +1,78 @@
+/*!
+ * \file benchmark_rtcm.cc
+ * \brief Benchmark for the encoding of RTCM 3 MSM7 messages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro.h"
+#include "gps_cnav_ephemeris.h"
+#include "gps_ephemeris.h"
+#include "rtcm.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// GPS L1 C/A and L2C observables of 12 satellites
+std::map<int32_t, Gnss_Synchro> make_rtcm_observables()
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> noise(-1.0, 1.0);
+    const std::vector<uint32_t> prns = {2, 5, 7, 9, 13, 15, 18, 21, 24, 27, 30, 32};
+    const std::vector<std::string> signals = {"1C", "2S"};
+    std::map<int32_t, Gnss_Synchro> observables;
+    int32_t channel = 0;
+    for (std::size_t s = 0; s < prns.size(); s++)
+        {
+            for (const auto& signal : signals)
+                {
+                    Gnss_Synchro gnss_synchro{};
+                    gnss_synchro.System = 'G';
+                    std::memcpy(static_cast<void*>(gnss_synchro.Signal), signal.c_str(), 3);
+                    gnss_synchro.PRN = prns[s];
+                    gnss_synchro.Channel_ID = channel;
+                    gnss_synchro.Pseudorange_m = 2.0e7 + 1.0e5 * static_cast<double>(s) + 10.0 * noise(gen);
+                    gnss_synchro.Carrier_phase_rads = gnss_synchro.Pseudorange_m / 0.19 * 6.283 + 100.0 * noise(gen);
+                    gnss_synchro.Carrier_Doppler_hz = 4000.0 * noise(gen);
+                    gnss_synchro.CN0_dB_hz = 40.0 + 10.0 * noise(gen);
+                    gnss_synchro.Flag_valid_pseudorange = true;
+                    observables[channel++] = gnss_synchro;
+                }
+        }
+    return observables;
+}
+
+
+void bm_rtcm_msm7(benchmark::State& state)
+{
+    const auto observables = make_rtcm_observables();
+    Gps_Ephemeris gps_eph;
+    gps_eph.PRN = 5;
+    gps_eph.WN = 2250;
+    gps_eph.tow = 345600;
+    Rtcm rtcm;
+    double obs_time = 345600.123;
+    for (auto _ : state)
+        {
+            const std::string message = rtcm.print_MSM_7(gps_eph, Gps_CNAV_Ephemeris(), Galileo_Ephemeris(), Glonass_Gnav_Ephemeris(), obs_time, observables, 1234, 0, 0, 0, false, false);
+            benchmark::DoNotOptimize(message.data());
+            obs_time += 1.0;
+        }
+}
+
+
+BENCHMARK(bm_rtcm_msm7);
+BENCHMARK_MAIN();
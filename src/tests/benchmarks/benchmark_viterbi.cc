@@ -0,0 +1,91 @@
+/*!
+ * \file benchmark_viterbi.cc
+ * \brief Benchmark for the Viterbi decoder of the Galileo navigation messages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "viterbi_decoder.h"
+#include <benchmark/benchmark.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+const int32_t INAV_DATA_LENGTH = 114;  // bits of an I/NAV page part, without tail
+const int32_t INAV_SYMBOLS = 240;      // symbols of an I/NAV page part
+
+
+std::vector<float> make_soft_symbols(int32_t n)
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> noise(0.0, 0.5);
+    std::vector<float> symbols(n);
+    for (auto& s : symbols)
+        {
+            s = ((gen() & 1U) ? 1.0F : -1.0F) + noise(gen);
+        }
+    return symbols;
+}
+
+
+// Add-compare-select steps of an I/NAV page part, with the generic
+// implementation or with the best one for this machine
+void bm_conv_k7_r2_kernel(benchmark::State& state, bool generic)
+{
+    const int32_t stages = INAV_SYMBOLS / 2;
+    const auto symbols = make_soft_symbols(INAV_SYMBOLS);
+    std::vector<float> branch_signs(64);
+    std::vector<float> metrics(64);
+    std::vector<uint32_t> decisions(2 * stages);
+    for (int32_t j = 0; j < 64; j++)
+        {
+            branch_signs[j] = (j * 7 + 3) % 5 < 2 ? 1.0F : -1.0F;
+        }
+    for (auto _ : state)
+        {
+            metrics[0] = 0.0F;
+            std::fill(metrics.begin() + 1, metrics.end(), -1e7F);
+            if (generic)
+                {
+                    volk_gnsssdr_32f_conv_k7_r2_32u_manual(decisions.data(), metrics.data(), symbols.data(), branch_signs.data(), stages, "generic");
+                }
+            else
+                {
+                    volk_gnsssdr_32f_conv_k7_r2_32u(decisions.data(), metrics.data(), symbols.data(), branch_signs.data(), stages);
+                }
+            benchmark::DoNotOptimize(decisions.data());
+        }
+    state.SetItemsProcessed(state.iterations() * stages);
+}
+
+
+void bm_viterbi_inav_page(benchmark::State& state)
+{
+    const auto symbols = make_soft_symbols(INAV_SYMBOLS);
+    Viterbi_Decoder decoder(7, 2, INAV_DATA_LENGTH, {{121, 91}});
+    std::vector<int32_t> bits(INAV_DATA_LENGTH);
+    for (auto _ : state)
+        {
+            decoder.decode(bits, symbols);
+            benchmark::DoNotOptimize(bits.data());
+        }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+BENCHMARK_CAPTURE(bm_conv_k7_r2_kernel, generic, true);
+BENCHMARK_CAPTURE(bm_conv_k7_r2_kernel, best, false);
+BENCHMARK(bm_viterbi_inav_page);
+BENCHMARK_MAIN();
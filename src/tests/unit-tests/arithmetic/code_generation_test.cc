@@ -16,8 +16,12 @@
  * -----------------------------------------------------------------------------
  */
 
+#include "Galileo_E5a.h"
+#include "Galileo_E5b.h"
 #include "Galileo_E6.h"
+#include "galileo_e5_signal_replica.h"
 #include "galileo_e6_signal_replica.h"
+#include "gnss_packed_code.h"
 #include "gnss_signal_replica.h"
 #include "gps_sdr_signal_replica.h"
 #include <array>
@@ -397,3 +401,25 @@ TEST(CodeGenerationTest, GalileoE6BTest)
             ASSERT_FLOAT_EQ(gale6b_code[i].real(), expected_output[i].real());
         }
 }
+
+
+TEST(CodeGenerationTest, GalileoE5PackedPrimaryCodesTest)
+{
+    std::array<int32_t, 4> chips{};
+    for (int32_t prn = 1; prn <= 50; prn++)
+        {
+            const auto e5a_i = galileo_e5_a_packed_primary_code({'5', 'I', '\0'}, prn);
+            const auto e5b_q = galileo_e5_b_packed_primary_code({'7', 'Q', '\0'}, prn);
+            ASSERT_FALSE(e5a_i.empty());
+            ASSERT_FALSE(e5b_q.empty());
+            for (uint32_t i = 0; i < static_cast<uint32_t>(GALILEO_E5A_CODE_LENGTH_CHIPS); i++)
+                {
+                    hex_to_binary_converter(chips, GALILEO_E5A_I_PRIMARY_CODE[prn - 1][i / 4]);
+                    ASSERT_EQ(packed_code_chip(e5a_i, i), chips[i % 4]);
+                    hex_to_binary_converter(chips, GALILEO_E5B_Q_PRIMARY_CODE[prn - 1][i / 4]);
+                    ASSERT_EQ(packed_code_chip(e5b_q, i), chips[i % 4]);
+                }
+        }
+    EXPECT_TRUE(galileo_e5_a_packed_primary_code({'5', 'X', '\0'}, 1).empty());
+    EXPECT_TRUE(galileo_e5_b_packed_primary_code({'7', 'I', '\0'}, 51).empty());
+}
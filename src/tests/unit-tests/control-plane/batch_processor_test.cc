@@ -0,0 +1,170 @@
+/*!
+ * \file batch_processor_test.cc
+ * \brief Tests for the merging of the outputs of the batch mode.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "batch_processor.h"
+#include <array>
+#include <cstdint>
+#include <cstdio>  // for std::remove
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+std::string header_line(const std::string& content, const std::string& label)
+{
+    return content + std::string(60 - content.size(), ' ') + label + std::string(20 - label.size(), ' ') + '\n';
+}
+
+
+std::string obs_header()
+{
+    return header_line("     3.02           OBSERVATION DATA    G (GPS)", "RINEX VERSION / TYPE") +
+           header_line("G    2 C1C L1C", "SYS / # / OBS TYPES") +
+           header_line("", "END OF HEADER");
+}
+
+
+std::string obs_epoch(int second)
+{
+    const std::string sec = (second < 10 ? "0" : "") + std::to_string(second) + ".0000000";
+    return "> 2024 01 05 10 20 " + sec + "  0  1\n" +
+           "G01  20000000.000 8       100.000 7\n";
+}
+
+
+std::vector<std::string> read_lines(const std::string& filename)
+{
+    std::ifstream in(filename);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(in, line))
+        {
+            lines.push_back(line);
+        }
+    return lines;
+}
+}  // namespace
+
+
+TEST(BatchProcessorTest, MergesObservationsTrimmingTheOverlap)
+{
+    const std::vector<std::string> inputs = {"./batch_test_0.24O", "./batch_test_1.24O"};
+    const std::string output = "./batch_test_merged.24O";
+    {
+        std::ofstream first(inputs[0]);
+        first << obs_header();
+        for (int s = 0; s < 5; s++)
+            {
+                first << obs_epoch(s);
+            }
+        std::ofstream second(inputs[1]);
+        second << obs_header();
+        for (int s = 2; s < 8; s++)
+            {
+                second << obs_epoch(s);
+            }
+    }
+
+    ASSERT_TRUE(BatchProcessor::merge_rinex_observations(inputs, output));
+    const auto lines = read_lines(output);
+    ASSERT_EQ(lines.size(), 3U + 8U * 2U);
+    for (int s = 0; s < 8; s++)
+        {
+            EXPECT_EQ(lines[3 + 2 * s], obs_epoch(s).substr(0, obs_epoch(s).find('\n')));
+        }
+    // the phase of the first epoch of the second segment has a loss of lock
+    EXPECT_EQ(lines[3 + 2 * 4 + 1], "G01  20000000.000 8       100.000 7");
+    EXPECT_EQ(lines[3 + 2 * 5 + 1], "G01  20000000.000 8       100.00017");
+    EXPECT_EQ(lines[3 + 2 * 6 + 1], "G01  20000000.000 8       100.000 7");
+
+    for (const auto& filename : inputs)
+        {
+            std::remove(filename.c_str());
+        }
+    std::remove(output.c_str());
+}
+
+
+TEST(BatchProcessorTest, MergesNavigationWithoutRepeatedRecords)
+{
+    const std::vector<std::string> inputs = {"./batch_test_0.24N", "./batch_test_1.24N"};
+    const std::string output = "./batch_test_merged.24N";
+    const std::string header = header_line("     3.02           N: GNSS NAV DATA    G: GPS", "RINEX VERSION / TYPE") +
+                               header_line("", "END OF HEADER");
+    const std::string record_a = "G01 2024 01 05 10 00 00 1.0\n     2.0\n";
+    const std::string record_b = "G02 2024 01 05 10 00 00 3.0\n     4.0\n";
+    const std::string record_c = "G01 2024 01 05 12 00 00 5.0\n     6.0\n";
+    {
+        std::ofstream first(inputs[0]);
+        first << header << record_a << record_b;
+        std::ofstream second(inputs[1]);
+        second << header << record_b << record_a << record_c;
+    }
+
+    ASSERT_TRUE(BatchProcessor::merge_rinex_navigation(inputs, output));
+    std::ifstream merged(output);
+    const std::string content((std::istreambuf_iterator<char>(merged)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, header + record_a + record_b + record_c);
+
+    for (const auto& filename : inputs)
+        {
+            std::remove(filename.c_str());
+        }
+    std::remove(output.c_str());
+}
+
+
+TEST(BatchProcessorTest, MergesPvtDumps)
+{
+    constexpr size_t record_size = 187;
+    const std::vector<std::string> inputs = {"./batch_test_pvt_0.dat", "./batch_test_pvt_1.dat"};
+    const std::string output = "./batch_test_pvt_merged.dat";
+    const auto write_records = [](const std::string& filename, uint32_t first_tow_ms, uint32_t last_tow_ms) {
+        std::ofstream out(filename, std::ios::binary);
+        std::array<char, record_size> record{};
+        const uint32_t week = 2300;
+        for (uint32_t tow_ms = first_tow_ms; tow_ms <= last_tow_ms; tow_ms += 500)
+            {
+                std::memcpy(record.data(), &tow_ms, sizeof(uint32_t));
+                std::memcpy(record.data() + sizeof(uint32_t), &week, sizeof(uint32_t));
+                out.write(record.data(), record.size());
+            }
+    };
+    write_records(inputs[0], 100000, 110000);
+    write_records(inputs[1], 105000, 120000);
+
+    ASSERT_TRUE(BatchProcessor::merge_pvt_dumps(inputs, output));
+    std::ifstream merged(output, std::ios::binary);
+    std::array<char, record_size> record{};
+    uint32_t expected_tow_ms = 100000;
+    while (merged.read(record.data(), record.size()))
+        {
+            uint32_t tow_ms;
+            std::memcpy(&tow_ms, record.data(), sizeof(uint32_t));
+            EXPECT_EQ(tow_ms, expected_tow_ms);
+            expected_tow_ms += 500;
+        }
+    EXPECT_EQ(expected_tow_ms, 120500U);
+
+    for (const auto& filename : inputs)
+        {
+            std::remove(filename.c_str());
+        }
+    std::remove(output.c_str());
+}
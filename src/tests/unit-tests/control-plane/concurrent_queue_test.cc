@@ -0,0 +1,106 @@
+/*!
+ * \file concurrent_queue_test.cc
+ * \brief  This file implements unit tests for the Concurrent_Queue class.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_queue.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+TEST(ConcurrentQueueTest, FifoWithOverflow)
+{
+    Concurrent_Queue<int> queue(8);
+    for (int i = 0; i < 100; i++)
+        {
+            queue.push(i);
+        }
+    EXPECT_EQ(queue.size(), 100U);
+
+    int value = -1;
+    for (int i = 0; i < 50; i++)
+        {
+            ASSERT_TRUE(queue.try_pop(value));
+            EXPECT_EQ(value, i);
+        }
+    std::vector<int> values;
+    EXPECT_EQ(queue.drain(values, 20), 20U);
+    EXPECT_EQ(queue.drain(values), 30U);
+    for (int i = 0; i < 50; i++)
+        {
+            EXPECT_EQ(values[i], i + 50);
+        }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_FALSE(queue.timed_wait_and_pop(value, 1));
+
+    const auto stats = queue.stats();
+    EXPECT_EQ(stats.pushed, 100U);
+    EXPECT_EQ(stats.popped, 100U);
+    EXPECT_EQ(stats.overflowed, 92U);
+    EXPECT_EQ(stats.max_depth, 100U);
+}
+
+
+TEST(ConcurrentQueueTest, MoveOnlyItems)
+{
+    Concurrent_Queue<std::unique_ptr<int>> queue(4);
+    for (int i = 0; i < 6; i++)
+        {
+            queue.push(std::unique_ptr<int>(new int(i)));
+        }
+    std::unique_ptr<int> item;
+    queue.wait_and_pop(item);
+    ASSERT_TRUE(item != nullptr);
+    EXPECT_EQ(*item, 0);
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+}
+
+
+TEST(ConcurrentQueueTest, MultipleProducers)
+{
+    const int n_producers = 4;
+    const int n_items = 20000;
+    Concurrent_Queue<std::pair<int, int>> queue(64, 100);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < n_producers; p++)
+        {
+            producers.emplace_back([&queue, p] {
+                for (int i = 0; i < n_items; i++)
+                    {
+                        queue.push(std::make_pair(p, i));
+                    }
+            });
+        }
+
+    // items of each producer must arrive in order
+    std::vector<int> next(n_producers, 0);
+    std::pair<int, int> item;
+    for (int i = 0; i < n_producers * n_items; i++)
+        {
+            ASSERT_TRUE(queue.timed_wait_and_pop(item, 1000));
+            EXPECT_EQ(item.second, next[item.first]);
+            next[item.first] = item.second + 1;
+        }
+    for (auto& t : producers)
+        {
+            t.join();
+        }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.stats().popped, static_cast<uint64_t>(n_producers * n_items));
+}
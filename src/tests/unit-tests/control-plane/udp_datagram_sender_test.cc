@@ -0,0 +1,118 @@
+/*!
+ * \file udp_datagram_sender_test.cc
+ * \brief Implements Unit Tests for the Udp_Datagram_Sender class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_datagram_sender.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+std::vector<std::string> receive_datagrams(boost::asio::ip::udp::socket& socket, size_t n_datagrams)
+{
+    std::vector<std::string> received;
+    std::array<char, 2048> buffer{};
+    boost::asio::ip::udp::endpoint sender_endpoint;
+    for (size_t i = 0; i < n_datagrams; i++)
+        {
+            const size_t length = socket.receive_from(boost::asio::buffer(buffer), sender_endpoint);
+            received.emplace_back(buffer.data(), length);
+        }
+    return received;
+}
+}  // namespace
+
+
+TEST(UdpDatagramSenderTest, SendsInCallerThread)
+{
+    b_io_context io_context;
+    boost::asio::ip::udp::socket receiver(io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    const uint16_t port = receiver.local_endpoint().port();
+
+    Udp_Datagram_Sender sender({"127.0.0.1"}, port, 0);
+    EXPECT_FALSE(sender.threaded());
+    for (int i = 0; i < 10; i++)
+        {
+            std::string datagram = sender.get_buffer();
+            EXPECT_TRUE(datagram.empty());
+            datagram.append("epoch ").append(std::to_string(i));
+            EXPECT_TRUE(sender.send(std::move(datagram)));
+        }
+
+    const std::vector<std::string> received = receive_datagrams(receiver, 10);
+    for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(received[i], "epoch " + std::to_string(i));
+        }
+    const auto stats = sender.statistics();
+    EXPECT_EQ(stats.messages_sent, 10U);
+    EXPECT_EQ(stats.send_errors, 0U);
+}
+
+
+TEST(UdpDatagramSenderTest, SendsFromQueueToAllEndpoints)
+{
+    b_io_context io_context;
+    boost::asio::ip::udp::socket receiver_a(io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    const uint16_t port = receiver_a.local_endpoint().port();
+    boost::asio::ip::udp::socket receiver_b(io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::make_address_v4("127.0.0.2"), port));
+
+    const size_t n_datagrams = 50;
+    {
+        Udp_Datagram_Sender sender({"127.0.0.1", "127.0.0.2", "not an address"}, port, n_datagrams);
+        EXPECT_TRUE(sender.threaded());
+        for (size_t i = 0; i < n_datagrams; i++)
+            {
+                std::string datagram = sender.get_buffer();
+                datagram.assign(i + 1, static_cast<char>('a' + i % 26));
+                EXPECT_TRUE(sender.send(std::move(datagram)));
+            }
+        // the destructor sends whatever is still queued
+    }
+
+    for (auto* receiver : {&receiver_a, &receiver_b})
+        {
+            const std::vector<std::string> received = receive_datagrams(*receiver, n_datagrams);
+            for (size_t i = 0; i < n_datagrams; i++)
+                {
+                    EXPECT_EQ(received[i], std::string(i + 1, static_cast<char>('a' + i % 26)));
+                }
+        }
+}
+
+
+TEST(UdpDatagramSenderTest, DropsWhenQueueIsFull)
+{
+    b_io_context io_context;
+    boost::asio::ip::udp::socket receiver(io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    const uint16_t port = receiver.local_endpoint().port();
+
+    Udp_Datagram_Sender sender({"127.0.0.1"}, port, 1);
+    size_t accepted = 0;
+    for (int i = 0; i < 1000; i++)
+        {
+            if (sender.send(std::string(1000, 'x')))
+                {
+                    accepted++;
+                }
+        }
+    const auto stats = sender.statistics();
+    EXPECT_EQ(accepted + stats.datagrams_dropped, 1000U);
+    EXPECT_LE(stats.max_depth, 1U);
+}
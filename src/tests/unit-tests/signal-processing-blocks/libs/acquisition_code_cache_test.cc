@@ -0,0 +1,102 @@
+/*!
+ * \file acquisition_code_cache_test.cc
+ * \brief This file implements unit tests for the Acquisition_Code_Cache class
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_code_cache.h"
+#include <gtest/gtest.h>
+#include <complex>
+#include <memory>
+
+
+namespace
+{
+Acquisition_Code_Cache::Key make_code_cache_key(uint32_t prn)
+{
+    Acquisition_Code_Cache::Key key;
+    key.system = 'G';
+    key.signal[0] = '1';
+    key.signal[1] = 'C';
+    key.prn = prn;
+    key.fs = 4000000;
+    key.fft_size = 4000;
+    return key;
+}
+
+
+std::shared_ptr<const Acquisition_Code_Cache::Code_Spectrum> make_spectrum(float value)
+{
+    return std::make_shared<const Acquisition_Code_Cache::Code_Spectrum>(4000, std::complex<float>(value, -value));
+}
+}  // namespace
+
+
+TEST(AcquisitionCodeCacheTest, DisabledByDefault)
+{
+    auto& cache = Acquisition_Code_Cache::instance();
+    cache.set_capacity(0);
+    EXPECT_FALSE(cache.enabled());
+    cache.insert(make_code_cache_key(1), make_spectrum(1.0));
+    EXPECT_EQ(cache.entries(), 0U);
+    EXPECT_EQ(cache.find(make_code_cache_key(1)), nullptr);
+}
+
+
+TEST(AcquisitionCodeCacheTest, FindsInsertedSpectra)
+{
+    auto& cache = Acquisition_Code_Cache::instance();
+    cache.clear();
+    cache.set_capacity(1024 * 1024);
+    ASSERT_TRUE(cache.enabled());
+
+    cache.insert(make_code_cache_key(1), make_spectrum(1.0));
+    cache.insert(make_code_cache_key(2), make_spectrum(2.0));
+    EXPECT_EQ(cache.entries(), 2U);
+    EXPECT_EQ(cache.size_bytes(), 2U * 4000U * sizeof(std::complex<float>));
+
+    const auto spectrum = cache.find(make_code_cache_key(2));
+    ASSERT_NE(spectrum, nullptr);
+    EXPECT_EQ((*spectrum)[0], std::complex<float>(2.0, -2.0));
+
+    // Any difference in the key is a miss
+    auto other_key = make_code_cache_key(2);
+    other_key.variant = 1;
+    EXPECT_EQ(cache.find(other_key), nullptr);
+
+    cache.set_capacity(0);
+    EXPECT_EQ(cache.entries(), 0U);
+}
+
+
+TEST(AcquisitionCodeCacheTest, EvictsLeastRecentlyUsed)
+{
+    auto& cache = Acquisition_Code_Cache::instance();
+    cache.clear();
+    // Room for two spectra
+    cache.set_capacity(2U * 4000U * sizeof(std::complex<float>));
+
+    cache.insert(make_code_cache_key(1), make_spectrum(1.0));
+    cache.insert(make_code_cache_key(2), make_spectrum(2.0));
+    const auto held = cache.find(make_code_cache_key(1));  // PRN 2 is now the oldest
+    cache.insert(make_code_cache_key(3), make_spectrum(3.0));
+
+    EXPECT_EQ(cache.entries(), 2U);
+    EXPECT_NE(cache.find(make_code_cache_key(1)), nullptr);
+    EXPECT_EQ(cache.find(make_code_cache_key(2)), nullptr);
+    EXPECT_NE(cache.find(make_code_cache_key(3)), nullptr);
+
+    // Evicted spectra remain valid while they are held
+    cache.set_capacity(0);
+    ASSERT_NE(held, nullptr);
+    EXPECT_EQ((*held)[3999], std::complex<float>(1.0, -1.0));
+}
@@ -0,0 +1,89 @@
+/*!
+ * \file acquisition_thread_pool_test.cc
+ * \brief This file implements unit tests for the Acquisition_Thread_Pool class
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acquisition_thread_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+
+TEST(AcquisitionThreadPoolTest, NotRunningRejectsJobs)
+{
+    auto& pool = Acquisition_Thread_Pool::instance();
+    pool.stop();
+    EXPECT_FALSE(pool.running());
+    EXPECT_FALSE(pool.try_submit([]() {}));
+}
+
+
+TEST(AcquisitionThreadPoolTest, RunsAllAcceptedJobs)
+{
+    auto& pool = Acquisition_Thread_Pool::instance();
+    pool.start(4, 1000);
+    ASSERT_TRUE(pool.running());
+
+    std::atomic<int> executed{0};
+    int accepted = 0;
+    for (int i = 0; i < 500; i++)
+        {
+            if (pool.try_submit([&executed]() { executed++; }))
+                {
+                    accepted++;
+                }
+        }
+    pool.stop();
+
+    EXPECT_EQ(accepted, 500);
+    EXPECT_EQ(executed.load(), accepted);
+    const auto stats = pool.statistics();
+    EXPECT_EQ(stats.jobs_executed, static_cast<uint64_t>(accepted));
+    EXPECT_EQ(stats.jobs_rejected, 0U);
+    EXPECT_GE(stats.max_run_us, stats.mean_run_us);
+}
+
+
+TEST(AcquisitionThreadPoolTest, BoundedQueue)
+{
+    auto& pool = Acquisition_Thread_Pool::instance();
+    pool.start(1, 2);
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    std::atomic<int> executed{0};
+    auto blocking_job = [&started, &release, &executed]() {
+        started = true;
+        while (!release)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        executed++;
+    };
+
+    // The only worker takes the first job, and then the queue accepts two more
+    EXPECT_TRUE(pool.try_submit(blocking_job));
+    while (!started)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    EXPECT_TRUE(pool.try_submit(blocking_job));
+    EXPECT_TRUE(pool.try_submit(blocking_job));
+    EXPECT_FALSE(pool.try_submit(blocking_job));
+    EXPECT_EQ(pool.statistics().jobs_rejected, 1U);
+
+    release = true;
+    pool.stop();
+    EXPECT_EQ(executed.load(), 3);
+}
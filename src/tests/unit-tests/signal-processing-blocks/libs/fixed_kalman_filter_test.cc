@@ -0,0 +1,206 @@
+/*!
+ * \file fixed_kalman_filter_test.cc
+ * \brief This file implements unit tests for the Fixed_Kalman_Filter class,
+ * using Armadillo as the reference.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fixed_kalman_filter.h"
+#include <armadillo>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+
+namespace
+{
+template <std::size_t N, std::size_t M>
+arma::mat to_arma(const std::array<std::array<double, M>, N>& a)
+{
+    arma::mat m(N, M);
+    for (std::size_t i = 0; i < N; i++)
+        {
+            for (std::size_t j = 0; j < M; j++)
+                {
+                    m(i, j) = a[i][j];
+                }
+        }
+    return m;
+}
+
+
+template <std::size_t N>
+arma::vec to_arma(const std::array<double, N>& a)
+{
+    arma::vec v(N);
+    for (std::size_t i = 0; i < N; i++)
+        {
+            v(i) = a[i];
+        }
+    return v;
+}
+}  // namespace
+
+
+TEST(FixedKalmanFilterTest, Scalar)
+{
+    Fixed_Kalman_Filter<1, 1> kf;
+    kf.F[0][0] = 1.0;
+    kf.H[0][0] = 1.0;
+    kf.Q[0][0] = 0.1;
+    kf.R[0][0] = 0.5;
+    kf.P[0][0] = 1.0;
+    kf.x[0] = 0.0;
+
+    kf.predict();
+    EXPECT_DOUBLE_EQ(kf.P[0][0], 1.1);
+    ASSERT_TRUE(kf.update({{2.0}}));
+    const double K = 1.1 / 1.6;
+    EXPECT_DOUBLE_EQ(kf.x[0], 2.0 * K);
+    EXPECT_NEAR(kf.P[0][0], (1.0 - K) * 1.1, 1e-15);
+}
+
+
+TEST(FixedKalmanFilterTest, TrackingModel)
+{
+    // Same model as kf_tracking, with the discriminator outputs as innovation
+    const double Ti = 0.001;
+    const double beta = 1.023e6 / 1575.42e6;
+    const double pi = 3.1415926535898;
+    Fixed_Kalman_Filter<4, 2> kf;
+    kf.F = {{{{1.0, 0.0, beta * Ti, beta * Ti * Ti / 2.0}},
+        {{0.0, 1.0, 2.0 * pi * Ti, pi * Ti * Ti}},
+        {{0.0, 0.0, 1.0, Ti}},
+        {{0.0, 0.0, 0.0, 1.0}}}};
+    kf.H = {{{{1.0, 0.0, -beta * Ti / 2.0, beta * Ti * Ti / 6.0}},
+        {{0.0, 1.0, -pi * Ti, pi * Ti * Ti / 3.0}}}};
+    kf.R = {{{{0.01, 0.0}}, {{0.0, 0.25}}}};
+    kf.Q = {{{{1e-6, 0.0, 0.0, 0.0}}, {{0.0, 1e-3, 0.0, 0.0}}, {{0.0, 0.0, 0.1, 0.0}}, {{0.0, 0.0, 0.0, 1.0}}}};
+    kf.P = {{{{0.25, 0.0, 0.0, 0.0}}, {{0.0, 1.0, 0.0, 0.0}}, {{0.0, 0.0, 100.0, 0.0}}, {{0.0, 0.0, 0.0, 10.0}}}};
+    kf.x = {{0.1, 0.0, 1200.0, 0.0}};
+
+    const arma::mat F = to_arma(kf.F);
+    const arma::mat H = to_arma(kf.H);
+    const arma::mat R = to_arma(kf.R);
+    const arma::mat Q = to_arma(kf.Q);
+    arma::mat P = to_arma(kf.P);
+    arma::vec x = to_arma(kf.x);
+
+    std::mt19937 gen(1234);
+    std::normal_distribution<double> noise(0.0, 0.1);
+    for (int epoch = 0; epoch < 1000; epoch++)
+        {
+            const double code_disc = noise(gen);
+            const double phase_disc = noise(gen);
+
+            x = F * x;
+            P = F * P * F.t() + Q;
+            const arma::vec z = {code_disc, phase_disc};
+            const arma::mat K = P * H.t() * arma::inv(H * P * H.t() + R);
+            x = x + K * z;
+            P = (arma::eye(4, 4) - K * H) * P;
+            x(0) = 0.0;
+
+            kf.predict();
+            ASSERT_TRUE(kf.update_innovation({{code_disc, phase_disc}}));
+            kf.x[0] = 0.0;
+        }
+    for (std::size_t i = 0; i < 4; i++)
+        {
+            EXPECT_NEAR(kf.x[i], x(i), 1e-9 * (1.0 + std::fabs(x(i))));
+            for (std::size_t j = 0; j < 4; j++)
+                {
+                    EXPECT_NEAR(kf.P[i][j], P(i, j), 1e-9 * (1.0 + std::fabs(P(i, j))));
+                    // Joseph form keeps the covariance symmetric
+                    EXPECT_DOUBLE_EQ(kf.P[i][j], kf.P[j][i]);
+                }
+        }
+}
+
+
+TEST(FixedKalmanFilterTest, PositionVelocityModel)
+{
+    // Same model as Pvt_Kf, which needs the generic 6x6 inverse
+    const double Ti = 0.1;
+    Fixed_Kalman_Filter<6, 6> kf;
+    for (std::size_t i = 0; i < 6; i++)
+        {
+            kf.F[i][i] = 1.0;
+            kf.H[i][i] = 1.0;
+            kf.R[i][i] = i < 3 ? 25.0 : 0.04;
+            kf.Q[i][i] = i < 3 ? 1.0 : 0.01;
+            kf.P[i][i] = i < 3 ? 100.0 : 1.0;
+        }
+    kf.F[0][3] = Ti;
+    kf.F[1][4] = Ti;
+    kf.F[2][5] = Ti;
+    kf.H[0][1] = 0.3;  // make S non-diagonal
+    kf.H[4][2] = -0.2;
+    kf.x = {{4.9e6, -3.6e5, 4.0e6, 1.0, -2.0, 0.5}};
+
+    const arma::mat F = to_arma(kf.F);
+    const arma::mat H = to_arma(kf.H);
+    const arma::mat R = to_arma(kf.R);
+    const arma::mat Q = to_arma(kf.Q);
+    arma::mat P = to_arma(kf.P);
+    arma::vec x = to_arma(kf.x);
+
+    std::mt19937 gen(4321);
+    std::normal_distribution<double> noise(0.0, 5.0);
+    for (int epoch = 0; epoch < 100; epoch++)
+        {
+            Fixed_Kalman_Filter<6, 6>::Measurement z{};
+            for (std::size_t i = 0; i < 6; i++)
+                {
+                    z[i] = kf.x[i] + noise(gen);
+                }
+
+            x = F * x;
+            P = F * P * F.t() + Q;
+            const arma::mat K = P * H.t() * arma::inv(H * P * H.t() + R);
+            x = x + K * (to_arma(z) - H * x);
+            P = (arma::eye(6, 6) - K * H) * P;
+
+            kf.predict();
+            ASSERT_TRUE(kf.update(z));
+        }
+    for (std::size_t i = 0; i < 6; i++)
+        {
+            EXPECT_NEAR(kf.x[i], x(i), 1e-9 * (1.0 + std::fabs(x(i))));
+            for (std::size_t j = 0; j < 6; j++)
+                {
+                    EXPECT_NEAR(kf.P[i][j], P(i, j), 1e-9 * (1.0 + std::fabs(P(i, j))));
+                }
+        }
+}
+
+
+TEST(FixedKalmanFilterTest, SingularInnovationCovariance)
+{
+    Fixed_Kalman_Filter<2, 2> kf;
+    kf.x = {{1.0, 2.0}};
+    kf.P[0][0] = 3.0;
+    kf.P[1][1] = 4.0;
+    // H = 0 and R = 0 give S = 0
+    EXPECT_FALSE(kf.update({{5.0, 6.0}}));
+    EXPECT_EQ(kf.x[0], 1.0);
+    EXPECT_EQ(kf.x[1], 2.0);
+    EXPECT_EQ(kf.P[0][0], 3.0);
+    EXPECT_EQ(kf.P[1][1], 4.0);
+
+    Fixed_Kalman_Filter<3, 3> kf3;
+    kf3.x = {{1.0, 2.0, 3.0}};
+    EXPECT_FALSE(kf3.update({{5.0, 6.0, 7.0}}));
+    EXPECT_EQ(kf3.x[2], 3.0);
+}
@@ -0,0 +1,41 @@
+/*!
+ * \file gnss_circular_deque_test.cc
+ * \brief  This file implements unit tests for the Gnss_circular_deque class.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_circular_deque.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+
+
+TEST(GnssCircularDequeTest, LowerBound)
+{
+    Gnss_circular_deque<uint64_t> deque(10, 2);
+    const auto less = [](uint64_t a, uint64_t b) { return a < b; };
+    EXPECT_EQ(deque.lower_bound(0, 5ULL, less), 0U);
+
+    // 15 elements in a 10-element buffer: the first five are overwritten
+    for (uint64_t i = 0; i < 15; i++)
+        {
+            deque.push_back(0, 10 * i);
+        }
+    ASSERT_EQ(deque.size(0), 10U);
+    EXPECT_EQ(deque.lower_bound(0, 0ULL, less), 0U);
+    EXPECT_EQ(deque.lower_bound(0, 50ULL, less), 0U);
+    EXPECT_EQ(deque.lower_bound(0, 51ULL, less), 1U);
+    EXPECT_EQ(deque.lower_bound(0, 100ULL, less), 5U);
+    EXPECT_EQ(deque.lower_bound(0, 140ULL, less), 9U);
+    EXPECT_EQ(deque.lower_bound(0, 141ULL, less), 10U);
+    EXPECT_EQ(deque.lower_bound(1, 100ULL, less), 0U);
+}
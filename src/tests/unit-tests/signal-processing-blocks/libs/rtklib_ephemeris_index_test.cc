@@ -0,0 +1,122 @@
+/*!
+ * \file rtklib_ephemeris_index_test.cc
+ * \brief Checks that the selection of broadcast ephemeris with the
+ * per-satellite index gives the same result as the linear search.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+
+TEST(RtklibEphemerisIndexTest, SameSelectionAsLinearSearch)
+{
+    std::mt19937 gen(1234);
+    const int n = 3000;
+    const gtime_t start = gpst2time(2200, 0.0);
+    std::uniform_real_distribution<double> toe_s(0.0, 3.0 * 604800.0);
+    std::uniform_int_distribution<int> sat_gps(1, NSATGPS);
+    std::uniform_int_distribution<int> sat_gal(NSATGPS + NSATGLO + 1, NSATGPS + NSATGLO + NSATGAL);
+    std::uniform_int_distribution<int> iode(0, 7);
+
+    std::vector<eph_t> eph(n);
+    std::vector<geph_t> geph(n);
+    std::vector<seph_t> seph(n);
+    for (int i = 0; i < n; i++)
+        {
+            // round toe to 16 s, so that ties in the toe distance are frequent
+            const double toe = 16.0 * static_cast<int>(toe_s(gen) / 16.0);
+            eph[i].sat = (i % 2 == 0) ? sat_gps(gen) : sat_gal(gen);
+            eph[i].iode = iode(gen);
+            eph[i].toe = timeadd(start, toe);
+            geph[i].sat = NSATGPS + 1 + i % (NSATGLO > 0 ? NSATGLO : 1);
+            geph[i].iode = iode(gen);
+            geph[i].toe = timeadd(start, toe / 20.0);
+            seph[i].sat = sat_gps(gen);
+            seph[i].t0 = timeadd(start, toe / 400.0);
+        }
+    // some ephemeris exactly one week apart, selected through the week crossover
+    eph[1].toe = timeadd(eph[0].toe, 604800.0);
+    eph[1].sat = eph[0].sat;
+
+    // nav_t is too large for the stack
+    std::vector<nav_t> navs(2);
+    nav_t &linear = navs[0];
+    nav_t *indexed = &navs[1];
+    linear.eph = eph.data();
+    linear.n = n;
+    linear.geph = geph.data();
+    linear.ng = n;
+    linear.seph = seph.data();
+    linear.ns = n;
+    indexed->eph = eph.data();
+    indexed->n = n;
+    indexed->geph = geph.data();
+    indexed->ng = n;
+    indexed->seph = seph.data();
+    indexed->ns = n;
+    ASSERT_EQ(buildephidx(indexed), 1);
+
+    std::uniform_real_distribution<double> query_s(-86400.0, 3.0 * 604800.0 + 86400.0);
+    std::uniform_int_distribution<int> query_iode(-1, 7);
+    int found = 0;
+    for (int q = 0; q < 20000; q++)
+        {
+            const gtime_t time = timeadd(start, 16.0 * static_cast<int>(query_s(gen) / 16.0) + ((q % 3 == 0) ? 0.0 : 0.25));
+            const int sat = (q % 2 == 0) ? sat_gps(gen) : sat_gal(gen);
+            const int qiode = query_iode(gen);
+            const eph_t *a = seleph(time, sat, qiode, &linear);
+            EXPECT_EQ(a, seleph(time, sat, qiode, indexed));
+            found += (a != nullptr);
+
+            const gtime_t gtime = timeadd(start, query_s(gen) / 20.0);
+            const int gsat = NSATGPS + 1 + q % (NSATGLO > 0 ? NSATGLO : 1);
+            EXPECT_EQ(selgeph(gtime, gsat, qiode, &linear), selgeph(gtime, gsat, qiode, indexed));
+
+            const gtime_t stime = timeadd(start, query_s(gen) / 400.0);
+            EXPECT_EQ(selseph(stime, sat, &linear), selseph(stime, sat, indexed));
+        }
+    EXPECT_GT(found, 0);
+    EXPECT_EQ(seleph(timeadd(eph[0].toe, 604800.0), eph[0].sat, -1, &linear), seleph(timeadd(eph[0].toe, 604800.0), eph[0].sat, -1, indexed));
+
+    // the index is rebuilt in place after the arrays are refilled, as done every epoch by Rtklib_Solver
+    const int *idx_buffer = indexed->ephidx->eph.idx;
+    for (int i = 0; i < n; i++)
+        {
+            eph[i].sat = eph[n - 1 - i].sat;
+            eph[i].toe = timeadd(eph[i].toe, 7200.0);
+        }
+    ASSERT_EQ(buildephidx(indexed), 1);
+    EXPECT_EQ(indexed->ephidx->eph.idx, idx_buffer);
+    for (int q = 0; q < 2000; q++)
+        {
+            const gtime_t time = timeadd(start, 16.0 * static_cast<int>(query_s(gen) / 16.0));
+            const int sat = (q % 2 == 0) ? sat_gps(gen) : sat_gal(gen);
+            const int qiode = query_iode(gen);
+            EXPECT_EQ(seleph(time, sat, qiode, &linear), seleph(time, sat, qiode, indexed));
+        }
+
+    // an index that does not match the arrays falls back to the linear search
+    indexed->n = n / 2;
+    const gtime_t time = timeadd(start, 604800.0);
+    linear.n = n / 2;
+    for (int sat = 1; sat <= NSATGPS; sat++)
+        {
+            EXPECT_EQ(seleph(time, sat, -1, &linear), seleph(time, sat, -1, indexed));
+        }
+    freeephidx(indexed);
+    EXPECT_TRUE(indexed->ephidx == nullptr);
+}
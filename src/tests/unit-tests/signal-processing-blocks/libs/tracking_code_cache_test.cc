@@ -0,0 +1,148 @@
+/*!
+ * \file tracking_code_cache_test.cc
+ * \brief This file implements unit tests for the Tracking_Code_Cache class
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tracking_code_cache.h"
+#include "Galileo_E5a.h"
+#include "dll_pll_conf.h"
+#include "dll_pll_veml_tracking.h"
+#include "galileo_e5_signal_replica.h"
+#include "gnss_synchro.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+
+
+namespace
+{
+Tracking_Code_Cache::Key make_tracking_code_cache_key(uint32_t prn, bool pilot)
+{
+    Tracking_Code_Cache::Key key;
+    key.system = 'E';
+    key.signal[0] = '1';
+    key.signal[1] = 'B';
+    key.prn = prn;
+    key.pilot = pilot;
+    key.samples_per_chip = 2;
+    return key;
+}
+
+
+std::shared_ptr<const Tracking_Code_Cache::Code> make_code(float value)
+{
+    return std::make_shared<const Tracking_Code_Cache::Code>(8184, value);
+}
+}  // namespace
+
+
+TEST(TrackingCodeCacheTest, FindsInsertedCodes)
+{
+    auto& cache = Tracking_Code_Cache::instance();
+    cache.clear();
+
+    EXPECT_EQ(cache.find(make_tracking_code_cache_key(1, false)), nullptr);
+    EXPECT_EQ(cache.misses(), 1U);
+
+    cache.insert(make_tracking_code_cache_key(1, false), make_code(1.0));
+    cache.insert(make_tracking_code_cache_key(1, true), make_code(-1.0));
+    EXPECT_EQ(cache.entries(), 2U);
+    EXPECT_EQ(cache.size_bytes(), 2U * 8184U * sizeof(float));
+
+    const auto data = cache.find(make_tracking_code_cache_key(1, false));
+    const auto pilot = cache.find(make_tracking_code_cache_key(1, true));
+    ASSERT_NE(data, nullptr);
+    ASSERT_NE(pilot, nullptr);
+    EXPECT_EQ((*data)[0], 1.0);
+    EXPECT_EQ((*pilot)[0], -1.0);
+    EXPECT_EQ(cache.hits(), 2U);
+
+    // Any difference in the key is a miss
+    auto other_key = make_tracking_code_cache_key(1, false);
+    other_key.samples_per_chip = 1;
+    EXPECT_EQ(cache.find(other_key), nullptr);
+
+    cache.clear();
+    EXPECT_EQ(cache.entries(), 0U);
+    EXPECT_EQ(cache.size_bytes(), 0U);
+}
+
+
+TEST(TrackingCodeCacheTest, FirstInsertWins)
+{
+    auto& cache = Tracking_Code_Cache::instance();
+    cache.clear();
+
+    const auto first = cache.insert(make_tracking_code_cache_key(7, false), make_code(1.0));
+    const auto second = cache.insert(make_tracking_code_cache_key(7, false), make_code(2.0));
+    EXPECT_EQ(first, second);
+    EXPECT_EQ((*second)[0], 1.0);
+    EXPECT_EQ(cache.entries(), 1U);
+    EXPECT_EQ(cache.find(make_tracking_code_cache_key(7, false)), first);
+
+    EXPECT_EQ(cache.insert(make_tracking_code_cache_key(8, false), nullptr), nullptr);
+    EXPECT_EQ(cache.entries(), 1U);
+    cache.clear();
+}
+
+
+TEST(TrackingCodeCacheTest, TrackingBlocksShareCodes)
+{
+    auto& cache = Tracking_Code_Cache::instance();
+    cache.clear();
+
+    Dll_Pll_Conf conf;
+    conf.system = 'E';
+    std::copy_n("5X", 3, conf.signal);
+    conf.fs_in = 12000000.0;
+    conf.vector_length = static_cast<uint32_t>(std::round(conf.fs_in / (GALILEO_E5A_CODE_CHIP_RATE_CPS / GALILEO_E5A_CODE_LENGTH_CHIPS)));
+    conf.track_pilot = true;
+    conf.dump = false;
+
+    Gnss_Synchro gnss_synchro{};
+    gnss_synchro.System = 'E';
+    std::copy_n("5X", 3, gnss_synchro.Signal);
+    gnss_synchro.PRN = 11;
+    gnss_synchro.Acq_doppler_hz = 1000.0;
+    std::array<Gnss_Synchro, 2> channel_synchro{gnss_synchro, gnss_synchro};
+
+    // two channels start tracking the same satellite
+    std::array<dll_pll_veml_tracking_sptr, 2> tracking{dll_pll_veml_make_tracking(conf), dll_pll_veml_make_tracking(conf)};
+    for (uint32_t ch = 0; ch < tracking.size(); ch++)
+        {
+            channel_synchro[ch].Channel_ID = static_cast<int32_t>(ch);
+            tracking[ch]->set_channel(ch);
+            tracking[ch]->set_gnss_synchro(&channel_synchro[ch]);
+            tracking[ch]->start_tracking();
+        }
+
+    // the first one generates the pilot and data codes, the second one reuses them
+    EXPECT_EQ(cache.entries(), 2U);
+    EXPECT_EQ(cache.misses(), 2U);
+    EXPECT_EQ(cache.hits(), 2U);
+
+    for (const bool pilot : {true, false})
+        {
+            const auto code = cache.find(Tracking_Code_Cache::make_key(gnss_synchro, pilot, 1));
+            ASSERT_NE(code, nullptr);
+            // held by the cache, by both tracking blocks and here
+            EXPECT_EQ(code.use_count(), 4);
+
+            Tracking_Code_Cache::Code expected(GALILEO_E5A_CODE_LENGTH_CHIPS, 0.0F);
+            galileo_e5_component_code_gen_float(expected, gnss_synchro.PRN, '5', pilot);
+            EXPECT_TRUE(*code == expected);
+        }
+    cache.clear();
+}
@@ -32,6 +32,7 @@
 #include "gnss_satellite.h"
 #include "gnss_sdr_sample_counter.h"
 #include "gnss_synchro.h"
+#include "gnss_synchro_epoch.h"
 #include "gnuplot_i.h"
 #include "gps_l1_ca_dll_pll_tracking.h"
 #include "gps_l1_ca_pcps_acquisition.h"
@@ -1966,7 +1967,8 @@ TEST_F(HybridObservablesTest, ValidationOfResults)
     std::vector<std::shared_ptr<TrackingInterface> > tracking_ch_vec;
     std::vector<std::shared_ptr<TelemetryDecoderInterface> > tlm_ch_vec;
 
-    std::vector<gr::blocks::null_sink::sptr> null_sink_vec;
+    // null sink for the observables output
+    auto null_sink = gr::blocks::null_sink::make(sizeof(Gnss_Synchro_Epoch));
     for (unsigned int n = 0; n < gnss_synchro_vec.size(); n++)
         {
             // set channels ids
@@ -1979,9 +1981,6 @@ TEST_F(HybridObservablesTest, ValidationOfResults)
             std::shared_ptr<GNSSBlockInterface> tlm_ = factory->GetBlock(config.get(), "TelemetryDecoder", 1, 1);
             tlm_ch_vec.push_back(std::dynamic_pointer_cast<TelemetryDecoderInterface>(tlm_));
 
-            // create null sinks for observables output
-            null_sink_vec.push_back(gr::blocks::null_sink::make(sizeof(Gnss_Synchro)));
-
             ASSERT_NO_THROW({
                 tlm_ch_vec.back()->set_channel(gnss_synchro_vec.at(n).Channel_ID);
 
@@ -2055,8 +2054,8 @@ TEST_F(HybridObservablesTest, ValidationOfResults)
                 top_block_tlm->connect(tracking_ch_vec.at(n)->get_right_block(), 0, tlm_ch_vec.at(n)->get_left_block(), 0);
                 top_block_tlm->connect(tlm_ch_vec.at(n)->get_right_block(), 0, observables->get_left_block(), n);
                 top_block_tlm->msg_connect(tracking_ch_vec.at(n)->get_right_block(), pmt::mp("events"), dummy_msg_rx_trk, pmt::mp("events"));
-                top_block_tlm->connect(observables->get_right_block(), n, null_sink_vec.at(n), 0);
             }
+        top_block_tlm->connect(observables->get_right_block(), 0, null_sink, 0);
         // connect sample counter and timmer to the last channel in observables block (extra channel)
         top_block_tlm->connect(samp_counter, 0, observables->get_left_block(), tracking_ch_vec.size());
 
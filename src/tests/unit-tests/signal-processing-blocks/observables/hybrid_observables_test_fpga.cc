@@ -32,6 +32,7 @@
 #include "gnss_satellite.h"
 #include "gnss_sdr_fpga_sample_counter.h"
 #include "gnss_synchro.h"
+#include "gnss_synchro_epoch.h"
 #include "gnuplot_i.h"
 #include "gps_l1_ca_dll_pll_tracking_fpga.h"
 #include "gps_l1_ca_pcps_acquisition_fpga.h"
@@ -2062,7 +2063,8 @@ TEST_F(HybridObservablesTestFpga, ValidationOfResults)
     std::vector<std::shared_ptr<TrackingInterface>> tracking_ch_vec;
     std::vector<std::shared_ptr<TelemetryDecoderInterface>> tlm_ch_vec;
 
-    std::vector<gr::blocks::null_sink::sptr> null_sink_vec;
+    // null sink for the observables output
+    auto null_sink = gr::blocks::null_sink::make(sizeof(Gnss_Synchro_Epoch));
     for (unsigned int n = 0; n < gnss_synchro_vec.size(); n++)
         {
             // set channels ids
@@ -2074,9 +2076,6 @@ TEST_F(HybridObservablesTestFpga, ValidationOfResults)
             std::shared_ptr<GNSSBlockInterface> tlm_ = factory->GetBlock(config.get(), "TelemetryDecoder", 1, 1);
             tlm_ch_vec.push_back(std::dynamic_pointer_cast<TelemetryDecoderInterface>(tlm_));
 
-            // create null sinks for observables output
-            null_sink_vec.push_back(gr::blocks::null_sink::make(sizeof(Gnss_Synchro)));
-
             ASSERT_NO_THROW({
                 tlm_ch_vec.back()->set_channel(gnss_synchro_vec.at(n).Channel_ID);
 
@@ -2150,8 +2149,8 @@ TEST_F(HybridObservablesTestFpga, ValidationOfResults)
                 top_block->connect(tracking_ch_vec.at(n)->get_right_block(), 0, tlm_ch_vec.at(n)->get_left_block(), 0);
                 top_block->connect(tlm_ch_vec.at(n)->get_right_block(), 0, observables->get_left_block(), n);
                 top_block->msg_connect(tracking_ch_vec.at(n)->get_right_block(), pmt::mp("events"), dummy_msg_rx_trk, pmt::mp("events"));
-                top_block->connect(observables->get_right_block(), n, null_sink_vec.at(n), 0);
             }
+        top_block->connect(observables->get_right_block(), 0, null_sink, 0);
         // connect sample counter and timmer to the last channel in observables block (extra channel)
         top_block->connect(ch_out_fpga_sample_counter, 0, observables->get_left_block(), tracking_ch_vec.size());  // extra port for the sample counter pulse
     }) << "Failure connecting the blocks.";
@@ -165,10 +165,12 @@ TEST_F(NmeaPrinterTest, PrintLine)
     pvt_solution->pvt_sol.stat = 1;  // SOLQ_FIX
     pvt_solution->pvt_sol.time = gtime;
 
+    const Rtklib_Solver_Snapshot snapshot = pvt_solution->get_snapshot(pvt_solution);
+
     bool flag_nmea_output_file = true;
     ASSERT_NO_THROW({
         std::shared_ptr<Nmea_Printer> nmea_printer = std::make_shared<Nmea_Printer>(filename, flag_nmea_output_file, false, "");
-        nmea_printer->Print_Nmea_Line(pvt_solution.get());
+        nmea_printer->Print_Nmea_Line(&snapshot);
     }) << "Failure printing NMEA messages.";
 
     std::ifstream test_file(filename);
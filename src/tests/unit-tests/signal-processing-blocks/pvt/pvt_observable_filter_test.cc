@@ -0,0 +1,156 @@
+/*!
+ * \file pvt_observable_filter_test.cc
+ * \brief Implements Unit Tests for the Pvt_Observable_Filter class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "beidou_dnav_ephemeris.h"
+#include "galileo_ephemeris.h"
+#include "gnss_synchro_epoch.h"
+#include "gps_cnav_ephemeris.h"
+#include "gps_ephemeris.h"
+#include "pvt_observable_filter.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <map>
+
+
+TEST(PvtObservableFilterTest, SignalCodes)
+{
+    EXPECT_TRUE(pvt_signal("1C") == Pvt_Signal::GPS_1C);
+    EXPECT_TRUE(pvt_signal("2S") == Pvt_Signal::GPS_2S);
+    EXPECT_TRUE(pvt_signal("L5") == Pvt_Signal::GPS_L5);
+    EXPECT_TRUE(pvt_signal("1B") == Pvt_Signal::GAL_1B);
+    EXPECT_TRUE(pvt_signal("5X") == Pvt_Signal::GAL_5X);
+    EXPECT_TRUE(pvt_signal("7X") == Pvt_Signal::GAL_7X);
+    EXPECT_TRUE(pvt_signal("E6") == Pvt_Signal::GAL_E6);
+    EXPECT_TRUE(pvt_signal("1G") == Pvt_Signal::GLO_1G);
+    EXPECT_TRUE(pvt_signal("2G") == Pvt_Signal::GLO_2G);
+    EXPECT_TRUE(pvt_signal("B1") == Pvt_Signal::BDS_B1);
+    EXPECT_TRUE(pvt_signal("B3") == Pvt_Signal::BDS_B3);
+    EXPECT_TRUE(pvt_signal("5C") == Pvt_Signal::UNKNOWN);
+    EXPECT_TRUE(pvt_signal("") == Pvt_Signal::UNKNOWN);
+}
+
+
+TEST(PvtObservableFilterTest, EphemerisAndHealth)
+{
+    Pvt_Observable_Filter filter(false);
+    Gnss_Synchro gs;
+    gs.PRN = 5;
+    std::memcpy(gs.Signal, "1C", 3);
+    EXPECT_FALSE(filter.accept(gs));  // no ephemeris
+
+    Gps_Ephemeris gps_eph;
+    gps_eph.PRN = 5;
+    filter.update(gps_eph);
+    EXPECT_TRUE(filter.accept(gs));
+    gps_eph.SV_health = 1;
+    filter.update(gps_eph);
+    EXPECT_FALSE(filter.accept(gs));  // unhealthy
+
+    // CNAV signals need CNAV ephemeris
+    std::memcpy(gs.Signal, "2S", 3);
+    EXPECT_FALSE(filter.accept(gs));
+    Gps_CNAV_Ephemeris cnav_eph;
+    cnav_eph.PRN = 5;
+    filter.update(cnav_eph);
+    EXPECT_TRUE(filter.accept(gs));
+
+    // Galileo health is checked per signal
+    Galileo_Ephemeris gal_eph;
+    gal_eph.PRN = 5;
+    gal_eph.E5a_HS = 2;
+    filter.update(gal_eph);
+    std::memcpy(gs.Signal, "1B", 3);
+    EXPECT_TRUE(filter.accept(gs));
+    std::memcpy(gs.Signal, "5X", 3);
+    EXPECT_FALSE(filter.accept(gs));
+    std::memcpy(gs.Signal, "7X", 3);
+    EXPECT_TRUE(filter.accept(gs));
+
+    // E6 observables are always accepted
+    gs.PRN = 30;
+    std::memcpy(gs.Signal, "E6", 3);
+    EXPECT_TRUE(filter.accept(gs));
+
+    Beidou_Dnav_Ephemeris bds_eph;
+    bds_eph.PRN = 30;
+    filter.update(bds_eph);
+    std::memcpy(gs.Signal, "B3", 3);
+    EXPECT_TRUE(filter.accept(gs));
+    filter.clear_beidou();
+    EXPECT_FALSE(filter.accept(gs));
+
+    gs.PRN = 5;
+    std::memcpy(gs.Signal, "1B", 3);
+    filter.clear();
+    EXPECT_FALSE(filter.accept(gs));
+
+    // unhealthy satellites accepted if configured
+    Pvt_Observable_Filter permissive_filter(true);
+    std::memcpy(gs.Signal, "1C", 3);
+    permissive_filter.update(gps_eph);
+    EXPECT_TRUE(permissive_filter.accept(gs));
+}
+
+
+TEST(PvtObservableFilterTest, SelectEpoch)
+{
+    Pvt_Observable_Filter filter(false);
+    Gps_Ephemeris gps_eph;
+    for (uint32_t prn = 1; prn <= 4; prn++)
+        {
+            gps_eph.PRN = prn;
+            filter.update(gps_eph);
+        }
+
+    // channel i tracks PRN i + 1; PRN 6 has no ephemeris
+    Gnss_Synchro_Epoch epoch;
+    epoch.reset(6);
+    for (uint32_t ch = 0; ch < 6; ch++)
+        {
+            Gnss_Synchro gs;
+            gs.System = 'G';
+            std::memcpy(gs.Signal, "1C", 3);
+            gs.PRN = ch + 1;
+            gs.Channel_ID = static_cast<int32_t>(ch);
+            gs.Pseudorange_m = 2.0e7 + ch;
+            gs.Flag_valid_pseudorange = (ch != 2);
+            if (ch != 4)
+                {
+                    epoch.set(ch, gs);
+                }
+        }
+
+    std::map<int, Gnss_Synchro> observables_map;
+    observables_map[2] = Gnss_Synchro();  // stale entries are removed
+    observables_map[9] = Gnss_Synchro();
+    filter.select(epoch, observables_map);
+    // channel 2 has no pseudorange, channel 4 no observation
+    ASSERT_EQ(observables_map.size(), 3U);
+    EXPECT_EQ(observables_map.at(0).PRN, 1U);
+    EXPECT_EQ(observables_map.at(1).PRN, 2U);
+    EXPECT_EQ(observables_map.at(3).PRN, 4U);
+    EXPECT_EQ(observables_map.at(3).Pseudorange_m, 2.0e7 + 3);
+
+    // the nodes of the channels that stay valid are reused
+    const Gnss_Synchro* node = &observables_map.at(3);
+    epoch.Pseudorange_m[3] += 1.0;
+    filter.select(epoch, observables_map);
+    EXPECT_EQ(&observables_map.at(3), node);
+    EXPECT_EQ(observables_map.at(3).Pseudorange_m, 2.0e7 + 4);
+
+    epoch.reset(6);
+    filter.select(epoch, observables_map);
+    EXPECT_TRUE(observables_map.empty());
+}
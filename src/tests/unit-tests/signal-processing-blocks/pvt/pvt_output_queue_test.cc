@@ -0,0 +1,129 @@
+/*!
+ * \file pvt_output_queue_test.cc
+ * \brief Implements Unit Tests for the Pvt_Output_Queue class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_queue.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+TEST(PvtOutputQueueTest, RunsInlineWithoutCapacity)
+{
+    Pvt_Output_Queue queue(0, false);
+    EXPECT_FALSE(queue.threaded());
+    std::thread::id job_thread;
+    EXPECT_TRUE(queue.submit([&job_thread]() { job_thread = std::this_thread::get_id(); }));
+    EXPECT_EQ(job_thread, std::this_thread::get_id());
+}
+
+
+TEST(PvtOutputQueueTest, RunsJobsInOrder)
+{
+    std::vector<int> executed;
+    std::thread::id job_thread = std::this_thread::get_id();
+    {
+        Pvt_Output_Queue queue(4, false);
+        EXPECT_TRUE(queue.threaded());
+        EXPECT_TRUE(queue.submit([]() { throw std::runtime_error("write error"); }));
+        for (int i = 0; i < 100; i++)
+            {
+                EXPECT_TRUE(queue.submit([&executed, &job_thread, i]() {
+                    executed.push_back(i);
+                    job_thread = std::this_thread::get_id();
+                }));
+            }
+    }  // pending jobs are run before the writer thread is joined
+    ASSERT_EQ(executed.size(), 100U);
+    for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(executed[i], i);
+        }
+    EXPECT_NE(job_thread, std::this_thread::get_id());
+}
+
+
+TEST(PvtOutputQueueTest, DropsJobsWhenFull)
+{
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released(release.get_future());
+    std::atomic<int> executed{0};
+    Pvt_Output_Queue queue(2, true);
+    EXPECT_TRUE(queue.submit([&started, released]() {
+        started.set_value();
+        released.wait();
+    }));
+    started.get_future().wait();  // the writer is busy, and the queue is empty
+
+    EXPECT_TRUE(queue.submit([&executed]() { executed++; }));
+    EXPECT_TRUE(queue.submit([&executed]() { executed++; }));
+    EXPECT_FALSE(queue.submit([&executed]() { executed++; }));
+    EXPECT_TRUE(queue.submit([&executed]() { executed++; }, false));  // not droppable
+    EXPECT_EQ(queue.statistics().depth, 3U);
+
+    release.set_value();
+    while (queue.statistics().jobs_executed < 4)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    const Pvt_Output_Queue::Statistics stats = queue.statistics();
+    EXPECT_EQ(executed, 3);
+    EXPECT_EQ(stats.jobs_dropped, 1U);
+    EXPECT_EQ(stats.jobs_blocked, 0U);
+    EXPECT_EQ(stats.max_depth, 3U);
+    EXPECT_EQ(stats.depth, 0U);
+}
+
+
+TEST(PvtOutputQueueTest, BlocksWhenFull)
+{
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released(release.get_future());
+    std::atomic<int> executed{0};
+    Pvt_Output_Queue queue(1, false);
+    EXPECT_TRUE(queue.submit([&started, released]() {
+        started.set_value();
+        released.wait();
+    }));
+    started.get_future().wait();
+    EXPECT_TRUE(queue.submit([&executed]() { executed++; }));
+
+    std::atomic<bool> submitted{false};
+    std::thread producer([&]() {
+        queue.submit([&executed]() { executed++; });
+        submitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(submitted);  // waiting for room in the queue
+
+    release.set_value();
+    producer.join();
+    EXPECT_TRUE(submitted);
+    while (queue.statistics().jobs_executed < 3)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    const Pvt_Output_Queue::Statistics stats = queue.statistics();
+    EXPECT_EQ(executed, 2);
+    EXPECT_EQ(stats.jobs_dropped, 0U);
+    EXPECT_EQ(stats.jobs_blocked, 1U);
+    EXPECT_GT(stats.max_block_us, 0.0);
+}
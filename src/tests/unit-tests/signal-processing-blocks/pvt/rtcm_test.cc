@@ -17,8 +17,12 @@
 
 
 #include "Galileo_INAV.h"
+#include "crc24q.h"
 #include "rtcm.h"
+#include "rtcm_bit_writer.h"
+#include <boost/crc.hpp>
 #include <memory>
+#include <random>
 #include <thread>
 
 TEST(RtcmTest, HexToBin)
@@ -172,6 +176,46 @@ TEST(RtcmTest, CheckCRC)
 }
 
 
+TEST(RtcmTest, BitWriter)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    std::mt19937 gen(1234);
+    Rtcm_Bit_Writer writer;
+    for (int trial = 0; trial < 50; trial++)
+        {
+            // fields of random length, both appended and written later at their position
+            writer.clear();
+            std::string bits;
+            const std::size_t later = writer.skip(40);
+            bits += std::string(40, '0');
+            const int nfields = 1 + gen() % 200;
+            for (int k = 0; k < nfields; k++)
+                {
+                    const std::size_t len = 1 + gen() % 64;
+                    const uint64_t value = (static_cast<uint64_t>(gen()) << 32) | gen();
+                    writer.append(value, len);
+                    bits += std::bitset<64>(value).to_string().substr(64 - len);
+                }
+            const uint64_t value = gen();
+            writer.write(later + 3, 33, value);
+            bits.replace(3, 33, std::bitset<33>(value).to_string());
+            EXPECT_EQ(writer.size(), bits.size());
+
+            // reference: the former framing through strings of '0' and '1'
+            const std::size_t msg_length_bytes = (bits.size() + 7) / 8;
+            const std::string msg_without_crc = "11010011000000" + std::bitset<10>(msg_length_bytes).to_string() + bits + std::string(8 * msg_length_bytes - bits.size(), '0');
+            const std::string bytes = rtcm->bin_to_binary_data(msg_without_crc);
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            crc.process_bytes(bytes.data(), bytes.size());
+            EXPECT_EQ(Crc24q::checksum(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()), crc.checksum());
+            const std::string expected = rtcm->bin_to_binary_data(msg_without_crc + std::bitset<24>(crc.checksum()).to_string());
+            const std::string frame = writer.frame();
+            EXPECT_EQ(frame, expected);
+            EXPECT_TRUE(rtcm->check_CRC(frame));
+        }
+}
+
+
 TEST(RtcmTest, MT1001)
 {
     auto rtcm = std::make_shared<Rtcm>();
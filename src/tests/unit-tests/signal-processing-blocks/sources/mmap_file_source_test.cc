@@ -0,0 +1,104 @@
+/*!
+ * \file mmap_file_source_test.cc
+ * \brief Implements Unit Tests for the mmap_file_source block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_queue.h"
+#include "mmap_file_source.h"
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <pmt/pmt.h>
+#include <cstdint>
+#include <cstdio>  // for std::remove
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+class MmapFileSourceTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        samples.resize(100000);
+        for (size_t i = 0; i < samples.size(); i++)
+            {
+                samples[i] = static_cast<int16_t>(i % 30000);
+            }
+        std::ofstream file(filename, std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(int16_t));
+    }
+
+    void TearDown() override
+    {
+        std::remove(filename.c_str());
+    }
+
+    std::vector<int16_t> run(const mmap_file_source_sptr& source)
+    {
+        auto top_block = gr::make_top_block("mmap_file_source_test");
+        auto sink = gr::blocks::vector_sink_s::make();
+        top_block->connect(source, 0, sink, 0);
+        top_block->run();
+        return sink->data();
+    }
+
+    std::string filename = "./mmap_file_source_test.dat";
+    std::vector<int16_t> samples;
+};
+
+
+TEST_F(MmapFileSourceTest, ReadsWholeFile)
+{
+    auto source = mmap_file_source_make(sizeof(int16_t), filename, false, 0, 1024 * 1024);
+    EXPECT_EQ(source->items_in_file(), samples.size());
+    EXPECT_EQ(run(source), samples);
+}
+
+
+TEST_F(MmapFileSourceTest, SkipsItems)
+{
+    const uint64_t to_skip = 12345;
+    auto source = mmap_file_source_make(sizeof(int16_t), filename, false, to_skip, 0);
+    const std::vector<int16_t> expected(samples.cbegin() + to_skip, samples.cend());
+    EXPECT_EQ(run(source), expected);
+}
+
+
+TEST_F(MmapFileSourceTest, RepeatsAndStopsLikeTheValve)
+{
+    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    const uint64_t to_skip = 10;
+    const uint64_t n_items = 2 * samples.size() + 100;
+    auto source = mmap_file_source_make(sizeof(int16_t), filename, true, to_skip, 0);
+    source->stop_after(n_items, queue.get());
+
+    const std::vector<int16_t> data = run(source);
+    ASSERT_EQ(data.size(), n_items);
+    const uint64_t period = samples.size() - to_skip;
+    for (uint64_t i = 0; i < n_items; i++)
+        {
+            ASSERT_EQ(data[i], samples[to_skip + i % period]);
+        }
+    pmt::pmt_t msg;
+    EXPECT_TRUE(queue->timed_wait_and_pop(msg, 100));
+}
+
+
+TEST_F(MmapFileSourceTest, ThrowsIfFileDoesNotExist)
+{
+    EXPECT_THROW({ mmap_file_source_make(sizeof(int16_t), "./i_dont_exist.dat", false, 0, 0); }, std::runtime_error);
+}
@@ -0,0 +1,168 @@
+/*!
+ * \file viterbi_decoder_test.cc
+ * \brief This file implements unit tests for the Viterbi_Decoder class with
+ * randomly generated frames.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "viterbi_decoder.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+// Convolutional encoder with the conventions of Viterbi_Decoder: the newest
+// bit is the most significant bit of the state, and a positive soft symbol
+// means bit 1. The frame is terminated with KK - 1 zeros.
+std::vector<float> viterbi_test_encode(const std::vector<int32_t>& bits, int32_t KK, const std::array<int32_t, 2>& g)
+{
+    std::vector<float> symbols;
+    int32_t state = 0;
+    std::vector<int32_t> input(bits);
+    input.insert(input.end(), KK - 1, 0);
+    for (const auto bit : input)
+        {
+            const int32_t word = (bit << (KK - 1)) ^ state;
+            for (const auto poly : g)
+                {
+                    int32_t parity = 0;
+                    for (int32_t w = word & poly; w != 0; w >>= 1)
+                        {
+                            parity ^= w & 1;
+                        }
+                    symbols.push_back(parity ? 1.0F : -1.0F);
+                }
+            state = word >> 1;
+        }
+    return symbols;
+}
+
+
+// Number of decoding errors of num_frames frames in Gaussian noise
+int32_t viterbi_test_errors(int32_t KK, const std::array<int32_t, 2>& g, int32_t LL, int32_t num_frames, float sigma, int32_t* uncoded_errors)
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> noise(0.0, sigma);
+    Viterbi_Decoder decoder(KK, 2, LL, g);
+    int32_t errors = 0;
+    *uncoded_errors = 0;
+    for (int32_t frame = 0; frame < num_frames; frame++)
+        {
+            std::vector<int32_t> bits(LL);
+            for (auto& bit : bits)
+                {
+                    bit = static_cast<int32_t>(gen() & 1U);
+                }
+            std::vector<float> symbols = viterbi_test_encode(bits, KK, g);
+            for (auto& symbol : symbols)
+                {
+                    const float received = symbol + noise(gen);
+                    if ((received > 0) != (symbol > 0))
+                        {
+                            (*uncoded_errors)++;
+                        }
+                    symbol = received;
+                }
+            std::vector<int32_t> decoded(LL);
+            decoder.decode(decoded, symbols);
+            for (int32_t i = 0; i < LL; i++)
+                {
+                    if (decoded[i] != bits[i])
+                        {
+                            errors++;
+                        }
+                }
+        }
+    return errors;
+}
+}  // namespace
+
+
+TEST(ViterbiDecoderTest, NoiselessGalileoFrames)
+{
+    const std::array<int32_t, 2> g{{121, 91}};
+    const int32_t LL = 114;  // Galileo I/NAV page part
+    const int32_t num_frames = 10;
+    std::mt19937 gen(4321);
+    std::vector<int32_t> bits(LL * num_frames);
+    std::vector<float> symbols;
+    for (auto& bit : bits)
+        {
+            bit = static_cast<int32_t>(gen() & 1U);
+        }
+    for (int32_t frame = 0; frame < num_frames; frame++)
+        {
+            const std::vector<int32_t> frame_bits(bits.begin() + frame * LL, bits.begin() + (frame + 1) * LL);
+            const std::vector<float> frame_symbols = viterbi_test_encode(frame_bits, 7, g);
+            symbols.insert(symbols.end(), frame_symbols.begin(), frame_symbols.end());
+        }
+
+    Viterbi_Decoder decoder(7, 2, LL, g);
+    const int32_t frame_symbols = 2 * (LL + 6);
+    for (int32_t frame = 0; frame < num_frames; frame++)
+        {
+            std::vector<float> in(symbols.begin() + frame * frame_symbols, symbols.begin() + (frame + 1) * frame_symbols);
+            std::vector<int32_t> out(LL);
+            decoder.decode(out, in);
+            for (int32_t i = 0; i < LL; i++)
+                {
+                    EXPECT_EQ(out[i], bits[frame * LL + i]);
+                }
+        }
+}
+
+
+TEST(ViterbiDecoderTest, NoiselessGenericCode)
+{
+    // K = 5 code, decoded state by state
+    const std::array<int32_t, 2> g{{19, 29}};
+    const int32_t LL = 100;
+    std::mt19937 gen(1111);
+    std::vector<int32_t> bits(LL);
+    for (auto& bit : bits)
+        {
+            bit = static_cast<int32_t>(gen() & 1U);
+        }
+    const std::vector<float> symbols = viterbi_test_encode(bits, 5, g);
+    Viterbi_Decoder decoder(5, 2, LL, g);
+    std::vector<int32_t> out(LL);
+    for (int32_t k = 0; k < 2; k++)
+        {
+            decoder.decode(out, symbols);
+            EXPECT_EQ(out, bits);
+        }
+}
+
+
+TEST(ViterbiDecoderTest, CodingGain)
+{
+    // About 11 % of wrong symbols before decoding
+    const int32_t LL = 114;
+    const int32_t num_frames = 200;
+    int32_t uncoded_errors_k7 = 0;
+    const int32_t errors_k7 = viterbi_test_errors(7, {{121, 91}}, LL, num_frames, 0.8, &uncoded_errors_k7);
+    EXPECT_GT(uncoded_errors_k7, 1000);
+    EXPECT_LT(errors_k7 * 50, uncoded_errors_k7);
+
+    int32_t uncoded_errors_k5 = 0;
+    const int32_t errors_k5 = viterbi_test_errors(5, {{19, 29}}, LL, num_frames, 0.8, &uncoded_errors_k5);
+    EXPECT_GT(uncoded_errors_k5, 1000);
+    EXPECT_LT(errors_k5 * 10, uncoded_errors_k5);
+
+    // The longer code corrects more errors
+    EXPECT_LT(errors_k7, errors_k5);
+}
@@ -21,6 +21,7 @@
 #include <gnuradio/gr_complex.h>
 #include <gtest/gtest.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
 #include <chrono>
 #include <complex>
 #include <cstdint>
@@ -279,3 +280,59 @@ TEST(CpuMulticorrelatorRealCodesTest, MeasureExecutionTimeAlloc)
             correlator_pool[n]->free();
         }
 }
+
+
+TEST(CpuMulticorrelatorRealCodesTest, FusedResampler)
+{
+    const int d_n_correlator_taps = 3;  // Early, Prompt, and Late
+    const int correlation_sizes[3] = {4000, 4001, 8192};
+    const int d_vector_length = correlation_sizes[2];
+
+    volk_gnsssdr::vector<float> d_ca_code(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    volk_gnsssdr::vector<gr_complex> in_cpu(d_vector_length);
+    volk_gnsssdr::vector<gr_complex> unfused_outs(d_n_correlator_taps);
+    volk_gnsssdr::vector<gr_complex> fused_outs(d_n_correlator_taps);
+    volk_gnsssdr::vector<float> d_local_code_shift_chips{-0.5, 0.0, 0.5};
+
+    gps_l1_ca_code_gen_float(d_ca_code, 1, 0);
+    std::default_random_engine e1(1234);
+    std::uniform_real_distribution<float> uniform_dist(-1, 1);
+    for (auto& sample : in_cpu)
+        {
+            sample = std::complex<float>(uniform_dist(e1), uniform_dist(e1));
+        }
+
+    Cpu_Multicorrelator_Real_Codes unfused;
+    Cpu_Multicorrelator_Real_Codes fused;
+    unfused.init(d_vector_length, d_n_correlator_taps);
+    fused.init(d_vector_length, d_n_correlator_taps);
+    unfused.set_input_output_vectors(unfused_outs.data(), in_cpu.data());
+    fused.set_input_output_vectors(fused_outs.data(), in_cpu.data());
+    unfused.set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), d_ca_code.data(), d_local_code_shift_chips.data());
+    fused.set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), d_ca_code.data(), d_local_code_shift_chips.data());
+    unfused.set_high_dynamics_resampler(false);
+    fused.set_high_dynamics_resampler(false);
+    fused.set_fused_resampler(true);
+
+    const float d_rem_carrier_phase_rad = 0.3;
+    const float d_carrier_phase_step_rad = 0.1;
+    const float d_code_phase_step_chips = 0.256;
+    const float d_rem_code_phase_chips = 0.4;
+
+    for (const int correlation_size : correlation_sizes)
+        {
+            unfused.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad,
+                d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+            fused.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad,
+                d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+            for (int n = 0; n < d_n_correlator_taps; n++)
+                {
+                    const float tolerance = 1e-3F * std::max(1.0F, std::abs(unfused_outs[n]));
+                    EXPECT_NEAR(unfused_outs[n].real(), fused_outs[n].real(), tolerance) << "size " << correlation_size << ", tap " << n;
+                    EXPECT_NEAR(unfused_outs[n].imag(), fused_outs[n].imag(), tolerance) << "size " << correlation_size << ", tap " << n;
+                }
+        }
+
+    unfused.free();
+    fused.free();
+}
@@ -0,0 +1,233 @@
+/*!
+ * \file dll_pll_veml_tracking_bank_test.cc
+ * \brief Tests for the dll_pll_veml_tracking_bank block, which runs the
+ * tracking of several channels in a single GNU Radio block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "concurrent_queue.h"
+#include "dll_pll_veml_tracking.h"
+#include "dll_pll_veml_tracking_bank.h"
+#include "gnss_block_factory.h"
+#include "gnss_block_interface.h"
+#include "gnss_sdr_valve.h"
+#include "gnss_synchro.h"
+#include "in_memory_configuration.h"
+#include "tracking_interface.h"
+#include <gnuradio/blocks/file_source.h>
+#include <gnuradio/io_signature.h>
+#include <gnuradio/sync_block.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+// ######## GNURADIO BLOCK THAT STORES THE TRACKING OUTPUTS #########
+class DllPllVemlTrackingBankTest_sink;
+
+using DllPllVemlTrackingBankTest_sink_sptr = gnss_shared_ptr<DllPllVemlTrackingBankTest_sink>;
+
+DllPllVemlTrackingBankTest_sink_sptr DllPllVemlTrackingBankTest_sink_make();
+
+class DllPllVemlTrackingBankTest_sink : public gr::sync_block
+{
+private:
+    friend DllPllVemlTrackingBankTest_sink_sptr DllPllVemlTrackingBankTest_sink_make();
+    DllPllVemlTrackingBankTest_sink();
+
+public:
+    int work(int noutput_items, gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items) override;
+    std::vector<Gnss_Synchro> synchro;
+};
+
+
+DllPllVemlTrackingBankTest_sink_sptr DllPllVemlTrackingBankTest_sink_make()
+{
+    return DllPllVemlTrackingBankTest_sink_sptr(new DllPllVemlTrackingBankTest_sink());
+}
+
+
+DllPllVemlTrackingBankTest_sink::DllPllVemlTrackingBankTest_sink() : gr::sync_block("DllPllVemlTrackingBankTest_sink",
+                                                                         gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
+                                                                         gr::io_signature::make(0, 0, 0))
+{
+}
+
+
+int DllPllVemlTrackingBankTest_sink::work(int noutput_items, gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items __attribute__((unused)))
+{
+    const auto* in = reinterpret_cast<const Gnss_Synchro*>(input_items[0]);
+    synchro.insert(synchro.end(), in, in + noutput_items);
+    return noutput_items;
+}
+
+
+// ###########################################################
+
+class DllPllVemlTrackingBankTest : public ::testing::Test
+{
+protected:
+    DllPllVemlTrackingBankTest()
+    {
+        factory = std::make_shared<GNSSBlockFactory>();
+        config = std::make_shared<InMemoryConfiguration>();
+    }
+
+    ~DllPllVemlTrackingBankTest() = default;
+
+    void init();
+    std::shared_ptr<TrackingInterface> make_tracking(size_t channel);
+
+    static constexpr size_t num_signals = 2;  // different acquisition parameters
+    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    gr::top_block_sptr top_block;
+    std::shared_ptr<GNSSBlockFactory> factory;
+    std::shared_ptr<InMemoryConfiguration> config;
+    // channels 0 and 1 are standalone blocks, channels 2 and 3 are in the bank
+    std::array<Gnss_Synchro, 2 * num_signals> gnss_synchro{};
+};
+
+
+void DllPllVemlTrackingBankTest::init()
+{
+    // acquisition results of the GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat file
+    const std::array<double, num_signals> acq_delay_samples{524.0, 526.0};
+    const std::array<double, num_signals> acq_doppler_hz{1680.0, 1500.0};
+    for (size_t i = 0; i < gnss_synchro.size(); i++)
+        {
+            gnss_synchro[i].Channel_ID = static_cast<int32_t>(i);
+            gnss_synchro[i].System = 'G';
+            std::string signal = "1C";
+            signal.copy(gnss_synchro[i].Signal, 2, 0);
+            gnss_synchro[i].PRN = 1;
+            gnss_synchro[i].Acq_delay_samples = acq_delay_samples[i % num_signals];
+            gnss_synchro[i].Acq_doppler_hz = acq_doppler_hz[i % num_signals];
+            gnss_synchro[i].Acq_samplestamp_samples = 0;
+        }
+
+    config->set_property("GNSS-SDR.internal_fs_sps", "4000000");
+    config->set_property("Tracking_1C.implementation", "GPS_L1_CA_DLL_PLL_Tracking");
+    config->set_property("Tracking_1C.item_type", "gr_complex");
+    config->set_property("Tracking_1C.dump", "false");
+    config->set_property("Tracking_1C.early_late_space_chips", "0.5");
+    config->set_property("Tracking_1C.order", "3");
+    config->set_property("Tracking_1C.pll_bw_hz", "35.0");
+    config->set_property("Tracking_1C.dll_bw_hz", "2.0");
+}
+
+
+std::shared_ptr<TrackingInterface> DllPllVemlTrackingBankTest::make_tracking(size_t channel)
+{
+    std::shared_ptr<GNSSBlockInterface> trk_ = factory->GetBlock(config.get(), "Tracking_1C", 1, 1);
+    std::shared_ptr<TrackingInterface> tracking = std::dynamic_pointer_cast<TrackingInterface>(trk_);
+    if (tracking)
+        {
+            tracking->set_channel(gnss_synchro[channel].Channel_ID);
+            tracking->set_gnss_synchro(&gnss_synchro[channel]);
+        }
+    return tracking;
+}
+
+
+TEST_F(DllPllVemlTrackingBankTest, SameOutputsAsStandaloneBlocks)
+{
+    const int fs_in = 4000000;
+    const int nsamples = fs_in / 2;
+    init();
+    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    top_block = gr::make_top_block("Tracking bank test");
+
+    std::array<std::shared_ptr<TrackingInterface>, 2 * num_signals> tracking;
+    std::array<DllPllVemlTrackingBankTest_sink_sptr, 2 * num_signals> sinks;
+    for (size_t i = 0; i < tracking.size(); i++)
+        {
+            tracking[i] = make_tracking(i);
+            ASSERT_NE(tracking[i], nullptr);
+            sinks[i] = DllPllVemlTrackingBankTest_sink_make();
+        }
+
+    auto bank = dll_pll_veml_make_tracking_bank(0);
+    for (size_t i = 0; i < num_signals; i++)
+        {
+#if GNURADIO_USES_STD_POINTERS
+            auto engine = std::dynamic_pointer_cast<dll_pll_veml_tracking>(tracking[num_signals + i]->get_right_block());
+#else
+            auto engine = boost::dynamic_pointer_cast<dll_pll_veml_tracking>(tracking[num_signals + i]->get_right_block());
+#endif
+            ASSERT_NE(engine, nullptr);
+            EXPECT_EQ(bank->add_channel(engine), static_cast<int32_t>(i));
+        }
+    EXPECT_EQ(dll_pll_veml_tracking_bank::port_name("events", 1), "events_1");
+
+    ASSERT_NO_THROW({
+        std::string path = std::string(TEST_PATH);
+        std::string file = path + "signal_samples/GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat";
+        const char* file_name = file.c_str();
+        gr::blocks::file_source::sptr file_source = gr::blocks::file_source::make(sizeof(gr_complex), file_name, true);
+        auto valve = gnss_sdr_make_valve(sizeof(gr_complex), nsamples, queue.get());
+        top_block->connect(file_source, 0, valve, 0);
+        for (size_t i = 0; i < num_signals; i++)
+            {
+                top_block->connect(valve, 0, tracking[i]->get_left_block(), 0);
+                top_block->connect(tracking[i]->get_right_block(), 0, sinks[i], 0);
+            }
+        top_block->connect(valve, 0, bank, 0);
+        for (size_t i = 0; i < num_signals; i++)
+            {
+                top_block->connect(bank, static_cast<int>(i), sinks[num_signals + i], 0);
+            }
+    }) << "Failure connecting the blocks of tracking bank test.";
+
+    for (auto& trk : tracking)
+        {
+            trk->start_tracking();
+        }
+
+    EXPECT_NO_THROW({
+        top_block->run();  // Start threads and wait
+    }) << "Failure running the top_block.";
+
+    // The banked channels see the same samples as the standalone ones, so
+    // they must deliver exactly the same epochs
+    for (size_t i = 0; i < num_signals; i++)
+        {
+            const std::vector<Gnss_Synchro>& standalone = sinks[i]->synchro;
+            const std::vector<Gnss_Synchro>& banked = sinks[num_signals + i]->synchro;
+            EXPECT_GT(standalone.size(), 10U);
+            ASSERT_EQ(standalone.size(), banked.size()) << "Different number of epochs for signal " << i;
+            for (size_t n = 0; n < standalone.size(); n++)
+                {
+                    const Gnss_Synchro& expected = standalone[n];
+                    const Gnss_Synchro& actual = banked[n];
+                    EXPECT_EQ(expected.Channel_ID, static_cast<int32_t>(i));
+                    EXPECT_EQ(actual.Channel_ID, static_cast<int32_t>(num_signals + i));
+                    EXPECT_EQ(expected.PRN, actual.PRN) << "epoch " << n;
+                    EXPECT_EQ(expected.Prompt_I, actual.Prompt_I) << "epoch " << n;
+                    EXPECT_EQ(expected.Prompt_Q, actual.Prompt_Q) << "epoch " << n;
+                    EXPECT_EQ(expected.Code_phase_samples, actual.Code_phase_samples) << "epoch " << n;
+                    EXPECT_EQ(expected.Carrier_phase_rads, actual.Carrier_phase_rads) << "epoch " << n;
+                    EXPECT_EQ(expected.Carrier_Doppler_hz, actual.Carrier_Doppler_hz) << "epoch " << n;
+                    EXPECT_EQ(expected.CN0_dB_hz, actual.CN0_dB_hz) << "epoch " << n;
+                    EXPECT_EQ(expected.Tracking_sample_counter, actual.Tracking_sample_counter) << "epoch " << n;
+                    EXPECT_EQ(expected.correlation_length_ms, actual.correlation_length_ms) << "epoch " << n;
+                    EXPECT_EQ(expected.Flag_valid_symbol_output, actual.Flag_valid_symbol_output) << "epoch " << n;
+                    EXPECT_EQ(expected.Flag_PLL_180_deg_phase_locked, actual.Flag_PLL_180_deg_phase_locked) << "epoch " << n;
+                }
+        }
+}
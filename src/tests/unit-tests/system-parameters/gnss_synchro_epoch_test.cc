@@ -0,0 +1,159 @@
+/*!
+ * \file gnss_synchro_epoch_test.cc
+ * \brief  This file implements unit tests for the Gnss_Synchro_Epoch class
+ * and for the block that splits it into per-channel streams.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_epoch.h"
+#include "gnss_synchro_epoch_to_channels.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_b.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#endif
+
+
+Gnss_Synchro make_gnss_synchro(int32_t channel)
+{
+    Gnss_Synchro gs;
+    gs.System = 'E';
+    std::memcpy(gs.Signal, "1B", 3);
+    gs.PRN = 11;
+    gs.Channel_ID = channel;
+    gs.Pseudorange_m = 23456789.123;
+    gs.Carrier_phase_rads = -1234.5;
+    gs.RX_time = 345600.08;
+    gs.Tracking_sample_counter = 123456789012ULL;
+    gs.fs = 4000000;
+    gs.Flag_valid_word = true;
+    gs.Flag_valid_pseudorange = true;
+    gs.Flag_PLL_180_deg_phase_locked = true;
+    return gs;
+}
+
+
+TEST(GnssSynchroEpochTest, SetAndGet)
+{
+    Gnss_Synchro_Epoch epoch;
+    epoch.reset(70);
+    EXPECT_EQ(epoch.size(), 70U);
+    EXPECT_EQ(epoch.count(), 0U);
+
+    const Gnss_Synchro gs = make_gnss_synchro(65);
+    epoch.set(65, gs);
+
+    EXPECT_TRUE(epoch.valid(65));
+    EXPECT_TRUE(epoch.valid_pseudorange(65));
+    EXPECT_FALSE(epoch.valid(64));
+    EXPECT_FALSE(epoch.valid(70));
+    EXPECT_EQ(epoch.count(), 1U);
+    EXPECT_EQ(epoch.Pseudorange_m[65], gs.Pseudorange_m);
+
+    const Gnss_Synchro out = epoch.get(65);
+    EXPECT_EQ(out.System, 'E');
+    EXPECT_EQ(std::string(out.Signal, 2), std::string("1B"));
+    EXPECT_EQ(out.PRN, gs.PRN);
+    EXPECT_EQ(out.Channel_ID, gs.Channel_ID);
+    EXPECT_EQ(out.Pseudorange_m, gs.Pseudorange_m);
+    EXPECT_EQ(out.Carrier_phase_rads, gs.Carrier_phase_rads);
+    EXPECT_EQ(out.RX_time, gs.RX_time);
+    EXPECT_EQ(out.Tracking_sample_counter, gs.Tracking_sample_counter);
+    EXPECT_TRUE(out.Flag_valid_pseudorange);
+    EXPECT_TRUE(out.Flag_PLL_180_deg_phase_locked);
+    EXPECT_FALSE(out.Flag_valid_acquisition);
+
+    // channels without observation give an empty Gnss_Synchro
+    const Gnss_Synchro empty = epoch.get(3);
+    EXPECT_EQ(empty.Channel_ID, 3);
+    EXPECT_EQ(empty.PRN, 0U);
+    EXPECT_FALSE(empty.Flag_valid_pseudorange);
+
+    Gnss_Synchro no_pseudorange = gs;
+    no_pseudorange.Flag_valid_pseudorange = false;
+    epoch.set(3, no_pseudorange);
+    epoch.set(69, gs);
+    EXPECT_EQ(epoch.count(), 3U);
+    EXPECT_TRUE(epoch.valid(3));
+    EXPECT_FALSE(epoch.valid_pseudorange(3));
+    epoch.reset(70);
+    EXPECT_EQ(epoch.count(), 0U);
+    EXPECT_FALSE(epoch.valid(65));
+}
+
+
+TEST(GnssSynchroEpochTest, SplitIntoChannels)
+{
+    const uint32_t nchannels = 5;
+    const size_t nepochs = 3;
+    std::vector<Gnss_Synchro_Epoch> epochs(nepochs);
+    for (size_t n = 0; n < nepochs; n++)
+        {
+            epochs[n].reset(nchannels);
+            for (uint32_t ch = 0; ch < nchannels; ch++)
+                {
+                    if ((ch + n) % 2 == 0)
+                        {
+                            Gnss_Synchro gs = make_gnss_synchro(static_cast<int32_t>(ch));
+                            gs.PRN = ch + 1;
+                            gs.Pseudorange_m += static_cast<double>(n);
+                            epochs[n].set(ch, gs);
+                        }
+                }
+        }
+    std::vector<uint8_t> bytes(nepochs * sizeof(Gnss_Synchro_Epoch));
+    std::memcpy(bytes.data(), epochs.data(), bytes.size());
+
+    gr::top_block_sptr top_block = gr::make_top_block("GnssSynchroEpochTest");
+    auto source = gr::blocks::vector_source_b::make(bytes, false, sizeof(Gnss_Synchro_Epoch));
+    auto to_channels = gnss_synchro_epoch_make_to_channels(nchannels);
+    std::vector<gr::blocks::vector_sink_b::sptr> sinks;
+    top_block->connect(source, 0, to_channels, 0);
+    for (uint32_t ch = 0; ch < nchannels; ch++)
+        {
+            sinks.push_back(gr::blocks::vector_sink_b::make(sizeof(Gnss_Synchro)));
+            top_block->connect(to_channels, static_cast<int>(ch), sinks.back(), 0);
+        }
+    top_block->run();
+
+    for (uint32_t ch = 0; ch < nchannels; ch++)
+        {
+            const std::vector<uint8_t> data = sinks[ch]->data();
+            ASSERT_EQ(data.size(), nepochs * sizeof(Gnss_Synchro));
+            for (size_t n = 0; n < nepochs; n++)
+                {
+                    Gnss_Synchro gs;
+                    std::memcpy(&gs, data.data() + n * sizeof(Gnss_Synchro), sizeof(Gnss_Synchro));
+                    EXPECT_EQ(gs.Channel_ID, static_cast<int32_t>(ch));
+                    if ((ch + n) % 2 == 0)
+                        {
+                            EXPECT_EQ(gs.PRN, ch + 1);
+                            EXPECT_EQ(gs.Pseudorange_m, 23456789.123 + static_cast<double>(n));
+                            EXPECT_TRUE(gs.Flag_valid_pseudorange);
+                        }
+                    else
+                        {
+                            EXPECT_EQ(gs.PRN, 0U);
+                            EXPECT_FALSE(gs.Flag_valid_pseudorange);
+                        }
+                }
+        }
+}
@@ -0,0 +1,230 @@
+/*!
+ * \file nav_page_bits_test.cc
+ * \brief This file implements unit tests for the Nav_Page_Bits class, the
+ * CRC-24Q engine and the decoding of packed Galileo I/NAV pages.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "Galileo_INAV.h"
+#include "crc24q.h"
+#include "galileo_inav_message.h"
+#include "nav_page_bits.h"
+#include <boost/crc.hpp>
+#include <boost/dynamic_bitset.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+std::string random_bits(std::mt19937& gen, std::size_t n)
+{
+    std::string bits(n, '0');
+    for (auto& b : bits)
+        {
+            b = (gen() & 1U) ? '1' : '0';
+        }
+    return bits;
+}
+
+
+std::string unsigned_to_bits(uint64_t value, std::size_t n)
+{
+    std::string bits(n, '0');
+    for (std::size_t i = 0; i < n; i++)
+        {
+            bits[i] = ((value >> (n - 1 - i)) & 1ULL) ? '1' : '0';
+        }
+    return bits;
+}
+}  // namespace
+
+
+TEST(NavPageBitsTest, ReadMatchesString)
+{
+    std::mt19937 gen(1234);
+    for (int trial = 0; trial < 100; trial++)
+        {
+            const std::string bits = random_bits(gen, 244);
+            const Nav_Page_Bits<244> page(bits);
+            EXPECT_EQ(page.to_string(), bits);
+
+            std::vector<int32_t> symbols(bits.size());
+            std::transform(bits.begin(), bits.end(), symbols.begin(), [](char c) { return c == '1' ? 1 : -1; });
+            Nav_Page_Bits<244> assigned;
+            assigned.assign(symbols.data(), symbols.size());
+            EXPECT_EQ(assigned.to_string(), bits);
+
+            for (int k = 0; k < 100; k++)
+                {
+                    const std::size_t len = 1 + gen() % 64;
+                    const std::size_t pos = gen() % (244 - len + 1);
+                    EXPECT_EQ(page.read(pos, len), std::stoull(bits.substr(pos, len), nullptr, 2));
+                    EXPECT_EQ(page[pos], bits[pos] == '1');
+                }
+        }
+}
+
+
+TEST(NavPageBitsTest, ReadParameters)
+{
+    // parameters split in two fields, as Omega0 in the Galileo F/NAV almanac
+    const std::vector<std::pair<int32_t, int32_t>> parameter({{211, 4}, {11, 12}});
+    std::mt19937 gen(4321);
+    for (int trial = 0; trial < 100; trial++)
+        {
+            const std::string bits = random_bits(gen, 244);
+            const Nav_Page_Bits<244> page(bits);
+            const std::string field = bits.substr(210, 4) + bits.substr(10, 12);
+            const uint64_t expected = std::stoull(field, nullptr, 2);
+            EXPECT_EQ(page.read_unsigned(parameter), expected);
+            const int64_t expected_signed = field[0] == '1' ? static_cast<int64_t>(expected) - 65536 : static_cast<int64_t>(expected);
+            EXPECT_EQ(page.read_signed(parameter), expected_signed);
+        }
+    const Nav_Page_Bits<128> all_ones(std::string(128, '1'));
+    EXPECT_EQ(all_ones.read_unsigned({{1, 64}}), ~0ULL);
+    EXPECT_EQ(all_ones.read_signed({{1, 64}}), -1);
+    EXPECT_EQ(all_ones.read_signed({{65, 3}}), -1);
+}
+
+
+TEST(NavPageBitsTest, WriteAndCopy)
+{
+    std::mt19937 gen(1111);
+    for (int trial = 0; trial < 100; trial++)
+        {
+            std::string bits = random_bits(gen, 234);
+            Nav_Page_Bits<234> page(bits);
+            const std::size_t len = 1 + gen() % 64;
+            const std::size_t pos = gen() % (234 - len + 1);
+            const uint64_t value = (static_cast<uint64_t>(gen()) << 32) | gen();
+            page.write(pos, len, value);
+            bits.replace(pos, len, unsigned_to_bits(value, len));
+            EXPECT_EQ(page.to_string(), bits);
+
+            const std::string other_bits = random_bits(gen, 120);
+            const Nav_Page_Bits<120> other(other_bits);
+            const std::size_t copy_len = 1 + gen() % 120;
+            const std::size_t copy_pos = gen() % (234 - copy_len + 1);
+            page.copy(copy_pos, other, 0, copy_len);
+            bits.replace(copy_pos, copy_len, other_bits.substr(0, copy_len));
+            EXPECT_EQ(page.to_string(), bits);
+            EXPECT_EQ(page.to_string(copy_pos, copy_len), other_bits.substr(0, copy_len));
+        }
+}
+
+
+TEST(NavPageBitsTest, ToBytesPadsAtTheStart)
+{
+    std::mt19937 gen(2222);
+    for (int trial = 0; trial < 100; trial++)
+        {
+            const std::string bits = random_bits(gen, GALILEO_DATA_FRAME_BITS);
+            const Nav_Page_Bits<GALILEO_INAV_PAGE_BITS> page(bits);
+            std::array<uint8_t, GALILEO_DATA_FRAME_BYTES> bytes{};
+            page.to_bytes(0, GALILEO_DATA_FRAME_BITS, bytes.data());
+
+            // reference: the former conversion through boost::dynamic_bitset
+            boost::dynamic_bitset<unsigned char> frame_bits(bits);
+            std::vector<unsigned char> expected;
+            boost::to_block_range(frame_bits, std::back_inserter(expected));
+            std::reverse(expected.begin(), expected.end());
+            ASSERT_EQ(expected.size(), bytes.size());
+            for (std::size_t i = 0; i < bytes.size(); i++)
+                {
+                    EXPECT_EQ(bytes[i], expected[i]);
+                }
+        }
+}
+
+
+TEST(NavPageBitsTest, Crc24qOfBytes)
+{
+    std::mt19937 gen(4444);
+    std::vector<uint8_t> data(1100);
+    for (auto& b : data)
+        {
+            b = static_cast<uint8_t>(gen());
+        }
+    // lengths on both sides of the carry-less multiplication threshold
+    for (std::size_t len = 0; len <= data.size(); len += (len < 300 ? 1 : 67))
+        {
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            crc.process_bytes(data.data(), len);
+            EXPECT_EQ(Crc24q::checksum_table(data.data(), len), crc.checksum()) << "len=" << len;
+            EXPECT_EQ(Crc24q::checksum(data.data(), len), crc.checksum()) << "len=" << len;
+        }
+}
+
+
+TEST(NavPageBitsTest, Crc24qOfPageBits)
+{
+    std::mt19937 gen(5555);
+    const std::string bits = random_bits(gen, GALILEO_INAV_PAGE_BITS);
+    const Nav_Page_Bits<GALILEO_INAV_PAGE_BITS> page(bits);
+    for (int trial = 0; trial < 200; trial++)
+        {
+            const std::size_t pos = gen() % GALILEO_INAV_PAGE_BITS;
+            const std::size_t len = gen() % (GALILEO_INAV_PAGE_BITS - pos + 1);
+            // reference: zero padding at the start, as done in the Galileo decoders
+            std::vector<uint8_t> bytes((len + 7) / 8);
+            page.to_bytes(pos, len, bytes.data());
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+            crc.process_bytes(bytes.data(), bytes.size());
+            EXPECT_EQ(Crc24q::checksum(page, pos, len), crc.checksum()) << "pos=" << pos << " len=" << len;
+        }
+}
+
+
+TEST(NavPageBitsTest, GalileoInavWordType0)
+{
+    // Word type 0 with valid time, WN = 1234 and TOW = 345678
+    std::mt19937 gen(3333);
+    const std::string data_jk = unsigned_to_bits(0, 6) + "10" + random_bits(gen, 88) + unsigned_to_bits(1234, 12) + unsigned_to_bits(345678, 20);
+    const std::string even = "00" + data_jk.substr(0, 112);
+    const std::string odd_start = "10" + data_jk.substr(112, 16) + random_bits(gen, 64);
+    const Nav_Page_Bits<GALILEO_DATA_FRAME_BITS> frame(even + odd_start);
+    std::array<uint8_t, GALILEO_DATA_FRAME_BYTES> bytes{};
+    frame.to_bytes(0, GALILEO_DATA_FRAME_BITS, bytes.data());
+    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> crc;
+    crc.process_bytes(bytes.data(), bytes.size());
+    const std::string odd = odd_start + unsigned_to_bits(crc.checksum(), 24) + random_bits(gen, 8) + "000000";
+
+    Galileo_Inav_Message packed_message;
+    packed_message.split_page(Galileo_Inav_Page_Part(even + "000000"), 0);
+    packed_message.split_page(Galileo_Inav_Page_Part(odd), 1);
+    EXPECT_TRUE(packed_message.get_flag_CRC_test());
+    EXPECT_TRUE(packed_message.get_flag_TOW_set());
+    EXPECT_EQ(packed_message.get_Galileo_week(), 1234);
+    EXPECT_EQ(packed_message.get_TOW0(), 345678);
+
+    Galileo_Inav_Message string_message;
+    string_message.split_page(even + "000000", 0);
+    string_message.split_page(odd, 1);
+    EXPECT_TRUE(string_message.get_flag_CRC_test());
+    EXPECT_EQ(string_message.get_TOW0(), 345678);
+
+    // a flipped bit must be detected by the CRC
+    std::string wrong_odd = odd;
+    wrong_odd[20] = wrong_odd[20] == '1' ? '0' : '1';
+    Galileo_Inav_Message wrong_message;
+    wrong_message.split_page(Galileo_Inav_Page_Part(even + "000000"), 0);
+    wrong_message.split_page(Galileo_Inav_Page_Part(wrong_odd), 1);
+    EXPECT_FALSE(wrong_message.get_flag_CRC_test());
+    EXPECT_FALSE(wrong_message.get_flag_TOW_set());
+}